@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gateway_bench.dir/bench_fixGateway.cpp.o"
+  "CMakeFiles/gateway_bench.dir/bench_fixGateway.cpp.o.d"
+  "gateway_bench"
+  "gateway_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gateway_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/benchmarks/bench_auction.cpp" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_auction.cpp.o" "gcc" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_auction.cpp.o.d"
+  "/root/repo/benchmarks/bench_batch.cpp" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_batch.cpp.o" "gcc" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_batch.cpp.o.d"
+  "/root/repo/benchmarks/bench_bookStartup.cpp" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_bookStartup.cpp.o" "gcc" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_bookStartup.cpp.o.d"
+  "/root/repo/benchmarks/bench_instruments.cpp" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_instruments.cpp.o" "gcc" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_instruments.cpp.o.d"
+  "/root/repo/benchmarks/bench_journal.cpp" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_journal.cpp.o" "gcc" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_journal.cpp.o.d"
+  "/root/repo/benchmarks/bench_marketData.cpp" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_marketData.cpp.o" "gcc" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_marketData.cpp.o.d"
+  "/root/repo/benchmarks/bench_massCancel.cpp" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_massCancel.cpp.o" "gcc" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_massCancel.cpp.o.d"
+  "/root/repo/benchmarks/bench_matchingEngine.cpp" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_matchingEngine.cpp.o" "gcc" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_matchingEngine.cpp.o.d"
+  "/root/repo/benchmarks/bench_objectPool.cpp" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_objectPool.cpp.o" "gcc" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_objectPool.cpp.o.d"
+  "/root/repo/benchmarks/bench_orderTypes.cpp" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_orderTypes.cpp.o" "gcc" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_orderTypes.cpp.o.d"
+  "/root/repo/benchmarks/bench_queue.cpp" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_queue.cpp.o" "gcc" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_queue.cpp.o.d"
+  "/root/repo/benchmarks/bench_shardedEngine.cpp" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_shardedEngine.cpp.o" "gcc" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_shardedEngine.cpp.o.d"
+  "/root/repo/benchmarks/bench_snapshot.cpp" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_snapshot.cpp.o" "gcc" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_snapshot.cpp.o.d"
+  "/root/repo/benchmarks/bench_sparseBook.cpp" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_sparseBook.cpp.o" "gcc" "benchmarks/CMakeFiles/orderbook_bench.dir/bench_sparseBook.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
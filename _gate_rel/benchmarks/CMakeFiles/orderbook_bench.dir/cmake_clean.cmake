@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/orderbook_bench.dir/bench_auction.cpp.o"
+  "CMakeFiles/orderbook_bench.dir/bench_auction.cpp.o.d"
+  "CMakeFiles/orderbook_bench.dir/bench_batch.cpp.o"
+  "CMakeFiles/orderbook_bench.dir/bench_batch.cpp.o.d"
+  "CMakeFiles/orderbook_bench.dir/bench_bookStartup.cpp.o"
+  "CMakeFiles/orderbook_bench.dir/bench_bookStartup.cpp.o.d"
+  "CMakeFiles/orderbook_bench.dir/bench_instruments.cpp.o"
+  "CMakeFiles/orderbook_bench.dir/bench_instruments.cpp.o.d"
+  "CMakeFiles/orderbook_bench.dir/bench_journal.cpp.o"
+  "CMakeFiles/orderbook_bench.dir/bench_journal.cpp.o.d"
+  "CMakeFiles/orderbook_bench.dir/bench_marketData.cpp.o"
+  "CMakeFiles/orderbook_bench.dir/bench_marketData.cpp.o.d"
+  "CMakeFiles/orderbook_bench.dir/bench_massCancel.cpp.o"
+  "CMakeFiles/orderbook_bench.dir/bench_massCancel.cpp.o.d"
+  "CMakeFiles/orderbook_bench.dir/bench_matchingEngine.cpp.o"
+  "CMakeFiles/orderbook_bench.dir/bench_matchingEngine.cpp.o.d"
+  "CMakeFiles/orderbook_bench.dir/bench_objectPool.cpp.o"
+  "CMakeFiles/orderbook_bench.dir/bench_objectPool.cpp.o.d"
+  "CMakeFiles/orderbook_bench.dir/bench_orderTypes.cpp.o"
+  "CMakeFiles/orderbook_bench.dir/bench_orderTypes.cpp.o.d"
+  "CMakeFiles/orderbook_bench.dir/bench_queue.cpp.o"
+  "CMakeFiles/orderbook_bench.dir/bench_queue.cpp.o.d"
+  "CMakeFiles/orderbook_bench.dir/bench_shardedEngine.cpp.o"
+  "CMakeFiles/orderbook_bench.dir/bench_shardedEngine.cpp.o.d"
+  "CMakeFiles/orderbook_bench.dir/bench_snapshot.cpp.o"
+  "CMakeFiles/orderbook_bench.dir/bench_snapshot.cpp.o.d"
+  "CMakeFiles/orderbook_bench.dir/bench_sparseBook.cpp.o"
+  "CMakeFiles/orderbook_bench.dir/bench_sparseBook.cpp.o.d"
+  "orderbook_bench"
+  "orderbook_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orderbook_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/benchmarks/bench_bookView.cpp" "benchmarks/CMakeFiles/workload_bench.dir/bench_bookView.cpp.o" "gcc" "benchmarks/CMakeFiles/workload_bench.dir/bench_bookView.cpp.o.d"
+  "/root/repo/benchmarks/bench_reports.cpp" "benchmarks/CMakeFiles/workload_bench.dir/bench_reports.cpp.o" "gcc" "benchmarks/CMakeFiles/workload_bench.dir/bench_reports.cpp.o.d"
+  "/root/repo/benchmarks/bench_workload.cpp" "benchmarks/CMakeFiles/workload_bench.dir/bench_workload.cpp.o" "gcc" "benchmarks/CMakeFiles/workload_bench.dir/bench_workload.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
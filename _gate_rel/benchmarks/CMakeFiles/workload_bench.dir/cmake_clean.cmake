@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/workload_bench.dir/bench_bookView.cpp.o"
+  "CMakeFiles/workload_bench.dir/bench_bookView.cpp.o.d"
+  "CMakeFiles/workload_bench.dir/bench_reports.cpp.o"
+  "CMakeFiles/workload_bench.dir/bench_reports.cpp.o.d"
+  "CMakeFiles/workload_bench.dir/bench_workload.cpp.o"
+  "CMakeFiles/workload_bench.dir/bench_workload.cpp.o.d"
+  "workload_bench"
+  "workload_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/workload_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/AuctionTest.cpp" "tests/CMakeFiles/EngineTests.dir/AuctionTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/AuctionTest.cpp.o.d"
+  "/root/repo/tests/BatchSessionTest.cpp" "tests/CMakeFiles/EngineTests.dir/BatchSessionTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/BatchSessionTest.cpp.o.d"
+  "/root/repo/tests/BookViewTest.cpp" "tests/CMakeFiles/EngineTests.dir/BookViewTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/BookViewTest.cpp.o.d"
+  "/root/repo/tests/ExecutionReportTest.cpp" "tests/CMakeFiles/EngineTests.dir/ExecutionReportTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/ExecutionReportTest.cpp.o.d"
+  "/root/repo/tests/FixGatewayTest.cpp" "tests/CMakeFiles/EngineTests.dir/FixGatewayTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/FixGatewayTest.cpp.o.d"
+  "/root/repo/tests/FixParserTest.cpp" "tests/CMakeFiles/EngineTests.dir/FixParserTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/FixParserTest.cpp.o.d"
+  "/root/repo/tests/InstrumentTest.cpp" "tests/CMakeFiles/EngineTests.dir/InstrumentTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/InstrumentTest.cpp.o.d"
+  "/root/repo/tests/JournalTest.cpp" "tests/CMakeFiles/EngineTests.dir/JournalTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/JournalTest.cpp.o.d"
+  "/root/repo/tests/LatencyHistogramTest.cpp" "tests/CMakeFiles/EngineTests.dir/LatencyHistogramTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/LatencyHistogramTest.cpp.o.d"
+  "/root/repo/tests/LockFreeQueueTest.cpp" "tests/CMakeFiles/EngineTests.dir/LockFreeQueueTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/LockFreeQueueTest.cpp.o.d"
+  "/root/repo/tests/MarketDataTest.cpp" "tests/CMakeFiles/EngineTests.dir/MarketDataTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/MarketDataTest.cpp.o.d"
+  "/root/repo/tests/MassCancelTest.cpp" "tests/CMakeFiles/EngineTests.dir/MassCancelTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/MassCancelTest.cpp.o.d"
+  "/root/repo/tests/MatchingEngineTest.cpp" "tests/CMakeFiles/EngineTests.dir/MatchingEngineTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/MatchingEngineTest.cpp.o.d"
+  "/root/repo/tests/ObjectPoolTest.cpp" "tests/CMakeFiles/EngineTests.dir/ObjectPoolTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/ObjectPoolTest.cpp.o.d"
+  "/root/repo/tests/OrderHandleTest.cpp" "tests/CMakeFiles/EngineTests.dir/OrderHandleTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/OrderHandleTest.cpp.o.d"
+  "/root/repo/tests/OrderIndexTest.cpp" "tests/CMakeFiles/EngineTests.dir/OrderIndexTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/OrderIndexTest.cpp.o.d"
+  "/root/repo/tests/OrderTypeTest.cpp" "tests/CMakeFiles/EngineTests.dir/OrderTypeTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/OrderTypeTest.cpp.o.d"
+  "/root/repo/tests/PriceBitmapTest.cpp" "tests/CMakeFiles/EngineTests.dir/PriceBitmapTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/PriceBitmapTest.cpp.o.d"
+  "/root/repo/tests/PriceLadderTest.cpp" "tests/CMakeFiles/EngineTests.dir/PriceLadderTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/PriceLadderTest.cpp.o.d"
+  "/root/repo/tests/ProbeTest.cpp" "tests/CMakeFiles/EngineTests.dir/ProbeTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/ProbeTest.cpp.o.d"
+  "/root/repo/tests/ShardedEngineTest.cpp" "tests/CMakeFiles/EngineTests.dir/ShardedEngineTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/ShardedEngineTest.cpp.o.d"
+  "/root/repo/tests/SnapshotTest.cpp" "tests/CMakeFiles/EngineTests.dir/SnapshotTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/SnapshotTest.cpp.o.d"
+  "/root/repo/tests/WarmUpTest.cpp" "tests/CMakeFiles/EngineTests.dir/WarmUpTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/WarmUpTest.cpp.o.d"
+  "/root/repo/tests/WorkloadGeneratorTest.cpp" "tests/CMakeFiles/EngineTests.dir/WorkloadGeneratorTest.cpp.o" "gcc" "tests/CMakeFiles/EngineTests.dir/WorkloadGeneratorTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,58 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/EngineTests.dir/AuctionTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/AuctionTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/BatchSessionTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/BatchSessionTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/BookViewTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/BookViewTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/ExecutionReportTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/ExecutionReportTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/FixGatewayTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/FixGatewayTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/FixParserTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/FixParserTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/InstrumentTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/InstrumentTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/JournalTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/JournalTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/LatencyHistogramTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/LatencyHistogramTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/LockFreeQueueTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/LockFreeQueueTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/MarketDataTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/MarketDataTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/MassCancelTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/MassCancelTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/MatchingEngineTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/MatchingEngineTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/ObjectPoolTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/ObjectPoolTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/OrderHandleTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/OrderHandleTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/OrderIndexTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/OrderIndexTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/OrderTypeTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/OrderTypeTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/PriceBitmapTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/PriceBitmapTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/PriceLadderTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/PriceLadderTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/ProbeTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/ProbeTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/ShardedEngineTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/ShardedEngineTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/SnapshotTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/SnapshotTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/WarmUpTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/WarmUpTest.cpp.o.d"
+  "CMakeFiles/EngineTests.dir/WorkloadGeneratorTest.cpp.o"
+  "CMakeFiles/EngineTests.dir/WorkloadGeneratorTest.cpp.o.d"
+  "EngineTests"
+  "EngineTests.pdb"
+  "EngineTests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EngineTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_gate_rel/tests/EngineTests[1]_tests.cmake")
+  include("/root/repo/_gate_rel/tests/EngineTests[1]_tests.cmake")
+else()
+  add_test(EngineTests_NOT_BUILT EngineTests_NOT_BUILT)
+endif()
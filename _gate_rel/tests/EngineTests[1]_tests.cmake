@@ -0,0 +1,219 @@
+add_test([=[MatchingEngineTest.FullMatch_RemovesLiquidity]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MatchingEngineTest.FullMatch_RemovesLiquidity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.FullMatch_RemovesLiquidity]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.PartialMatch_RestsRemainder]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MatchingEngineTest.PartialMatch_RestsRemainder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.PartialMatch_RestsRemainder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.CancelOrder_ExplicitlyRemoves]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MatchingEngineTest.CancelOrder_ExplicitlyRemoves]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.CancelOrder_ExplicitlyRemoves]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.ModifyInPlace_UpdatesWithoutLosingPriority]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MatchingEngineTest.ModifyInPlace_UpdatesWithoutLosingPriority]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.ModifyInPlace_UpdatesWithoutLosingPriority]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.ModifyToZero_ReportsTheOrderAndFreesIt]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MatchingEngineTest.ModifyToZero_ReportsTheOrderAndFreesIt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.ModifyToZero_ReportsTheOrderAndFreesIt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.ModifyAggressive_GhostTradeCheck]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MatchingEngineTest.ModifyAggressive_GhostTradeCheck]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.ModifyAggressive_GhostTradeCheck]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.ModifyReprice_RelinksWithoutReallocating]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MatchingEngineTest.ModifyReprice_RelinksWithoutReallocating]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.ModifyReprice_RelinksWithoutReallocating]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineTest.ModifySizeUp_LosesPriorityInPlace]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MatchingEngineTest.ModifySizeUp_LosesPriorityInPlace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineTest.ModifySizeUp_LosesPriorityInPlace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineRejectTest.FullBookRejectsInsteadOfThrowing]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MatchingEngineRejectTest.FullBookRejectsInsteadOfThrowing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineRejectTest.FullBookRejectsInsteadOfThrowing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineRejectTest.DuplicateIdIsRejectedBeforeMatching]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MatchingEngineRejectTest.DuplicateIdIsRejectedBeforeMatching]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineRejectTest.DuplicateIdIsRejectedBeforeMatching]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineBatchTest.BatchProcessingMatchesSequentialProcessing]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MatchingEngineBatchTest.BatchProcessingMatchesSequentialProcessing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineBatchTest.BatchProcessingMatchesSequentialProcessing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchingEngineBatchTest.TargetsChangedAfterLookupAreLookedUpAgain]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MatchingEngineBatchTest.TargetsChangedAfterLookupAreLookedUpAgain]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchingEngineBatchTest.TargetsChangedAfterLookupAreLookedUpAgain]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPoolTest.AllocationAndReuse]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=ObjectPoolTest.AllocationAndReuse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPoolTest.AllocationAndReuse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPoolTest.PoolExhaustion]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=ObjectPoolTest.PoolExhaustion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPoolTest.PoolExhaustion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPoolTest.GrowsByChunksWithoutMovingObjects]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=ObjectPoolTest.GrowsByChunksWithoutMovingObjects]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPoolTest.GrowsByChunksWithoutMovingObjects]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPoolTest.FreeListIsLifo]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=ObjectPoolTest.FreeListIsLifo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPoolTest.FreeListIsLifo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderIndexTest.InsertFindErase]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderIndexTest.InsertFindErase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderIndexTest.InsertFindErase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderIndexTest.BackwardShiftKeepsClustersReachable]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderIndexTest.BackwardShiftKeepsClustersReachable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderIndexTest.BackwardShiftKeepsClustersReachable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderIndexTest.DuplicateInsertIsRefused]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderIndexTest.DuplicateInsertIsRefused]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderIndexTest.DuplicateInsertIsRefused]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PriceBitmapTest.FindAcrossWordsAndLevels]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=PriceBitmapTest.FindAcrossWordsAndLevels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PriceBitmapTest.FindAcrossWordsAndLevels]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PriceBitmapTest.MatchesOrderedSet]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=PriceBitmapTest.MatchesOrderedSet]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PriceBitmapTest.MatchesOrderedSet]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PriceLadderTest.DenseLadderNeverMoves]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=PriceLadderTest.DenseLadderNeverMoves]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PriceLadderTest.DenseLadderNeverMoves]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PriceLadderTest.RecentreMovesLevelsBetweenRingAndOverflow]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=PriceLadderTest.RecentreMovesLevelsBetweenRingAndOverflow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PriceLadderTest.RecentreMovesLevelsBetweenRingAndOverflow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PriceLadderTest.WindowedBookMatchesDenseBook]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=PriceLadderTest.WindowedBookMatchesDenseBook]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PriceLadderTest.WindowedBookMatchesDenseBook]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShardedEngineTest.RoutesSymbolsToOwningShard]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=ShardedEngineTest.RoutesSymbolsToOwningShard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShardedEngineTest.RoutesSymbolsToOwningShard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShardedEngineTest.StopDrainsQueuedCommands]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=ShardedEngineTest.StopDrainsQueuedCommands]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShardedEngineTest.StopDrainsQueuedCommands]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LockFreeQueueTest.UsesWholePowerOfTwoCapacityAndWraps]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=LockFreeQueueTest.UsesWholePowerOfTwoCapacityAndWraps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LockFreeQueueTest.UsesWholePowerOfTwoCapacityAndWraps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LockFreeQueueTest.BatchesArePartialWhenFull]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=LockFreeQueueTest.BatchesArePartialWhenFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LockFreeQueueTest.BatchesArePartialWhenFull]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LockFreeQueueTest.EmplaceAndConsumeMoveOnlyInPlace]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=LockFreeQueueTest.EmplaceAndConsumeMoveOnlyInPlace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LockFreeQueueTest.EmplaceAndConsumeMoveOnlyInPlace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LockFreeQueueTest.TwoThreadsPreserveOrder]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=LockFreeQueueTest.TwoThreadsPreserveOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LockFreeQueueTest.TwoThreadsPreserveOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MpscQueueTest.ProducersKeepTheirOwnOrder]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MpscQueueTest.ProducersKeepTheirOwnOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MpscQueueTest.ProducersKeepTheirOwnOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[JournalTest.AppendsSyncsAndRecoversOnReopen]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=JournalTest.AppendsSyncsAndRecoversOnReopen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[JournalTest.AppendsSyncsAndRecoversOnReopen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[JournalTest.FullSegmentRejectsAppends]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=JournalTest.FullSegmentRejectsAppends]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[JournalTest.FullSegmentRejectsAppends]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[JournalTest.ReplayReproducesLiveProcessing]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=JournalTest.ReplayReproducesLiveProcessing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[JournalTest.ReplayReproducesLiveProcessing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[JournalTest.TornRecordEndsTheValidPrefix]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=JournalTest.TornRecordEndsTheValidPrefix]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[JournalTest.TornRecordEndsTheValidPrefix]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SnapshotTest.RestoresQueuesCursorsAndIndex]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=SnapshotTest.RestoresQueuesCursorsAndIndex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SnapshotTest.RestoresQueuesCursorsAndIndex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SnapshotTest.RestoresIntoWindowedLadder]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=SnapshotTest.RestoresIntoWindowedLadder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SnapshotTest.RestoresIntoWindowedLadder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SnapshotTest.EmptyBookRoundTrips]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=SnapshotTest.EmptyBookRoundTrips]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SnapshotTest.EmptyBookRoundTrips]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SnapshotTest.RejectsIncompatibleBooks]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=SnapshotTest.RejectsIncompatibleBooks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SnapshotTest.RejectsIncompatibleBooks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SnapshotTest.RejectsDamagedFiles]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=SnapshotTest.RejectsDamagedFiles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SnapshotTest.RejectsDamagedFiles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookRestoreTest.RejectsOrdersAndCursorsItCannotHold]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderBookRestoreTest.RejectsOrdersAndCursorsItCannotHold]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookRestoreTest.RejectsOrdersAndCursorsItCannotHold]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MarketDataTest.ConflatesEveryChangeOfALevelWithinABatch]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MarketDataTest.ConflatesEveryChangeOfALevelWithinABatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MarketDataTest.ConflatesEveryChangeOfALevelWithinABatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MarketDataTest.TradesUpdateBothTheSweptLevelsAndTheRestingRemainder]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MarketDataTest.TradesUpdateBothTheSweptLevelsAndTheRestingRemainder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MarketDataTest.TradesUpdateBothTheSweptLevelsAndTheRestingRemainder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MarketDataTest.ModifiesReportOldAndNewLevels]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MarketDataTest.ModifiesReportOldAndNewLevels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MarketDataTest.ModifiesReportOldAndNewLevels]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MarketDataTest.UpdatesRebuildTheDepthUnderRandomChurn]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MarketDataTest.UpdatesRebuildTheDepthUnderRandomChurn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MarketDataTest.UpdatesRebuildTheDepthUnderRandomChurn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkloadGeneratorTest.SameSeedSameStream]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=WorkloadGeneratorTest.SameSeedSameStream]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkloadGeneratorTest.SameSeedSameStream]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkloadGeneratorTest.EveryStreamReplaysCleanly]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=WorkloadGeneratorTest.EveryStreamReplaysCleanly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkloadGeneratorTest.EveryStreamReplaysCleanly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkloadGeneratorTest.SavesAndLoadsBinaryStreams]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=WorkloadGeneratorTest.SavesAndLoadsBinaryStreams]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkloadGeneratorTest.SavesAndLoadsBinaryStreams]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LatencyHistogramTest.BucketsCoverTheRangeWithBoundedRelativeError]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=LatencyHistogramTest.BucketsCoverTheRangeWithBoundedRelativeError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LatencyHistogramTest.BucketsCoverTheRangeWithBoundedRelativeError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LatencyHistogramTest.PercentilesOfAUniformDistribution]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=LatencyHistogramTest.PercentilesOfAUniformDistribution]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LatencyHistogramTest.PercentilesOfAUniformDistribution]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LatencyHistogramTest.MergingEqualsRecordingEverythingInOne]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=LatencyHistogramTest.MergingEqualsRecordingEverythingInOne]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LatencyHistogramTest.MergingEqualsRecordingEverythingInOne]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LatencyHistogramTest.RecorderSamplesEachOperationOnce]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=LatencyHistogramTest.RecorderSamplesEachOperationOnce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LatencyHistogramTest.RecorderSamplesEachOperationOnce]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProbeTest.CountsPhasesFillsAndCursorWalks]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=ProbeTest.CountsPhasesFillsAndCursorWalks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProbeTest.CountsPhasesFillsAndCursorWalks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProbeTest.InstrumentationDoesNotChangeResults]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=ProbeTest.InstrumentationDoesNotChangeResults]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProbeTest.InstrumentationDoesNotChangeResults]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProbeTest.ReaderSnapshotsOtherThreadsWhileTheyRecord]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=ProbeTest.ReaderSnapshotsOtherThreadsWhileTheyRecord]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProbeTest.ReaderSnapshotsOtherThreadsWhileTheyRecord]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InstrumentTest.TickedBookSpeaksPricesOutside]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=InstrumentTest.TickedBookSpeaksPricesOutside]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InstrumentTest.TickedBookSpeaksPricesOutside]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InstrumentTest.AcceptsOnlyWhatTheInstrumentCanStore]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=InstrumentTest.AcceptsOnlyWhatTheInstrumentCanStore]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InstrumentTest.AcceptsOnlyWhatTheInstrumentCanStore]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InstrumentTest.EngineRejectsWhatANarrowBookCannotHold]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=InstrumentTest.EngineRejectsWhatANarrowBookCannotHold]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InstrumentTest.EngineRejectsWhatANarrowBookCannotHold]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InstrumentTest.EngineRejectsPricesOffTheTick]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=InstrumentTest.EngineRejectsPricesOffTheTick]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InstrumentTest.EngineRejectsPricesOffTheTick]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InstrumentTest.NarrowBookMatchesTheDefaultBookEventForEvent]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=InstrumentTest.NarrowBookMatchesTheDefaultBookEventForEvent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InstrumentTest.NarrowBookMatchesTheDefaultBookEventForEvent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchSessionTest.RecordsTradesAndEventsPerCommand]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=BatchSessionTest.RecordsTradesAndEventsPerCommand]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchSessionTest.RecordsTradesAndEventsPerCommand]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchSessionTest.UnknownIdsNeverReachTheEngine]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=BatchSessionTest.UnknownIdsNeverReachTheEngine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchSessionTest.UnknownIdsNeverReachTheEngine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchSessionTest.InvalidBatchIsRejectedWhole]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=BatchSessionTest.InvalidBatchIsRejectedWhole]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchSessionTest.InvalidBatchIsRejectedWhole]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchSessionTest.DuplicateIdsAreRejectedByTheEngine]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=BatchSessionTest.DuplicateIdsAreRejectedByTheEngine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchSessionTest.DuplicateIdsAreRejectedByTheEngine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchSessionTest.ModifyToZeroReportsTheOrderItRemoves]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=BatchSessionTest.ModifyToZeroReportsTheOrderItRemoves]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchSessionTest.ModifyToZeroReportsTheOrderItRemoves]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MassCancelTest.RemovesOnlyTheOwnersOrdersAndMovesCursorsOnce]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MassCancelTest.RemovesOnlyTheOwnersOrdersAndMovesCursorsOnce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MassCancelTest.RemovesOnlyTheOwnersOrdersAndMovesCursorsOnce]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MassCancelTest.FilterBySideAndPriceRange]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MassCancelTest.FilterBySideAndPriceRange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MassCancelTest.FilterBySideAndPriceRange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MassCancelTest.OwnerListsFollowFillsCancelsAndReprices]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MassCancelTest.OwnerListsFollowFillsCancelsAndReprices]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MassCancelTest.OwnerListsFollowFillsCancelsAndReprices]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MassCancelTest.NarrowInstrumentCarriesItsOwner]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MassCancelTest.NarrowInstrumentCarriesItsOwner]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MassCancelTest.NarrowInstrumentCarriesItsOwner]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MassCancelTest.RestoredBookKeepsOwnerLists]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=MassCancelTest.RestoredBookKeepsOwnerLists]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MassCancelTest.RestoredBookKeepsOwnerLists]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExecutionReportTest.ConsumerSeesEveryEventInSequence]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=ExecutionReportTest.ConsumerSeesEveryEventInSequence]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExecutionReportTest.ConsumerSeesEveryEventInSequence]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExecutionReportTest.DropPolicyNeverWaitsAndLeavesSequenceGaps]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=ExecutionReportTest.DropPolicyNeverWaitsAndLeavesSequenceGaps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExecutionReportTest.DropPolicyNeverWaitsAndLeavesSequenceGaps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExecutionReportTest.BlockPolicyWaitsForTheConsumer]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=ExecutionReportTest.BlockPolicyWaitsForTheConsumer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExecutionReportTest.BlockPolicyWaitsForTheConsumer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FixParserTest.EncodedMessageFramesAndParses]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=FixParserTest.EncodedMessageFramesAndParses]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FixParserTest.EncodedMessageFramesAndParses]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FixParserTest.BadValuesAndMalformedFields]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=FixParserTest.BadValuesAndMalformedFields]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FixParserTest.BadValuesAndMalformedFields]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FixParserTest.VectorScanMatchesScalarScan]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=FixParserTest.VectorScanMatchesScalarScan]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FixParserTest.VectorScanMatchesScalarScan]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FixGatewayTest.CrossingOrderReportsToBothSessions]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=FixGatewayTest.CrossingOrderReportsToBothSessions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FixGatewayTest.CrossingOrderReportsToBothSessions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FixGatewayTest.CancelReplaceAndRejects]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=FixGatewayTest.CancelReplaceAndRejects]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FixGatewayTest.CancelReplaceAndRejects]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FixGatewayTest.TimeInForceAndOrderTypes]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=FixGatewayTest.TimeInForceAndOrderTypes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FixGatewayTest.TimeInForceAndOrderTypes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FixGatewayTest.LogoutCancelsTheSessionsOrders]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=FixGatewayTest.LogoutCancelsTheSessionsOrders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FixGatewayTest.LogoutCancelsTheSessionsOrders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FixGatewayTest.OrdersLeftRestingStayWithTheirCompId]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=FixGatewayTest.OrdersLeftRestingStayWithTheirCompId]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FixGatewayTest.OrdersLeftRestingStayWithTheirCompId]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FixGatewayTest.ReplayedWorkloadMatchesTheEngine]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=FixGatewayTest.ReplayedWorkloadMatchesTheEngine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FixGatewayTest.ReplayedWorkloadMatchesTheEngine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AuctionTest.AccumulatesThenUncrossesInPriority]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=AuctionTest.AccumulatesThenUncrossesInPriority]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AuctionTest.AccumulatesThenUncrossesInPriority]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AuctionTest.TieBreaks]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=AuctionTest.TieBreaks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AuctionTest.TieBreaks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AuctionTest.ModifiesAndCancelsDoNotMatchDuringTheAuction]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=AuctionTest.ModifiesAndCancelsDoNotMatchDuringTheAuction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AuctionTest.ModifiesAndCancelsDoNotMatchDuringTheAuction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AuctionTest.MatchesBruteForce]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=AuctionTest.MatchesBruteForce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AuctionTest.MatchesBruteForce]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AuctionTest.PrefixSumMatchesScalar]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=AuctionTest.PrefixSumMatchesScalar]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AuctionTest.PrefixSumMatchesScalar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTypeTest.ImmediateOrCancelExpiresTheRemainder]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderTypeTest.ImmediateOrCancelExpiresTheRemainder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTypeTest.ImmediateOrCancelExpiresTheRemainder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTypeTest.FillOrKillChecksDepthBeforeTouchingOrders]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderTypeTest.FillOrKillChecksDepthBeforeTouchingOrders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTypeTest.FillOrKillChecksDepthBeforeTouchingOrders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTypeTest.MarketOrdersIgnoreTheirPrice]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderTypeTest.MarketOrdersIgnoreTheirPrice]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTypeTest.MarketOrdersIgnoreTheirPrice]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTypeTest.PostOnlyRestsOrIsRejected]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderTypeTest.PostOnlyRestsOrIsRejected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTypeTest.PostOnlyRestsOrIsRejected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTypeTest.CommandsCarryTheOrderType]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderTypeTest.CommandsCarryTheOrderType]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTypeTest.CommandsCarryTheOrderType]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTypeTest.FillOrKillAgreesWithImmediateOrCancel]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderTypeTest.FillOrKillAgreesWithImmediateOrCancel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTypeTest.FillOrKillAgreesWithImmediateOrCancel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderHandleTest.CancelsByHandle]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderHandleTest.CancelsByHandle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderHandleTest.CancelsByHandle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderHandleTest.StaleHandlesAreRejected]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderHandleTest.StaleHandlesAreRejected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderHandleTest.StaleHandlesAreRejected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderHandleTest.HandlesStayStaleAcrossReset]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderHandleTest.HandlesStayStaleAcrossReset]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderHandleTest.HandlesStayStaleAcrossReset]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderHandleTest.UnknownIdsAreNotDereferenced]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderHandleTest.UnknownIdsAreNotDereferenced]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderHandleTest.UnknownIdsAreNotDereferenced]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderHandleTest.ModifiesKeepOrRenewTheHandle]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderHandleTest.ModifiesKeepOrRenewTheHandle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderHandleTest.ModifiesKeepOrRenewTheHandle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderHandleTest.LambdaAndMarketDataListenersGetHandles]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderHandleTest.LambdaAndMarketDataListenersGetHandles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderHandleTest.LambdaAndMarketDataListenersGetHandles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderHandleTest.HandlesAgreeWithIdsUnderChurn]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=OrderHandleTest.HandlesAgreeWithIdsUnderChurn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderHandleTest.HandlesAgreeWithIdsUnderChurn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BookViewTest.SeqlockReadersNeverSeeATornValue]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=BookViewTest.SeqlockReadersNeverSeeATornValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BookViewTest.SeqlockReadersNeverSeeATornValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BookViewTest.PublishesTopAndDepth]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=BookViewTest.PublishesTopAndDepth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BookViewTest.PublishesTopAndDepth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BookViewTest.DepthMatchesTheBookOnWindowedAndLargeTickBooks]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=BookViewTest.DepthMatchesTheBookOnWindowedAndLargeTickBooks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BookViewTest.DepthMatchesTheBookOnWindowedAndLargeTickBooks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BookViewTest.ShardedEngineViewsFollowTheBooks]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=BookViewTest.ShardedEngineViewsFollowTheBooks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BookViewTest.ShardedEngineViewsFollowTheBooks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WarmUpTest.LeavesTheBookAsConstructed]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=WarmUpTest.LeavesTheBookAsConstructed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WarmUpTest.LeavesTheBookAsConstructed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WarmUpTest.MatchesExactlyLikeAFreshBook]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=WarmUpTest.MatchesExactlyLikeAFreshBook]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WarmUpTest.MatchesExactlyLikeAFreshBook]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WarmUpTest.RestoreCanFollow]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=WarmUpTest.RestoreCanFollow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WarmUpTest.RestoreCanFollow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WarmUpTest.CommitsTheWholePool]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=WarmUpTest.CommitsTheWholePool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WarmUpTest.CommitsTheWholePool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WarmUpTest.TinyBooks]=]  /root/repo/_gate_rel/tests/EngineTests [==[--gtest_filter=WarmUpTest.TinyBooks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WarmUpTest.TinyBooks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_rel/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  EngineTests_TESTS MatchingEngineTest.FullMatch_RemovesLiquidity MatchingEngineTest.PartialMatch_RestsRemainder MatchingEngineTest.CancelOrder_ExplicitlyRemoves MatchingEngineTest.ModifyInPlace_UpdatesWithoutLosingPriority MatchingEngineTest.ModifyToZero_ReportsTheOrderAndFreesIt MatchingEngineTest.ModifyAggressive_GhostTradeCheck MatchingEngineTest.ModifyReprice_RelinksWithoutReallocating MatchingEngineTest.ModifySizeUp_LosesPriorityInPlace MatchingEngineRejectTest.FullBookRejectsInsteadOfThrowing MatchingEngineRejectTest.DuplicateIdIsRejectedBeforeMatching MatchingEngineBatchTest.BatchProcessingMatchesSequentialProcessing MatchingEngineBatchTest.TargetsChangedAfterLookupAreLookedUpAgain ObjectPoolTest.AllocationAndReuse ObjectPoolTest.PoolExhaustion ObjectPoolTest.GrowsByChunksWithoutMovingObjects ObjectPoolTest.FreeListIsLifo OrderIndexTest.InsertFindErase OrderIndexTest.BackwardShiftKeepsClustersReachable OrderIndexTest.DuplicateInsertIsRefused PriceBitmapTest.FindAcrossWordsAndLevels PriceBitmapTest.MatchesOrderedSet PriceLadderTest.DenseLadderNeverMoves PriceLadderTest.RecentreMovesLevelsBetweenRingAndOverflow PriceLadderTest.WindowedBookMatchesDenseBook ShardedEngineTest.RoutesSymbolsToOwningShard ShardedEngineTest.StopDrainsQueuedCommands LockFreeQueueTest.UsesWholePowerOfTwoCapacityAndWraps LockFreeQueueTest.BatchesArePartialWhenFull LockFreeQueueTest.EmplaceAndConsumeMoveOnlyInPlace LockFreeQueueTest.TwoThreadsPreserveOrder MpscQueueTest.ProducersKeepTheirOwnOrder JournalTest.AppendsSyncsAndRecoversOnReopen JournalTest.FullSegmentRejectsAppends JournalTest.ReplayReproducesLiveProcessing JournalTest.TornRecordEndsTheValidPrefix SnapshotTest.RestoresQueuesCursorsAndIndex SnapshotTest.RestoresIntoWindowedLadder SnapshotTest.EmptyBookRoundTrips SnapshotTest.RejectsIncompatibleBooks SnapshotTest.RejectsDamagedFiles OrderBookRestoreTest.RejectsOrdersAndCursorsItCannotHold MarketDataTest.ConflatesEveryChangeOfALevelWithinABatch MarketDataTest.TradesUpdateBothTheSweptLevelsAndTheRestingRemainder MarketDataTest.ModifiesReportOldAndNewLevels MarketDataTest.UpdatesRebuildTheDepthUnderRandomChurn WorkloadGeneratorTest.SameSeedSameStream WorkloadGeneratorTest.EveryStreamReplaysCleanly WorkloadGeneratorTest.SavesAndLoadsBinaryStreams LatencyHistogramTest.BucketsCoverTheRangeWithBoundedRelativeError LatencyHistogramTest.PercentilesOfAUniformDistribution LatencyHistogramTest.MergingEqualsRecordingEverythingInOne LatencyHistogramTest.RecorderSamplesEachOperationOnce ProbeTest.CountsPhasesFillsAndCursorWalks ProbeTest.InstrumentationDoesNotChangeResults ProbeTest.ReaderSnapshotsOtherThreadsWhileTheyRecord InstrumentTest.TickedBookSpeaksPricesOutside InstrumentTest.AcceptsOnlyWhatTheInstrumentCanStore InstrumentTest.EngineRejectsWhatANarrowBookCannotHold InstrumentTest.EngineRejectsPricesOffTheTick InstrumentTest.NarrowBookMatchesTheDefaultBookEventForEvent BatchSessionTest.RecordsTradesAndEventsPerCommand BatchSessionTest.UnknownIdsNeverReachTheEngine BatchSessionTest.InvalidBatchIsRejectedWhole BatchSessionTest.DuplicateIdsAreRejectedByTheEngine BatchSessionTest.ModifyToZeroReportsTheOrderItRemoves MassCancelTest.RemovesOnlyTheOwnersOrdersAndMovesCursorsOnce MassCancelTest.FilterBySideAndPriceRange MassCancelTest.OwnerListsFollowFillsCancelsAndReprices MassCancelTest.NarrowInstrumentCarriesItsOwner MassCancelTest.RestoredBookKeepsOwnerLists ExecutionReportTest.ConsumerSeesEveryEventInSequence ExecutionReportTest.DropPolicyNeverWaitsAndLeavesSequenceGaps ExecutionReportTest.BlockPolicyWaitsForTheConsumer FixParserTest.EncodedMessageFramesAndParses FixParserTest.BadValuesAndMalformedFields FixParserTest.VectorScanMatchesScalarScan FixGatewayTest.CrossingOrderReportsToBothSessions FixGatewayTest.CancelReplaceAndRejects FixGatewayTest.TimeInForceAndOrderTypes FixGatewayTest.LogoutCancelsTheSessionsOrders FixGatewayTest.OrdersLeftRestingStayWithTheirCompId FixGatewayTest.ReplayedWorkloadMatchesTheEngine AuctionTest.AccumulatesThenUncrossesInPriority AuctionTest.TieBreaks AuctionTest.ModifiesAndCancelsDoNotMatchDuringTheAuction AuctionTest.MatchesBruteForce AuctionTest.PrefixSumMatchesScalar OrderTypeTest.ImmediateOrCancelExpiresTheRemainder OrderTypeTest.FillOrKillChecksDepthBeforeTouchingOrders OrderTypeTest.MarketOrdersIgnoreTheirPrice OrderTypeTest.PostOnlyRestsOrIsRejected OrderTypeTest.CommandsCarryTheOrderType OrderTypeTest.FillOrKillAgreesWithImmediateOrCancel OrderHandleTest.CancelsByHandle OrderHandleTest.StaleHandlesAreRejected OrderHandleTest.HandlesStayStaleAcrossReset OrderHandleTest.UnknownIdsAreNotDereferenced OrderHandleTest.ModifiesKeepOrRenewTheHandle OrderHandleTest.LambdaAndMarketDataListenersGetHandles OrderHandleTest.HandlesAgreeWithIdsUnderChurn BookViewTest.SeqlockReadersNeverSeeATornValue BookViewTest.PublishesTopAndDepth BookViewTest.DepthMatchesTheBookOnWindowedAndLargeTickBooks BookViewTest.ShardedEngineViewsFollowTheBooks WarmUpTest.LeavesTheBookAsConstructed WarmUpTest.MatchesExactlyLikeAFreshBook WarmUpTest.RestoreCanFollow WarmUpTest.CommitsTheWholePool WarmUpTest.TinyBooks)
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "src/engines/MatchingEngine.h"
+
+inline auto make_noop_listener() {
+    return MatchingEngineListener{[](OrderId, OrderId, Price, Quantity) {}, [](const Order&) {}, [](OrderId) {},
+                                  [](const Order&) {}};
+}
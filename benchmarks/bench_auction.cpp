@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "BenchUtils.h"
+
+namespace {
+
+constexpr Price MAX_PRICE = 100'000;
+constexpr Price MID = 50'000;
+constexpr Price DEPTH_LEVELS = 2'000; // each side spreads this far from the middle
+constexpr Price CROSS_LEVELS = 200;   // and this far into the other side
+
+/**
+ * @brief An opening auction's accumulated book: `count` orders, bids over [MID - 2000, MID + 200] and asks over
+ * [MID - 200, MID + 2000], so 401 ticks cross
+ */
+struct AuctionBook {
+    std::vector<Order> orders;
+
+    explicit AuctionBook(size_t count) {
+        std::mt19937_64 rng(count);
+        for (OrderId id = 1; id <= count; ++id) {
+            Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            Price offset = rng() % (DEPTH_LEVELS + CROSS_LEVELS + 1);
+            Price price = side == Side::Buy ? MID + CROSS_LEVELS - offset : MID - CROSS_LEVELS + offset;
+            orders.emplace_back(id, static_cast<Quantity>(1 + rng() % 100), price, side);
+        }
+    }
+
+    std::unique_ptr<OrderBook> build() const {
+        auto book = std::make_unique<OrderBook>(orders.size(), MAX_PRICE);
+        auto listener = make_noop_listener();
+        book->beginAuction();
+        for (const Order& order : orders) {
+            MatchingEngine::submitOrder(order, *book, listener);
+        }
+        return book;
+    }
+};
+
+const AuctionBook& auctionBook(size_t count) {
+    static std::map<size_t, AuctionBook> books;
+    return books.try_emplace(count, count).first->second;
+}
+
+/**
+ * @brief The equilibrium price by visiting every resting order (the baseline): depth per tick of the crossed range
+ * accumulated order by order, then cumulated and scanned for the largest volume
+ */
+Price auctionPriceByOrders(OrderBook& book) {
+    const Price low = book.bestAsk();
+    const Price high = book.bestBid();
+    std::vector<uint64_t> supply(high - low + 1);
+    std::vector<uint64_t> demand(high - low + 1);
+    uint64_t outside = 0; // asks above the best bid, bids below the best ask: cannot trade
+    book.forEachRestingOrder([&](const Order& order) {
+        if (order.side == Side::Sell) {
+            (order.price <= high ? supply[order.price - low] : outside) += order.quantity;
+        } else {
+            (order.price >= low ? demand[order.price - low] : outside) += order.quantity;
+        }
+    });
+    for (size_t i = 1; i < supply.size(); ++i) {
+        supply[i] += supply[i - 1];
+        demand[demand.size() - 1 - i] += demand[demand.size() - i];
+    }
+    Price best = 0;
+    uint64_t best_volume = 0;
+    for (size_t i = 0; i < supply.size(); ++i) {
+        uint64_t volume = std::min(supply[i], demand[i]);
+        if (volume > best_volume) {
+            best_volume = volume;
+            best = low + i;
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+// ============================================================================
+// Indicative auction price over an accumulated book of 10k / 100k / 1M orders
+// Orders: one pass over every resting order (the cost grows with the book)
+// Levels: level quantities of the crossed ticks + SIMD prefix sums (the cost depends on the crossed width only)
+// ============================================================================
+static void BM_AuctionPrice_Orders(benchmark::State& state) {
+    auto book = auctionBook(state.range(0)).build();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(auctionPriceByOrders(*book));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AuctionPrice_Orders)->Arg(10'000)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMicrosecond);
+
+static void BM_AuctionPrice_Levels(benchmark::State& state) {
+    auto book = auctionBook(state.range(0)).build();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(MatchingEngine::auctionPrice(*book).price);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AuctionPrice_Levels)->Arg(10'000)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMicrosecond);
+
+// ============================================================================
+// Full uncross: equilibrium price plus executing every crossing order, trades per uncross as a counter
+// ============================================================================
+static void BM_Uncross(benchmark::State& state) {
+    const AuctionBook& setup = auctionBook(state.range(0));
+    uint64_t trades = 0;
+    auto listener = MatchingEngineListener{[&](OrderId, OrderId, Price, Quantity) { ++trades; }, [](const Order&) {},
+                                           [](OrderId) {}, [](const Order&) {}};
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto book = setup.build();
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(MatchingEngine::uncross(*book, listener).volume);
+
+        state.PauseTiming();
+        book.reset();
+        state.ResumeTiming();
+    }
+    state.counters["trades"] = benchmark::Counter(static_cast<double>(trades), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_Uncross)->Arg(10'000)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
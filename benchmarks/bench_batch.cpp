@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "BenchUtils.h"
+
+namespace {
+
+constexpr size_t RESTING_ORDERS = 1 << 20;
+constexpr size_t FLOW_COMMANDS = 1 << 20;
+constexpr Price MAX_PRICE = 100'000;
+constexpr Price MID = 50'000;
+constexpr Price SPREAD_LEVELS = 5'000;
+
+/**
+ * @brief A large resting book and a command flow that touches it at random (cold index buckets, slots, levels)
+ *
+ * Bids rest below MID and asks above, and modifies keep each order on its side, so nothing crosses and the set of
+ * live ids is known while generating: every cancel and modify targets an order that is live at that point.
+ */
+struct ColdFlow {
+    std::vector<Order> initial;
+    std::vector<Command> commands;
+
+    ColdFlow(unsigned cancel_percent, unsigned modify_percent) {
+        std::mt19937_64 rng(23);
+        std::vector<OrderId> live;
+        OrderId next_id = 1;
+        auto make_order = [&] {
+            Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            Price offset = 1 + rng() % SPREAD_LEVELS;
+            Price price = side == Side::Buy ? MID - offset : MID + offset;
+            live.push_back(next_id);
+            return Order(next_id++, static_cast<Quantity>(1 + rng() % 100), price, side);
+        };
+        for (size_t i = 0; i < RESTING_ORDERS; ++i) {
+            initial.push_back(make_order());
+        }
+        std::vector<Side> sides(next_id + FLOW_COMMANDS);
+        for (const Order& order : initial) {
+            sides[order.id] = order.side;
+        }
+
+        for (size_t i = 0; i < FLOW_COMMANDS; ++i) {
+            unsigned kind = rng() % 100;
+            if (kind < cancel_percent + modify_percent) {
+                size_t pick = rng() % live.size();
+                OrderId target = live[pick];
+                if (kind < cancel_percent) {
+                    live[pick] = live.back();
+                    live.pop_back();
+                    commands.push_back(Command::cancel(0, target));
+                } else {
+                    Price offset = 1 + rng() % SPREAD_LEVELS;
+                    Price price = sides[target] == Side::Buy ? MID - offset : MID + offset;
+                    commands.push_back(Command::modify(0, target, price, static_cast<Quantity>(1 + rng() % 100)));
+                }
+            } else {
+                Order order = make_order();
+                sides[order.id] = order.side;
+                commands.push_back(Command::submit(0, order));
+            }
+        }
+    }
+
+    std::unique_ptr<OrderBook> makeBook() const {
+        auto book = std::make_unique<OrderBook>(RESTING_ORDERS + FLOW_COMMANDS, MAX_PRICE);
+        auto listener = make_noop_listener();
+        for (const Order& order : initial) {
+            MatchingEngine::submitOrder(order, *book, listener);
+        }
+        return book;
+    }
+};
+
+void runFlow(benchmark::State& state, const ColdFlow& flow) {
+    const size_t batch_size = state.range(0);
+    auto listener = make_noop_listener();
+    std::span<const Command> commands(flow.commands);
+    auto book = flow.makeBook();
+    size_t offset = 0;
+
+    for (auto _ : state) {
+        if (offset + batch_size > commands.size()) [[unlikely]] {
+            state.PauseTiming();
+            book = flow.makeBook();
+            offset = 0;
+            state.ResumeTiming();
+        }
+        MatchingEngine::processBatch(commands.subspan(offset, batch_size), *book, listener);
+        offset += batch_size;
+    }
+    state.SetItemsProcessed(state.iterations() * batch_size);
+}
+
+} // namespace
+
+// ============================================================================
+// processBatch over a 1M-order book, by batch size (1 = no lookahead, i.e. plain process())
+// Time is per batch, items/s is commands/s
+// ============================================================================
+static void BM_BatchCancelHeavy(benchmark::State& state) {
+    static const ColdFlow flow(70, 0); // 70% cancels, 30% adds
+    runFlow(state, flow);
+}
+BENCHMARK(BM_BatchCancelHeavy)->Arg(1)->Arg(8)->Arg(32)->Arg(128);
+
+static void BM_BatchMixedFlow(benchmark::State& state) {
+    static const ColdFlow flow(35, 20); // 35% cancels, 20% modifies, 45% adds
+    runFlow(state, flow);
+}
+BENCHMARK(BM_BatchMixedFlow)->Arg(1)->Arg(8)->Arg(32)->Arg(128);
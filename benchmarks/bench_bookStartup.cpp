@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <memory>
+#include <vector>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "BenchUtils.h"
+#include "src/engines/MatchingEngine.h"
+#include "src/metrics/LatencyHistogram.h"
+#include "src/metrics/TscClock.h"
+#include "src/orderbook/OrderBook.h"
+#include "src/workload/WorkloadGenerator.h"
+
+static double residentMegabytes() {
+#ifdef __GLIBC__
+    malloc_trim(0); // hand back memory freed by previous runs, otherwise the next book reuses it invisibly
+#endif
+    size_t total_pages = 0, resident_pages = 0;
+    std::ifstream statm("/proc/self/statm");
+    statm >> total_pages >> resident_pages;
+    return static_cast<double>(resident_pages * sysconf(_SC_PAGESIZE)) / (1024.0 * 1024.0);
+}
+
+// ============================================================================
+// Book construction time and resident memory, dense vs sliding-window ladder
+// Args: {max_price, window_ticks (0 = dense)}
+// ============================================================================
+static void BM_BookStartup(benchmark::State& state) {
+    const Price max_price = state.range(0);
+    const size_t window_ticks = state.range(1);
+
+    double rss_before = residentMegabytes();
+    auto probe = std::make_unique<OrderBook>(1000, max_price, window_ticks, max_price / 2);
+    double rss_after = residentMegabytes();
+    benchmark::DoNotOptimize(probe.get());
+    probe.reset();
+
+    for (auto _ : state) {
+        auto book = std::make_unique<OrderBook>(1000, max_price, window_ticks, max_price / 2);
+        benchmark::DoNotOptimize(book.get());
+        state.PauseTiming();
+        book.reset();
+        state.ResumeTiming();
+    }
+    state.counters["rss_mb"] = rss_after - rss_before;
+}
+BENCHMARK(BM_BookStartup)
+    ->Args({10'000, 0})
+    ->Args({1'000'000, 0})
+    ->Args({10'000'000, 0})
+    ->Args({1'000'000, 65536})
+    ->Args({10'000'000, 65536})
+    ->Args({1'000'000'000, 65536})
+    ->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Latency of the first orders a new book sees, cold vs after MatchingEngine::warmUp
+// Args: {first_orders, warm_up, lazy_pool}
+//
+// Each iteration builds a book, sweeps a 64 MiB buffer through the caches (the rest of start-up: loading reference
+// data, connecting sessions, ...), optionally warms the book up, then times the first commands of a quote-churn
+// stream one by one with rdtsc. lazy_pool builds the book with an uncommitted, non-prefaulted pool
+// (initial_capacity 0), whose first orders also commit and fault in its chunks. page_faults counts the minor faults
+// taken by the timed commands. The L1 instruction cache stays warm across iterations, which this cannot undo: a
+// real first order after process start is slower still without the warm-up.
+// ============================================================================
+static void BM_FirstOrders(benchmark::State& state) {
+    static const TscClock clock = TscClock::calibrate();
+    static const WorkloadStream stream = WorkloadGenerator(profiles::quoteChurn()).generate(20'000);
+    const size_t first_orders = state.range(0);
+    const bool warm_up = state.range(1) != 0;
+    const bool lazy_pool = state.range(2) != 0;
+
+    std::vector<Command> commands(stream.setup);
+    commands.insert(commands.end(), stream.flow.begin(), stream.flow.end());
+    commands.resize(std::min(first_orders, commands.size()));
+    PoolOptions pool_options = lazy_pool ? PoolOptions{.initial_capacity = 0, .prefault = false} : PoolOptions{};
+    std::vector<char> evict(64 << 20, 1);
+    auto listener = make_noop_listener();
+    LatencyHistogram latency;
+    long page_faults = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto book = std::make_unique<OrderBook>(stream.peak_resting_orders + 1, stream.max_price, 0, 0, pool_options);
+        for (size_t i = 0; i < evict.size(); i += 64) {
+            evict[i] += 1;
+        }
+        benchmark::ClobberMemory();
+        if (warm_up) {
+            MatchingEngine::warmUp(*book);
+        }
+        rusage before;
+        getrusage(RUSAGE_SELF, &before);
+        state.ResumeTiming();
+
+        for (const Command& command : commands) {
+            uint64_t start = clock.start();
+            MatchingEngine::process(command, *book, listener);
+            latency.record(clock.stop() - start);
+        }
+
+        state.PauseTiming();
+        rusage after;
+        getrusage(RUSAGE_SELF, &after);
+        page_faults += after.ru_minflt - before.ru_minflt;
+        book.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * commands.size());
+    state.counters["mean_ns"] = latency.mean() * clock.nanosPerTick();
+    state.counters["p50_ns"] = clock.nanos(latency.percentile(50));
+    state.counters["p99_ns"] = clock.nanos(latency.percentile(99));
+    state.counters["page_faults"] = benchmark::Counter(static_cast<double>(page_faults),
+                                                       benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_FirstOrders)
+    ->ArgNames({"first_orders", "warm_up", "lazy_pool"})
+    ->ArgsProduct({{1'000, 10'000}, {0, 1}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
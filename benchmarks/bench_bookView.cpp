@@ -0,0 +1,141 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "BenchUtils.h"
+#include "src/infrastructure/Thread.h"
+#include "src/marketdata/BookView.h"
+#include "src/metrics/LatencyHistogram.h"
+#include "src/metrics/TscClock.h"
+#include "src/workload/WorkloadGenerator.h"
+
+// Matching with a BookView published after every command (second arg 1) or every 32 commands, as a batch (32),
+// while 0 to 8 reader threads poll it (top of book on every new version, full depth on every other one). Only the
+// matching thread is timed: items/s from its CPU time, p50/p99/p99.9 from rdtsc around each command plus the
+// publish that follows it. BM_BookView_NoPublish is the same flow without a view. On a machine with fewer cores
+// than readers + 1 the readers also compete for the CPU, which shows in the wall time and the tail percentiles
+// rather than in the CPU time, and a reader that preempts the writer mid-publish retries until it runs again.
+
+namespace {
+
+constexpr size_t FLOW_COMMANDS = 200'000;
+
+const WorkloadStream& viewStream() {
+    static const WorkloadStream stream = WorkloadGenerator(profiles::quoteChurn()).generate(FLOW_COMMANDS);
+    return stream;
+}
+
+/**
+ * @brief Reader threads polling a view until stopped; counts the copies they made and the attempts a publish spoiled
+ */
+class ViewReaders {
+  public:
+    ViewReaders(const BookView<>& view, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            threads.emplace_back([this, &view] { poll(view); });
+        }
+    }
+
+    ~ViewReaders() { stop(); }
+
+    void stop() {
+        running.store(false, std::memory_order_release);
+        for (auto& thread : threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+    }
+
+    std::atomic<uint64_t> reads{0};
+    std::atomic<uint64_t> retries{0};
+
+  private:
+    void poll(const BookView<>& view) {
+        uint64_t seen = 0;
+        uint64_t local_reads = 0;
+        uint64_t local_retries = 0;
+        TopOfBook top;
+        BookDepth<> depth;
+        while (running.load(std::memory_order_acquire)) {
+            uint64_t version = view.topVersion() + view.depthVersion();
+            if (version == seen) {
+                cpuRelax();
+                continue;
+            }
+            seen = version;
+            while (!view.tryTop(top)) {
+                ++local_retries;
+                cpuRelax();
+            }
+            if (version % 2 == 0) {
+                while (!view.tryDepth(depth)) {
+                    ++local_retries;
+                    cpuRelax();
+                }
+            }
+            benchmark::DoNotOptimize(top);
+            benchmark::DoNotOptimize(depth);
+            ++local_reads;
+        }
+        reads += local_reads;
+        retries += local_retries;
+    }
+
+    std::atomic<bool> running{true};
+    std::vector<std::thread> threads;
+};
+
+// publish_every: commands between two publishes, 0 for none
+void replayWithView(benchmark::State& state, size_t publish_every) {
+    static const TscClock clock = TscClock::calibrate();
+    const WorkloadStream& stream = viewStream();
+    auto listener = make_noop_listener();
+    LatencyHistogram latency;
+    BookView<> view;
+    ViewReaders readers(view, static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto book = std::make_unique<OrderBook>(stream.peak_resting_orders + 1, stream.max_price);
+        for (const Command& command : stream.setup) {
+            MatchingEngine::process(command, *book, listener);
+        }
+        state.ResumeTiming();
+
+        size_t pending = 0;
+        for (const Command& command : stream.flow) {
+            uint64_t start = clock.start();
+            MatchingEngine::process(command, *book, listener);
+            if (publish_every != 0 && ++pending == publish_every) {
+                view.publish(*book);
+                pending = 0;
+            }
+            latency.record(clock.stop() - start);
+        }
+
+        state.PauseTiming();
+        book.reset();
+        state.ResumeTiming();
+    }
+    readers.stop();
+    state.SetItemsProcessed(state.iterations() * stream.flow.size());
+    state.counters["p50_ns"] = clock.nanos(latency.percentile(50));
+    state.counters["p99_ns"] = clock.nanos(latency.percentile(99));
+    state.counters["p99.9_ns"] = clock.nanos(latency.percentile(99.9));
+    state.counters["reads"] = static_cast<double>(readers.reads.load());
+    state.counters["retries"] = static_cast<double>(readers.retries.load());
+}
+
+} // namespace
+
+static void BM_BookView_NoPublish(benchmark::State& state) { replayWithView(state, 0); }
+BENCHMARK(BM_BookView_NoPublish)->Arg(0)->Unit(benchmark::kMillisecond);
+
+static void BM_BookView_Readers(benchmark::State& state) { replayWithView(state, state.range(1)); }
+BENCHMARK(BM_BookView_Readers)
+    ->ArgNames({"readers", "publish_every"})
+    ->ArgsProduct({{0, 1, 2, 4, 8}, {1, 32}})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "src/gateway/FixClient.h"
+#include "src/gateway/FixGateway.h"
+#include "src/metrics/LatencyHistogram.h"
+#include "src/metrics/TscClock.h"
+
+// BM_FixParse: framing, checksum and field parsing of NewOrderSingles straight from a receive buffer, with the
+// scalar delimiter scan vs the vectorized one. BM_FixTickToAck: loopback round trip from the client writing a
+// NewOrderSingle to it reading the gateway's ExecutionReport, gateway busy-polling on its own thread; set
+// FIX_GATEWAY_CORE / FIX_CLIENT_CORE to pin them (on one shared core the round trip mostly measures the scheduler).
+
+namespace {
+
+constexpr size_t PARSE_MESSAGES = 4'096;
+
+/**
+ * @brief A receive buffer's worth of back-to-back NewOrderSingles with realistic field widths
+ */
+const std::string& newOrderBuffer() {
+    static const std::string buffer = [] {
+        std::mt19937_64 rng(3);
+        FixEncoder encoder;
+        std::string out;
+        char frame[FixEncoder::MAX_MESSAGE];
+        for (size_t i = 0; i < PARSE_MESSAGES; ++i) {
+            encoder.begin("D", "CLIENT0042", "ENGINE", 1'000'000 + i)
+                .uintField(FixTag::CL_ORD_ID, 100'000'000 + rng() % 100'000'000)
+                .textField(FixTag::SYMBOL, "XYZ.N")
+                .charField(FixTag::SIDE, rng() % 2 ? '1' : '2')
+                .uintField(FixTag::ORDER_QTY, 1 + rng() % 5'000)
+                .charField(FixTag::ORD_TYPE, '2')
+                .uintField(FixTag::PRICE, 90'000 + rng() % 20'000)
+                .textField(FixTag::TEXT, "desk-7/strategy-momentum");
+            out.append(frame, encoder.finish(frame, sizeof(frame)));
+        }
+        return out;
+    }();
+    return buffer;
+}
+
+int coreFromEnvironment(const char* name) {
+    const char* value = std::getenv(name);
+    return value == nullptr ? -1 : std::atoi(value);
+}
+
+} // namespace
+
+template <FixScan Scan> static void BM_FixParse(benchmark::State& state) {
+    const std::string& buffer = newOrderBuffer();
+    uint64_t quantity = 0;
+    for (auto _ : state) {
+        std::string_view pending(buffer);
+        FixMessage message;
+        while (size_t frame = fixFrameLength(pending)) {
+            if (parseFixMessage<Scan>(pending.substr(0, frame), message) != FixParseError::None) {
+                state.SkipWithError("parse failed");
+                return;
+            }
+            quantity += message.quantity;
+            pending.remove_prefix(frame);
+        }
+        benchmark::DoNotOptimize(quantity);
+    }
+    state.SetItemsProcessed(state.iterations() * PARSE_MESSAGES);
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+BENCHMARK_TEMPLATE(BM_FixParse, FixScan::Scalar);
+BENCHMARK_TEMPLATE(BM_FixParse, FixScan::Vector);
+
+static void BM_FixTickToAck(benchmark::State& state) {
+    static const TscClock clock = TscClock::calibrate();
+    OrderBook book(1 << 16, 200'000);
+    FixGateway gateway(book);
+    gateway.start(coreFromEnvironment("FIX_GATEWAY_CORE"));
+    if (int core = coreFromEnvironment("FIX_CLIENT_CORE"); core >= 0) {
+        pinCurrentThread(core);
+    }
+
+    FixClient client("BENCH");
+    client.connect("127.0.0.1", gateway.port());
+    client.logon();
+    client.flush();
+    bool logged_on = false;
+    while (!logged_on) {
+        client.poll([&](const FixExecution& execution) { logged_on |= execution.msg_type == 'A'; });
+    }
+
+    LatencyHistogram latency;
+    uint64_t cl_ord_id = 0;
+    auto awaitReport = [&](uint64_t id, char exec_type) {
+        bool seen = false;
+        for (uint64_t spins = 1; !seen; ++spins) {
+            client.poll([&](const FixExecution& execution) {
+                seen |= execution.cl_ord_id == id && execution.exec_type == exec_type;
+            });
+            if (spins % 64 == 0) {
+                std::this_thread::yield();
+            }
+        }
+    };
+    for (auto _ : state) {
+        // a resting bid acknowledged as New, then canceled (untimed) so the book stays small
+        ++cl_ord_id;
+        uint64_t start = clock.start();
+        client.newOrder(cl_ord_id, Side::Buy, 100, 100'000 - cl_ord_id % 1'000);
+        client.flush();
+        awaitReport(cl_ord_id, '0');
+        uint64_t ticks = clock.stop() - start;
+        latency.record(ticks);
+        state.SetIterationTime(clock.nanos(ticks) * 1e-9);
+
+        client.cancel(cl_ord_id);
+        client.flush();
+        awaitReport(cl_ord_id, '4');
+    }
+    gateway.stop();
+    state.counters["p50_ns"] = clock.nanos(latency.percentile(50));
+    state.counters["p99_ns"] = clock.nanos(latency.percentile(99));
+    state.counters["p99.9_ns"] = clock.nanos(latency.percentile(99.9));
+}
+BENCHMARK(BM_FixTickToAck)->UseManualTime()->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+#include "BenchUtils.h"
+#include "src/domain/Instruments.h"
+#include "src/workload/WorkloadGenerator.h"
+
+namespace {
+
+constexpr size_t FLOW_COMMANDS = 1'000'000;
+
+// liquid flow over 20'000 ticks: fits both example instruments (16-bit ticks, quantities and links)
+WorkloadProfile instrumentProfile() {
+    WorkloadProfile profile = profiles::liquidLargeTick();
+    profile.max_price = 20'000;
+    profile.initial_mid = 10'000;
+    return profile;
+}
+
+const WorkloadStream& rawStream() {
+    static const WorkloadStream stream = WorkloadGenerator(instrumentProfile()).generate(FLOW_COMMANDS);
+    return stream;
+}
+
+// the same flow in LargeTickFuture prices: generated tick t becomes price MIN_PRICE + (t - 1) * TICK_SIZE
+const WorkloadStream& futureStream() {
+    static const WorkloadStream stream = [] {
+        WorkloadStream scaled = rawStream();
+        auto scale = [](std::vector<Command>& commands) {
+            for (Command& command : commands) {
+                if (command.type != CommandType::Cancel) {
+                    command.price = LargeTickFuture::MIN_PRICE + (command.price - 1) * LargeTickFuture::TICK_SIZE;
+                }
+            }
+        };
+        scale(scaled.setup);
+        scale(scaled.flow);
+        scaled.max_price = LargeTickFuture::MAX_PRICE;
+        return scaled;
+    }();
+    return stream;
+}
+
+template <typename Book> void replay(benchmark::State& state, const WorkloadStream& stream) {
+    auto listener = make_noop_listener();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto book = std::make_unique<Book>(stream.peak_resting_orders + 1, stream.max_price);
+        for (const Command& command : stream.setup) {
+            MatchingEngine::process(command, *book, listener);
+        }
+        state.ResumeTiming();
+
+        for (const Command& command : stream.flow) {
+            MatchingEngine::process(command, *book, listener);
+        }
+        benchmark::DoNotOptimize(book->bestBid());
+
+        state.PauseTiming();
+        book.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * stream.flow.size());
+    state.counters["resting_order_bytes"] = sizeof(typename Book::RestingOrder);
+    state.counters["level_bytes"] = sizeof(typename Book::Level);
+}
+
+} // namespace
+
+// ============================================================================
+// One flow, several book specializations (see domain/Instruments.h)
+// Raw: prices are ticks of 1, default 64-bit book vs CompactEquity (32-bit ids/prices, 16-bit quantities and links)
+// Future: prices in units of 1/25 tick over a 1'000'000 offset; the default book needs a level per price unit,
+// LargeTickFuture one per tick
+// ============================================================================
+static void BM_InstrumentRaw_Default(benchmark::State& state) { replay<OrderBook>(state, rawStream()); }
+BENCHMARK(BM_InstrumentRaw_Default)->Unit(benchmark::kMillisecond);
+
+static void BM_InstrumentRaw_CompactEquity(benchmark::State& state) {
+    replay<BasicOrderBook<CompactEquity>>(state, rawStream());
+}
+BENCHMARK(BM_InstrumentRaw_CompactEquity)->Unit(benchmark::kMillisecond);
+
+static void BM_InstrumentFuture_Default(benchmark::State& state) { replay<OrderBook>(state, futureStream()); }
+BENCHMARK(BM_InstrumentFuture_Default)->Unit(benchmark::kMillisecond);
+
+static void BM_InstrumentFuture_LargeTickFuture(benchmark::State& state) {
+    replay<BasicOrderBook<LargeTickFuture>>(state, futureStream());
+}
+BENCHMARK(BM_InstrumentFuture_LargeTickFuture)->Unit(benchmark::kMillisecond);
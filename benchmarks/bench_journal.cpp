@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "BenchUtils.h"
+#include "src/persistence/JournalReplay.h"
+
+namespace {
+
+std::string journalPath(const char* name) {
+    return (std::filesystem::temp_directory_path() / (std::string(name) + "_" + std::to_string(::getpid()) + ".log"))
+        .string();
+}
+
+// passive flow around a mid: 70% submits, 30% cancels of earlier orders (some already filled, skipped at generation)
+std::vector<Command> makeFlow(size_t count) {
+    OrderBook book(count, 100'000);
+    auto listener = make_noop_listener();
+    std::mt19937_64 rng(42);
+    std::vector<Command> commands;
+    commands.reserve(count);
+    OrderId next_id = 1;
+    while (commands.size() < count) {
+        OrderId target = 1 + rng() % next_id;
+        Command command;
+        if (rng() % 10 < 3 && book.find(target) != nullptr) {
+            command = Command::cancel(0, target);
+        } else {
+            Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            Price price = side == Side::Buy ? 49'990 + rng() % 12 : 50'000 - 2 + rng() % 12;
+            command = Command::submit(0, Order(next_id++, static_cast<Quantity>(1 + rng() % 100), price, side));
+        }
+        MatchingEngine::process(command, book, listener);
+        commands.push_back(command);
+    }
+    return commands;
+}
+
+} // namespace
+
+// ============================================================================
+// Matching-thread cost of journaling one command (the flusher syncs in the background)
+// ============================================================================
+static void BM_JournalAppend(benchmark::State& state) {
+    const size_t capacity = 1 << 22;
+    std::string path = journalPath("bench_journal_append");
+    {
+        CommandJournal journal(path, capacity);
+        Command command = Command::submit(0, Order{1, 10, 100, Side::Buy});
+        for (auto _ : state) {
+            if (!journal.append(command)) [[unlikely]] {
+                state.SkipWithError("journal segment full");
+                break;
+            }
+            ++command.id;
+        }
+        state.counters["durable_lag"] = static_cast<double>(journal.lastSequence() - journal.durableSequence());
+    }
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_JournalAppend)->Iterations(1 << 21);
+
+// ============================================================================
+// Recovery throughput: mmap a journal and replay it through the engine into an empty book
+// Arg: number of journaled commands
+// ============================================================================
+static void BM_JournalReplay(benchmark::State& state) {
+    const size_t count = state.range(0);
+    std::string path = journalPath("bench_journal_replay");
+    {
+        std::vector<Command> commands = makeFlow(count);
+        CommandJournal journal(path, count);
+        for (const Command& command : commands) {
+            journal.append(command);
+        }
+    }
+
+    auto listener = make_noop_listener();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto book = std::make_unique<OrderBook>(count, 100'000);
+        state.ResumeTiming();
+
+        JournalReader reader(path);
+        uint64_t last = replayJournal(reader, [&](SymbolId) -> OrderBook& { return *book; }, listener);
+        benchmark::DoNotOptimize(last);
+
+        state.PauseTiming();
+        book.reset();
+        state.ResumeTiming();
+    }
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_JournalReplay)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
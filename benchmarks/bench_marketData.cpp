@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "BenchUtils.h"
+#include "src/marketdata/MarketDataBuilder.h"
+
+namespace {
+
+constexpr Price MID = 50'000;
+constexpr size_t QUOTES_PER_SIDE = 10; // one market maker quote per level, 10 levels deep on each side
+
+// Heavy quote churn: every command cancels a resting quote and re-posts it one level away (or at the same price with
+// another size), so each batch touches a handful of levels many times
+struct QuoteChurn {
+    OrderBook book{1 << 16, 100'000};
+    std::vector<OrderId> quotes;
+    std::mt19937_64 rng{17};
+    OrderId next_id = 1;
+
+    template <typename Listener> void seed(Listener& listener) {
+        for (size_t level = 0; level < QUOTES_PER_SIDE; ++level) {
+            for (Side side : {Side::Buy, Side::Sell}) {
+                Price price = side == Side::Buy ? MID - 1 - level : MID + 1 + level;
+                quotes.push_back(next_id);
+                MatchingEngine::submitOrder(Order(next_id++, 100, price, side), book, listener);
+            }
+        }
+    }
+
+    template <typename Listener> void step(Listener& listener) {
+        size_t slot = rng() % quotes.size();
+        Level::RestingOrder* quote = book.find(quotes[slot]);
+        Order requote = quote->order;
+        MatchingEngine::cancelOrder(requote.id, book, listener);
+
+        Price shift = rng() % 3; // 0: same level, else one tick in or out, never crossing
+        if (requote.side == Side::Buy) {
+            requote.price = std::min(MID - 1, std::max(MID - QUOTES_PER_SIDE, requote.price + shift - 1));
+        } else {
+            requote.price = std::max(MID + 1, std::min(MID + QUOTES_PER_SIDE, requote.price + shift - 1));
+        }
+        requote.id = next_id++;
+        requote.quantity = static_cast<Quantity>(50 + rng() % 100);
+        quotes[slot] = requote.id;
+        MatchingEngine::submitOrder(requote, book, listener);
+    }
+};
+
+} // namespace
+
+// ============================================================================
+// Quote churn with conflated L2 publication at the end of each batch
+// Arg: commands per batch. Reported time is per batch (processing + publish)
+// ============================================================================
+static void BM_MarketDataChurn(benchmark::State& state) {
+    const size_t batch_size = state.range(0);
+    QuoteChurn churn;
+    MarketDataBuilder market_data;
+    auto noop = make_noop_listener();
+    MarketDataListener<decltype(noop)> listener{noop, market_data};
+    churn.seed(listener);
+    market_data.publish(churn.book);
+
+    size_t level_updates = 0;
+    for (auto _ : state) {
+        for (size_t i = 0; i < batch_size; ++i) {
+            churn.step(listener);
+        }
+        MarketDataBatch batch = market_data.publish(churn.book);
+        level_updates += batch.levels.size();
+        benchmark::DoNotOptimize(batch);
+    }
+    state.SetItemsProcessed(state.iterations() * batch_size);
+    state.counters["updates_per_batch"] = static_cast<double>(level_updates) / state.iterations();
+}
+BENCHMARK(BM_MarketDataChurn)->Arg(1)->Arg(16)->Arg(64)->Arg(256);
+
+// Same flow without market data: the difference is the whole cost of tracking and publishing
+static void BM_QuoteChurnOnly(benchmark::State& state) {
+    const size_t batch_size = state.range(0);
+    QuoteChurn churn;
+    auto listener = make_noop_listener();
+    churn.seed(listener);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < batch_size; ++i) {
+            churn.step(listener);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batch_size);
+}
+BENCHMARK(BM_QuoteChurnOnly)->Arg(1)->Arg(16)->Arg(64)->Arg(256);
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "BenchUtils.h"
+
+namespace {
+
+constexpr size_t OWNED_ORDERS = 100'000;
+constexpr size_t OTHER_ORDERS = 100'000;
+constexpr OwnerId KILLED_OWNER = 1;
+constexpr Price MAX_PRICE = 100'000;
+constexpr Price MID = 50'000;
+constexpr Price SPREAD_LEVELS = 5'000;
+
+/**
+ * @brief 100k resting orders of one session interleaved with 100k of 63 others, on both sides over 10'000 levels
+ */
+struct KillSwitchBook {
+    std::vector<Order> orders;
+    std::vector<OrderId> killed_ids; // in submission order, what a per-order kill switch would send
+
+    KillSwitchBook() {
+        std::mt19937_64 rng(17);
+        std::vector<OwnerId> owners(OWNED_ORDERS, KILLED_OWNER);
+        for (size_t i = 0; i < OTHER_ORDERS; ++i) {
+            owners.push_back(static_cast<OwnerId>(2 + rng() % 63));
+        }
+        std::shuffle(owners.begin(), owners.end(), rng);
+
+        OrderId next_id = 1;
+        for (OwnerId owner : owners) {
+            Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            Price offset = 1 + rng() % SPREAD_LEVELS;
+            Price price = side == Side::Buy ? MID - offset : MID + offset;
+            orders.emplace_back(next_id, static_cast<Quantity>(1 + rng() % 100), price, side, owner);
+            if (owner == KILLED_OWNER) {
+                killed_ids.push_back(next_id);
+            }
+            ++next_id;
+        }
+    }
+
+    std::unique_ptr<OrderBook> build() const {
+        auto book = std::make_unique<OrderBook>(orders.size(), MAX_PRICE);
+        auto listener = make_noop_listener();
+        for (const Order& order : orders) {
+            MatchingEngine::submitOrder(order, *book, listener);
+        }
+        return book;
+    }
+};
+
+const KillSwitchBook& killSwitchBook() {
+    static const KillSwitchBook book;
+    return book;
+}
+
+template <typename Cancel> void killSession(benchmark::State& state, Cancel&& cancel) {
+    const KillSwitchBook& setup = killSwitchBook();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto book = setup.build();
+        state.ResumeTiming();
+
+        cancel(*book, setup);
+        benchmark::DoNotOptimize(book->bestBid());
+
+        state.PauseTiming();
+        book.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * OWNED_ORDERS);
+}
+
+} // namespace
+
+// ============================================================================
+// Kill switch: remove all 100k resting orders of one session from a 200k order book
+// PerId: one cancelOrder per id (index lookup, unlink, cursor rescan each time)
+// Owner: one massCancel walking the session's owner list, cursors moved once
+// ============================================================================
+static void BM_MassCancel_PerId(benchmark::State& state) {
+    auto listener = make_noop_listener();
+    killSession(state, [&](OrderBook& book, const KillSwitchBook& setup) {
+        for (OrderId id : setup.killed_ids) {
+            MatchingEngine::cancelOrder(id, book, listener);
+        }
+    });
+}
+BENCHMARK(BM_MassCancel_PerId)->Unit(benchmark::kMillisecond);
+
+static void BM_MassCancel_Owner(benchmark::State& state) {
+    auto listener = make_noop_listener();
+    killSession(state, [&](OrderBook& book, const KillSwitchBook&) {
+        benchmark::DoNotOptimize(MatchingEngine::massCancel(KILLED_OWNER, book, listener));
+    });
+}
+BENCHMARK(BM_MassCancel_Owner)->Unit(benchmark::kMillisecond);
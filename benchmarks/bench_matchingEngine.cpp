@@ -1,14 +1,13 @@
 #include <benchmark/benchmark.h>
+#include <algorithm>
 #include <memory>
+#include <random>
 #include <vector>
 
-#include "src/engines/MatchingEngine.h" 
+#include "BenchUtils.h"
+#include "src/engines/MatchingEngine.h"
 #include "src/orderbook/OrderBook.h"
 
-auto make_noop_listener() {
-    return MatchingEngineListener{[](OrderId, OrderId, Price, Quantity) {}, [](const Order&) {}, [](OrderId) {}};
-}
-
 // ============================================================================
 // BENCHMARK 1: Add Resting Orders
 // ============================================================================
@@ -83,4 +82,59 @@ static void BM_CancelOrder(benchmark::State& state) {
 }
 BENCHMARK(BM_CancelOrder)->Arg(2000000)->Iterations(2000000);
 
+// ============================================================================
+// BENCHMARK 4: Cancel Orders by Handle vs by Id
+// The same cancels through the handles reported by onOrderAdded (two indexed loads, no id lookup), in submission
+// order and then in random order for both paths, where the id index misses the cache as well
+// ============================================================================
+static void BM_CancelOrderByHandle(benchmark::State& state) {
+    const size_t N = state.range(0);
+    OrderBook book(N, 10000);
+    MatchingEngine engine;
+    std::vector<OrderHandle> handles;
+    handles.reserve(N);
+    auto listener = MatchingEngineListener{[](OrderId, OrderId, Price, Quantity) {},
+                                           [&](const Order&, OrderHandle handle) { handles.push_back(handle); },
+                                           [](OrderId) {}, [](const Order&) {}};
+
+    for (OrderId i = 1; i <= N; ++i) {
+        engine.submitOrder(Order{i, 100, 5000, Side::Sell}, book, listener);
+    }
+
+    size_t idx = 0;
+    for (auto _ : state) {
+        engine.cancelOrder(handles[idx++], book, listener);
+    }
+}
+BENCHMARK(BM_CancelOrderByHandle)->Arg(2000000)->Iterations(2000000);
+
+template <bool ByHandle> static void BM_CancelOrderShuffled(benchmark::State& state) {
+    const size_t N = state.range(0);
+    OrderBook book(N, 10000);
+    std::vector<std::pair<OrderId, OrderHandle>> targets;
+    targets.reserve(N);
+    auto listener = MatchingEngineListener{[](OrderId, OrderId, Price, Quantity) {},
+                                           [&](const Order& order, OrderHandle handle) {
+                                               targets.emplace_back(order.id, handle);
+                                           },
+                                           [](OrderId) {}, [](const Order&) {}};
+
+    std::mt19937_64 rng(N);
+    for (OrderId i = 1; i <= N; ++i) {
+        MatchingEngine::submitOrder(Order{i, 100, 5000 + rng() % 1000, Side::Sell}, book, listener);
+    }
+    std::shuffle(targets.begin(), targets.end(), rng);
+
+    size_t idx = 0;
+    for (auto _ : state) {
+        if constexpr (ByHandle) {
+            MatchingEngine::cancelOrder(targets[idx++].second, book, listener);
+        } else {
+            MatchingEngine::cancelOrder(targets[idx++].first, book, listener);
+        }
+    }
+}
+BENCHMARK(BM_CancelOrderShuffled<false>)->Name("BM_CancelOrderShuffled/ById")->Arg(2000000)->Iterations(2000000);
+BENCHMARK(BM_CancelOrderShuffled<true>)->Name("BM_CancelOrderShuffled/ByHandle")->Arg(2000000)->Iterations(2000000);
+
 BENCHMARK_MAIN();
\ No newline at end of file
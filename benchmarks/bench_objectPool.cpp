@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "src/orderbook/Level.h"
+
+using RestingOrder = Level::RestingOrder;
+
+// Random slot order, generated up front so the RNG stays out of the measured loop
+static std::vector<size_t> churnPattern(size_t live, size_t count) {
+    std::mt19937_64 rng(42);
+    std::vector<size_t> pattern(count);
+    for (auto& slot : pattern) {
+        slot = rng() % live;
+    }
+    return pattern;
+}
+
+// ============================================================================
+// Allocation churn: `live` objects outstanding, free a random one, allocate a replacement
+// ============================================================================
+static void BM_PoolChurn(benchmark::State& state) {
+    const size_t live = state.range(0);
+    ObjectPool<RestingOrder> pool(live);
+    std::vector<RestingOrder*> objects(live);
+    for (auto& object : objects) {
+        object = pool.allocate();
+    }
+    auto pattern = churnPattern(live, 1 << 20);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        size_t slot = pattern[i++ & (pattern.size() - 1)];
+        pool.deallocate(objects[slot]);
+        objects[slot] = pool.allocate();
+        objects[slot]->order.quantity = 1;
+    }
+}
+BENCHMARK(BM_PoolChurn)->Arg(1024)->Arg(1 << 20);
+
+static void BM_HeapChurn(benchmark::State& state) {
+    const size_t live = state.range(0);
+    std::vector<RestingOrder*> objects(live);
+    for (auto& object : objects) {
+        object = new RestingOrder;
+    }
+    auto pattern = churnPattern(live, 1 << 20);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        size_t slot = pattern[i++ & (pattern.size() - 1)];
+        delete objects[slot];
+        objects[slot] = new RestingOrder;
+        objects[slot]->order.quantity = 1;
+    }
+    for (auto* object : objects) {
+        delete object;
+    }
+}
+BENCHMARK(BM_HeapChurn)->Arg(1024)->Arg(1 << 20);
+
+// ============================================================================
+// Burst fill of an empty pool: fully committed up front vs committed chunk by chunk on demand
+// ============================================================================
+static void BM_PoolBurst(benchmark::State& state) {
+    const size_t burst = 1 << 20;
+    PoolOptions options;
+    options.initial_capacity = state.range(0) ? SIZE_MAX : 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto pool = std::make_unique<ObjectPool<RestingOrder>>(burst, options);
+        state.ResumeTiming();
+        for (size_t i = 0; i < burst; ++i) {
+            benchmark::DoNotOptimize(pool->allocate());
+        }
+        state.PauseTiming();
+        pool.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * burst);
+}
+BENCHMARK(BM_PoolBurst)->ArgName("precommitted")->Arg(1)->Arg(0)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,145 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchUtils.h"
+
+namespace {
+
+constexpr Price BEST_ASK = 5'000;
+constexpr Quantity LEVEL_QUANTITY = 10;
+
+/**
+ * @brief Asks of 10 at `levels` consecutive ticks from 5000, one order each; ids from 1 upwards
+ */
+void seedAsks(OrderBook& book, auto& listener, Price levels) {
+    for (Price i = 0; i < levels; ++i) {
+        MatchingEngine::submitOrder(Order{static_cast<OrderId>(i + 1), LEVEL_QUANTITY, BEST_ASK + i, Side::Sell}, book,
+                                    listener);
+    }
+}
+
+/**
+ * @brief Puts back the three levels an aggressor swept, so every iteration meets the same book
+ */
+void refill(OrderBook& book, auto& listener, OrderId& next_id) {
+    for (Price i = 0; i < 3; ++i) {
+        MatchingEngine::submitOrder(Order{next_id++, LEVEL_QUANTITY, BEST_ASK + i, Side::Sell}, book, listener);
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// Buy 35 up to 5002 against 10 at each tick: 30 fills over three levels, the remaining 5 must not rest
+// Native: submitOrder<ImmediateOrCancel> expires it in the same call
+// Emulated: a limit order that rests, then a cancel (what a client without IOC does)
+// Both refill the three levels, so the difference is the rest + cancel round trip
+// ============================================================================
+static void BM_ImmediateOrCancel_Native(benchmark::State& state) {
+    OrderBook book(1'000, 10'000);
+    auto listener = make_noop_listener();
+    seedAsks(book, listener, 10);
+    OrderId next_id = 100;
+    for (auto _ : state) {
+        MatchingEngine::submitOrder<OrderType::ImmediateOrCancel>(Order{next_id++, 35, BEST_ASK + 2, Side::Buy}, book,
+                                                                  listener);
+        refill(book, listener, next_id);
+    }
+}
+BENCHMARK(BM_ImmediateOrCancel_Native);
+
+static void BM_ImmediateOrCancel_Emulated(benchmark::State& state) {
+    OrderBook book(1'000, 10'000);
+    auto listener = make_noop_listener();
+    seedAsks(book, listener, 10);
+    OrderId next_id = 100;
+    for (auto _ : state) {
+        OrderId id = next_id++;
+        MatchingEngine::submitOrder(Order{id, 35, BEST_ASK + 2, Side::Buy}, book, listener);
+        MatchingEngine::cancelOrder(id, book, listener);
+        refill(book, listener, next_id);
+    }
+}
+BENCHMARK(BM_ImmediateOrCancel_Emulated);
+
+// ============================================================================
+// Fill-or-kill that fills (30 over three levels, refilled) and one that is killed: one unit more than the
+// `range(0)` levels in its limit hold. The kill only sums level quantities and leaves the book untouched
+// ============================================================================
+static void BM_FillOrKill_Filled(benchmark::State& state) {
+    OrderBook book(1'000, 10'000);
+    auto listener = make_noop_listener();
+    seedAsks(book, listener, 10);
+    OrderId next_id = 100;
+    for (auto _ : state) {
+        MatchingEngine::submitOrder<OrderType::FillOrKill>(Order{next_id++, 30, BEST_ASK + 2, Side::Buy}, book,
+                                                           listener);
+        refill(book, listener, next_id);
+    }
+}
+BENCHMARK(BM_FillOrKill_Filled);
+
+static void BM_FillOrKill_Killed(benchmark::State& state) {
+    const Price levels = state.range(0);
+    OrderBook book(1'000, 10'000);
+    auto listener = make_noop_listener();
+    seedAsks(book, listener, levels);
+    Order order{1'000, static_cast<Quantity>(levels * LEVEL_QUANTITY + 1), BEST_ASK + levels - 1, Side::Buy};
+    for (auto _ : state) {
+        MatchingEngine::submitOrder<OrderType::FillOrKill>(order, book, listener);
+    }
+}
+BENCHMARK(BM_FillOrKill_Killed)->Arg(1)->Arg(10)->Arg(100);
+
+// ============================================================================
+// Market buy of 30: sweeps the same three levels as the limit order it is compared with
+// ============================================================================
+static void BM_Market(benchmark::State& state) {
+    OrderBook book(1'000, 10'000);
+    auto listener = make_noop_listener();
+    seedAsks(book, listener, 10);
+    OrderId next_id = 100;
+    for (auto _ : state) {
+        MatchingEngine::submitOrder<OrderType::Market>(Order{next_id++, 30, 0, Side::Buy}, book, listener);
+        refill(book, listener, next_id);
+    }
+}
+BENCHMARK(BM_Market);
+
+static void BM_Limit_Sweep(benchmark::State& state) {
+    OrderBook book(1'000, 10'000);
+    auto listener = make_noop_listener();
+    seedAsks(book, listener, 10);
+    OrderId next_id = 100;
+    for (auto _ : state) {
+        MatchingEngine::submitOrder(Order{next_id++, 30, BEST_ASK + 2, Side::Buy}, book, listener);
+        refill(book, listener, next_id);
+    }
+}
+BENCHMARK(BM_Limit_Sweep);
+
+// ============================================================================
+// Post-only: a bid below the best ask rests (and is canceled again); one at the best ask is rejected
+// ============================================================================
+static void BM_PostOnly_Rests(benchmark::State& state) {
+    OrderBook book(1'000, 10'000);
+    auto listener = make_noop_listener();
+    seedAsks(book, listener, 10);
+    OrderId next_id = 100;
+    for (auto _ : state) {
+        OrderId id = next_id++;
+        MatchingEngine::submitOrder<OrderType::PostOnly>(Order{id, 5, BEST_ASK - 1, Side::Buy}, book, listener);
+        MatchingEngine::cancelOrder(id, book, listener);
+    }
+}
+BENCHMARK(BM_PostOnly_Rests);
+
+static void BM_PostOnly_Rejected(benchmark::State& state) {
+    OrderBook book(1'000, 10'000);
+    auto listener = make_noop_listener();
+    seedAsks(book, listener, 10);
+    Order order{1'000, 5, BEST_ASK, Side::Buy};
+    for (auto _ : state) {
+        MatchingEngine::submitOrder<OrderType::PostOnly>(order, book, listener);
+    }
+}
+BENCHMARK(BM_PostOnly_Rejected);
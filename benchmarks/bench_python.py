@@ -0,0 +1,93 @@
+"""Batch vs per-call throughput of the matching_engine Python bindings.
+
+Build the module (the `matching_engine` target, needs pybind11) and run with it on the path:
+
+    PYTHONPATH=build/Release/src python3 benchmarks/bench_python.py [commands]
+
+The same random flow (submits around a drifting mid, cancels and modifies of live orders) is run once as a single
+command_dtype array through Session.process and once command by command through submit/cancel/modify.
+"""
+
+import sys
+import time
+
+import numpy as np
+
+import matching_engine as me
+
+MAX_PRICE = 100_000
+MID = 50_000
+
+
+def generate(count, seed=7):
+    rng = np.random.default_rng(seed)
+    commands = np.zeros(count, dtype=me.command_dtype)
+    kind = rng.random(count)
+    next_id = 1
+    live = []
+    for i in range(count):
+        command = commands[i]
+        if kind[i] < 0.25 and live:
+            command["type"] = int(me.CommandType.Cancel)
+            command["id"] = live.pop(int(rng.integers(len(live))))
+        elif kind[i] < 0.35 and live:
+            command["type"] = int(me.CommandType.Modify)
+            command["id"] = live[int(rng.integers(len(live)))]
+            command["price"] = MID + int(rng.integers(-50, 50))
+            command["quantity"] = int(rng.integers(1, 100))
+        else:
+            side = int(rng.integers(2))
+            command["type"] = int(me.CommandType.Submit)
+            command["id"] = next_id
+            command["side"] = side
+            # mostly passive, some marketable
+            offset = int(rng.integers(-5, 50))
+            command["price"] = MID - offset if side == int(me.Side.Buy) else MID + offset
+            command["quantity"] = int(rng.integers(1, 100))
+            live.append(next_id)
+            next_id += 1
+    return commands
+
+
+def run_batch(commands):
+    session = me.Session(capacity=len(commands) + 1, max_price=MAX_PRICE)
+    start = time.perf_counter()
+    trades, events = session.process(commands)
+    elapsed = time.perf_counter() - start
+    return elapsed, len(trades)
+
+
+def run_per_call(commands):
+    session = me.Session(capacity=len(commands) + 1, max_price=MAX_PRICE)
+    sides = (me.Side.Buy, me.Side.Sell)
+    rows = commands.tolist()  # plain tuples, so the loop measures the bindings rather than NumPy scalar access
+    submit, cancel, modify = session.submit, session.cancel, session.modify
+    trades = 0
+    start = time.perf_counter()
+    for order_id, price, quantity, _symbol, kind, side in rows:
+        if kind == 0:
+            trades += len(submit(order_id, quantity, price, sides[side]))
+        elif kind == 1:
+            cancel(order_id)
+        else:
+            trades += len(modify(order_id, price, quantity))
+    elapsed = time.perf_counter() - start
+    return elapsed, trades
+
+
+def main():
+    count = int(sys.argv[1]) if len(sys.argv) > 1 else 1_000_000
+    commands = generate(count)
+
+    batch_time, batch_trades = run_batch(commands)
+    call_time, call_trades = run_per_call(commands)
+    assert batch_trades == call_trades, (batch_trades, call_trades)
+
+    print(f"{count} commands, {batch_trades} trades")
+    print(f"batch    : {batch_time * 1e3:9.1f} ms  {count / batch_time / 1e6:7.2f} M cmd/s")
+    print(f"per-call : {call_time * 1e3:9.1f} ms  {count / call_time / 1e6:7.2f} M cmd/s")
+    print(f"speedup  : {call_time / batch_time:9.1f}x")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,158 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "src/domain/Command.h"
+#include "src/infrastructure/LockFreeQueue.h"
+#include "src/infrastructure/MpscQueue.h"
+#include "src/infrastructure/Thread.h"
+
+namespace {
+
+constexpr int PRODUCER_CORE = 0;
+constexpr int CONSUMER_CORE = 1;
+
+// spin, but let an oversubscribed machine schedule the other side now and then
+struct Backoff {
+    unsigned spins = 0;
+    void operator()() {
+        if (++spins % 1024 == 0) {
+            std::this_thread::yield();
+        } else {
+            cpuRelax();
+        }
+    }
+};
+
+} // namespace
+
+// ============================================================================
+// Ping-pong: one item goes to the other core and comes back, time = round trip
+// ============================================================================
+static void BM_QueuePingPong(benchmark::State& state) {
+    LockFreeQueue<uint64_t> ping(1024), pong(1024);
+    std::atomic<bool> done{false};
+
+    std::thread echo([&] {
+        pinCurrentThread(CONSUMER_CORE);
+        uint64_t item;
+        Backoff backoff;
+        while (!done.load(std::memory_order_relaxed)) {
+            if (ping.pop(item)) {
+                while (!pong.push(item)) {
+                    backoff();
+                }
+            } else {
+                backoff();
+            }
+        }
+    });
+    pinCurrentThread(PRODUCER_CORE);
+
+    uint64_t sequence = 0;
+    Backoff backoff;
+    for (auto _ : state) {
+        while (!ping.push(sequence)) {
+            backoff();
+        }
+        uint64_t item;
+        while (!pong.pop(item)) {
+            backoff();
+        }
+        benchmark::DoNotOptimize(item);
+        ++sequence;
+    }
+    done.store(true);
+    echo.join();
+}
+BENCHMARK(BM_QueuePingPong)->UseRealTime();
+
+// ============================================================================
+// Throughput: stream of 32-byte commands to the other core, pushed and popped in batches of `batch` (1 = push/pop)
+// ============================================================================
+static void BM_QueueThroughput(benchmark::State& state) {
+    const size_t batch = state.range(0);
+    const uint64_t count = 1 << 22;
+    LockFreeQueue<Command> queue(4096);
+    std::vector<Command> input(batch, Command::cancel(0, 1));
+
+    for (auto _ : state) {
+        std::thread consumer([&] {
+            pinCurrentThread(CONSUMER_CORE);
+            std::vector<Command> output(batch);
+            Backoff backoff;
+            for (uint64_t received = 0; received < count;) {
+                size_t popped;
+                if (batch == 1) {
+                    popped = queue.pop(output[0]) ? 1 : 0;
+                } else {
+                    popped = queue.popBatch(output);
+                }
+                received += popped;
+                if (popped == 0) {
+                    backoff();
+                }
+            }
+        });
+        pinCurrentThread(PRODUCER_CORE);
+
+        Backoff backoff;
+        for (uint64_t sent = 0; sent < count;) {
+            size_t pushed;
+            if (batch == 1) {
+                pushed = queue.push(input[0]) ? 1 : 0;
+            } else {
+                size_t chunk = std::min<uint64_t>(batch, count - sent);
+                pushed = queue.pushBatch(std::span<const Command>(input).first(chunk));
+            }
+            sent += pushed;
+            if (pushed == 0) {
+                backoff();
+            }
+        }
+        consumer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_QueueThroughput)->Arg(1)->Arg(16)->Arg(128)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// ============================================================================
+// MPSC: `producers` gateway threads feeding one consumer
+// ============================================================================
+static void BM_MpscThroughput(benchmark::State& state) {
+    const size_t producers = state.range(0);
+    const uint64_t per_producer = (1 << 22) / producers;
+    MpscQueue<Command> queue(4096);
+
+    for (auto _ : state) {
+        std::vector<std::thread> threads;
+        for (size_t p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                pinCurrentThread(static_cast<int>(CONSUMER_CORE + 1 + p));
+                Command command = Command::cancel(0, p);
+                Backoff backoff;
+                for (uint64_t i = 0; i < per_producer; ++i) {
+                    while (!queue.push(command)) {
+                        backoff();
+                    }
+                }
+            });
+        }
+        pinCurrentThread(CONSUMER_CORE);
+
+        Backoff backoff;
+        for (uint64_t received = 0; received < per_producer * producers;) {
+            size_t popped = queue.consumeBatch([](Command& command) { benchmark::DoNotOptimize(command); }, 64);
+            received += popped;
+            if (popped == 0) {
+                backoff();
+            }
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * per_producer * producers);
+}
+BENCHMARK(BM_MpscThroughput)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <memory>
+
+#include "BenchUtils.h"
+#include "src/metrics/LatencyHistogram.h"
+#include "src/metrics/TscClock.h"
+#include "src/reporting/ExecutionReports.h"
+#include "src/workload/WorkloadGenerator.h"
+
+// Execution report handling inline on the matching thread vs through ExecutionReportPipeline, with a report handler
+// of increasing cost (0, 1 or 4 text formattings per record). Both time the matching thread only: items/s from its
+// CPU time, p50/p99/p99.9 from rdtsc around each command (including the pipeline's per-command flush). The ring holds
+// the whole flow's reports, so a consumer sharing the core (or slower than matching) never blocks it.
+
+namespace {
+
+constexpr size_t FLOW_COMMANDS = 200'000;
+constexpr size_t RING_CAPACITY = 1 << 19;
+
+const WorkloadStream& reportStream() {
+    static const WorkloadStream stream = WorkloadGenerator(profiles::quoteChurn()).generate(FLOW_COMMANDS);
+    return stream;
+}
+
+/**
+ * @brief Stand-in for what report consumers do: render each record as text `formats` times
+ */
+struct FormattingHandler {
+    int formats;
+    uint64_t bytes = 0;
+
+    void operator()(const ExecutionReport& report) {
+        char line[128];
+        for (int i = 0; i < formats; ++i) {
+            bytes += std::snprintf(line, sizeof(line), "%llu %u id=%llu rest=%llu px=%llu qty=%u",
+                                   static_cast<unsigned long long>(report.sequence), static_cast<unsigned>(report.type),
+                                   static_cast<unsigned long long>(report.id),
+                                   static_cast<unsigned long long>(report.resting_id),
+                                   static_cast<unsigned long long>(report.price), report.quantity);
+        }
+        benchmark::DoNotOptimize(bytes);
+    }
+};
+
+/**
+ * @brief The historical way: the handler runs inside the engine callbacks
+ */
+struct InlineReportingListener {
+    FormattingHandler handler;
+    uint64_t sequence = 0;
+
+    void report(ReportType type, OrderId id, OrderId resting_id, Price price, Quantity quantity, Side side) {
+        handler({++sequence, id, resting_id, price, quantity, type, side, RejectReason{}});
+    }
+    void onTrade(OrderId incoming_id, OrderId resting_id, Price price, Quantity quantity) {
+        report(ReportType::Trade, incoming_id, resting_id, price, quantity, Side::Buy);
+    }
+    void onOrderAdded(const Order& order) {
+        report(ReportType::Added, order.id, 0, order.price, order.quantity, order.side);
+    }
+    void onOrderCanceled(OrderId id) { report(ReportType::Canceled, id, 0, 0, 0, Side::Buy); }
+    void onOrderModified(const Order& order) {
+        report(ReportType::Modified, order.id, 0, order.price, order.quantity, order.side);
+    }
+    void flush() {}
+};
+
+template <typename Listener, typename AfterIteration>
+void replayTimed(benchmark::State& state, Listener& listener, AfterIteration&& after_iteration) {
+    static const TscClock clock = TscClock::calibrate();
+    const WorkloadStream& stream = reportStream();
+    auto setup_listener = make_noop_listener();
+    LatencyHistogram latency;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto book = std::make_unique<OrderBook>(stream.peak_resting_orders + 1, stream.max_price);
+        for (const Command& command : stream.setup) {
+            MatchingEngine::process(command, *book, setup_listener);
+        }
+        state.ResumeTiming();
+
+        for (const Command& command : stream.flow) {
+            uint64_t start = clock.start();
+            MatchingEngine::process(command, *book, listener);
+            listener.flush();
+            latency.record(clock.stop() - start);
+        }
+
+        state.PauseTiming();
+        after_iteration();
+        book.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * stream.flow.size());
+    state.counters["p50_ns"] = clock.nanos(latency.percentile(50));
+    state.counters["p99_ns"] = clock.nanos(latency.percentile(99));
+    state.counters["p99.9_ns"] = clock.nanos(latency.percentile(99.9));
+}
+
+} // namespace
+
+static void BM_Reports_Inline(benchmark::State& state) {
+    InlineReportingListener listener{FormattingHandler{static_cast<int>(state.range(0))}};
+    replayTimed(state, listener, [] {});
+    state.counters["reports"] = static_cast<double>(listener.sequence);
+}
+BENCHMARK(BM_Reports_Inline)->Arg(0)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
+
+static void BM_Reports_Pipeline(benchmark::State& state) {
+    ExecutionReportPipeline pipeline(RING_CAPACITY, FormattingHandler{static_cast<int>(state.range(0))});
+    pipeline.start();
+    ReportingListener& listener = pipeline.listener();
+    replayTimed(state, listener, [&] { pipeline.waitUntilDrained(); });
+    pipeline.stop();
+    state.counters["reports"] = static_cast<double>(listener.lastSequence());
+    state.counters["stalls"] = static_cast<double>(listener.stallCount());
+}
+BENCHMARK(BM_Reports_Pipeline)->Arg(0)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "src/engines/ShardedEngine.h"
+
+namespace {
+
+struct NoopListener {
+    void onTrade(OrderId, OrderId, Price, Quantity) {}
+    void onOrderAdded(const Order&) {}
+    void onOrderCanceled(OrderId) {}
+    void onOrderModified(const Order&) {}
+};
+
+// Per symbol, a stationary cycle: rest a sell, cross it with a buy, rest another sell, cancel it
+std::vector<Command> makeMultiSymbolFlow(SymbolId symbols, size_t count) {
+    std::vector<Command> commands;
+    commands.reserve(count);
+    OrderId id = 1;
+    while (commands.size() < count) {
+        for (SymbolId symbol = 0; symbol < symbols; ++symbol) {
+            commands.push_back(Command::submit(symbol, Order{id++, 10, 5000, Side::Sell}));
+            commands.push_back(Command::submit(symbol, Order{id++, 10, 5000, Side::Buy}));
+            commands.push_back(Command::submit(symbol, Order{id, 10, 5001, Side::Sell}));
+            commands.push_back(Command::cancel(symbol, id++));
+        }
+    }
+    commands.resize(count);
+    return commands;
+}
+
+} // namespace
+
+// ============================================================================
+// Throughput of the sharded runtime, 1..N worker cores, ingress on core 0
+// ============================================================================
+static void BM_ShardedThroughput(benchmark::State& state) {
+    const size_t shard_count = state.range(0);
+    const SymbolId symbols = 256;
+    auto commands = makeMultiSymbolFlow(symbols, 1 << 20);
+
+    std::vector<int> cores;
+    for (size_t i = 0; i < shard_count; ++i) {
+        cores.push_back(static_cast<int>(1 + i % std::max(1u, std::thread::hardware_concurrency() - 1)));
+    }
+    pinCurrentThread(0);
+
+    ShardedEngine<NoopListener> engine(
+        shard_count, symbols, [](SymbolId) { return std::make_unique<OrderBook>(1024, 10000); },
+        [](size_t) { return NoopListener{}; }, cores);
+    engine.start();
+
+    for (auto _ : state) {
+        for (const Command& command : commands) {
+            engine.submit(command);
+        }
+        engine.waitUntilDrained();
+    }
+    engine.stop();
+    state.SetItemsProcessed(state.iterations() * commands.size());
+    state.counters["cores"] = static_cast<double>(std::thread::hardware_concurrency());
+}
+BENCHMARK(BM_ShardedThroughput)->RangeMultiplier(2)->Range(1, 8)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "BenchUtils.h"
+#include "src/persistence/Snapshot.h"
+
+namespace {
+
+constexpr Price MAX_PRICE = 100'000;
+constexpr Price MID = 50'000;
+
+std::string snapshotPath() {
+    return (std::filesystem::temp_directory_path() / ("bench_snapshot_" + std::to_string(::getpid()) + ".snap"))
+        .string();
+}
+
+// non-crossing resting orders spread over 2000 levels per side
+std::vector<Order> makeRestingOrders(size_t count) {
+    std::mt19937_64 rng(11);
+    std::vector<Order> orders;
+    orders.reserve(count);
+    for (OrderId id = 1; id <= count; ++id) {
+        Side side = id % 2 ? Side::Buy : Side::Sell;
+        Price offset = 1 + rng() % 2000;
+        orders.emplace_back(id, static_cast<Quantity>(1 + rng() % 100), side == Side::Buy ? MID - offset : MID + offset,
+                            side);
+    }
+    return orders;
+}
+
+// the history a journal would hold for that book: every live order plus two orders added and cancelled around it
+std::vector<Command> makeHistory(const std::vector<Order>& orders) {
+    std::vector<Command> commands;
+    commands.reserve(orders.size() * 5);
+    OrderId transient_id = orders.size() + 1;
+    for (const Order& order : orders) {
+        commands.push_back(Command::submit(0, order));
+        for (int i = 0; i < 2; ++i) {
+            Order transient(transient_id++, order.quantity, order.price, order.side);
+            commands.push_back(Command::submit(0, transient));
+            commands.push_back(Command::cancel(0, transient.id));
+        }
+    }
+    return commands;
+}
+
+std::unique_ptr<OrderBook> buildBook(const std::vector<Order>& orders) {
+    auto book = std::make_unique<OrderBook>(orders.size(), MAX_PRICE);
+    auto listener = make_noop_listener();
+    for (const Order& order : orders) {
+        MatchingEngine::submitOrder(order, *book, listener);
+    }
+    return book;
+}
+
+} // namespace
+
+// ============================================================================
+// Warm start: write a snapshot and restore it, against rebuilding the book through the matching path, either from
+// its live orders only (lower bound) or from a journal-like history with two added-then-cancelled orders per live one
+// Arg: number of resting orders
+// ============================================================================
+static void BM_SnapshotWrite(benchmark::State& state) {
+    const size_t count = state.range(0);
+    auto book = buildBook(makeRestingOrders(count));
+    std::string path = snapshotPath();
+    for (auto _ : state) {
+        writeSnapshot(*book, path);
+    }
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_SnapshotWrite)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMillisecond);
+
+static void BM_SnapshotRestore(benchmark::State& state) {
+    const size_t count = state.range(0);
+    std::string path = snapshotPath();
+    writeSnapshot(*buildBook(makeRestingOrders(count)), path);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto book = std::make_unique<OrderBook>(count, MAX_PRICE);
+        state.ResumeTiming();
+
+        restoreSnapshot(path, *book);
+        benchmark::DoNotOptimize(book->bestBid());
+
+        state.PauseTiming();
+        book.reset();
+        state.ResumeTiming();
+    }
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_SnapshotRestore)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMillisecond);
+
+static void BM_RebuildBySubmit(benchmark::State& state) {
+    const size_t count = state.range(0);
+    std::vector<Order> orders = makeRestingOrders(count);
+    auto listener = make_noop_listener();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto book = std::make_unique<OrderBook>(count, MAX_PRICE);
+        state.ResumeTiming();
+
+        for (const Order& order : orders) {
+            MatchingEngine::submitOrder(order, *book, listener);
+        }
+        benchmark::DoNotOptimize(book->bestBid());
+
+        state.PauseTiming();
+        book.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_RebuildBySubmit)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMillisecond);
+
+static void BM_RebuildByReplay(benchmark::State& state) {
+    const size_t count = state.range(0);
+    std::vector<Command> history = makeHistory(makeRestingOrders(count));
+    auto listener = make_noop_listener();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto book = std::make_unique<OrderBook>(count * 3, MAX_PRICE);
+        state.ResumeTiming();
+
+        for (const Command& command : history) {
+            MatchingEngine::process(command, *book, listener);
+        }
+        benchmark::DoNotOptimize(book->bestBid());
+
+        state.PauseTiming();
+        book.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_RebuildByReplay)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMillisecond);
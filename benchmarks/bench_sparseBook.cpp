@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchUtils.h"
+#include "src/engines/MatchingEngine.h"
+#include "src/orderbook/OrderBook.h"
+
+// Thin books: `depth` levels per side, `gap` ticks apart, the spread is `gap` ticks wide.
+// Every iteration empties the top of book, so the best-price cursor has to jump `gap` empty ticks.
+static constexpr Price SPARSE_MAX_PRICE = 1 << 21;
+static constexpr Price SPARSE_MID = SPARSE_MAX_PRICE / 2;
+
+static void seedSparseBook(OrderBook& book, Price gap, size_t depth, OrderId& next_id) {
+    auto listener = make_noop_listener();
+    for (size_t i = 0; i < depth; ++i) {
+        MatchingEngine::submitOrder(Order{next_id++, 10, SPARSE_MID + i * gap, Side::Sell}, book, listener);
+        MatchingEngine::submitOrder(Order{next_id++, 10, SPARSE_MID - (i + 1) * gap, Side::Buy}, book, listener);
+    }
+}
+
+// ============================================================================
+// Fill the best ask, cursor jumps to the next ask level, refill it
+// ============================================================================
+static void BM_SparseBook_FillTopLevel(benchmark::State& state) {
+    const Price gap = state.range(0);
+    const size_t depth = state.range(1);
+    OrderBook book(2 * depth + 16, SPARSE_MAX_PRICE);
+    auto listener = make_noop_listener();
+    OrderId next_id = 1;
+    seedSparseBook(book, gap, depth, next_id);
+
+    for (auto _ : state) {
+        MatchingEngine::submitOrder(Order{next_id++, 10, SPARSE_MID, Side::Buy}, book, listener);
+        MatchingEngine::submitOrder(Order{next_id++, 10, SPARSE_MID, Side::Sell}, book, listener);
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_SparseBook_FillTopLevel)->ArgsProduct({{1, 64, 4096, 65536}, {1, 16}});
+
+// ============================================================================
+// Cancel the best bid, cursor jumps to the next bid level, re-add it
+// ============================================================================
+static void BM_SparseBook_CancelTopLevel(benchmark::State& state) {
+    const Price gap = state.range(0);
+    const size_t depth = state.range(1);
+    OrderBook book(2 * depth + 16, SPARSE_MAX_PRICE);
+    auto listener = make_noop_listener();
+    OrderId next_id = 1;
+    seedSparseBook(book, gap, depth, next_id);
+
+    OrderId top_bid = 2; // second order submitted by seedSparseBook
+    for (auto _ : state) {
+        MatchingEngine::cancelOrder(top_bid, book, listener);
+        top_bid = next_id++;
+        MatchingEngine::submitOrder(Order{top_bid, 10, SPARSE_MID - gap, Side::Buy}, book, listener);
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_SparseBook_CancelTopLevel)->ArgsProduct({{1, 64, 4096, 65536}, {1, 16}});
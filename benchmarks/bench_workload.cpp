@@ -0,0 +1,178 @@
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <span>
+#include <string>
+
+#include "BenchUtils.h"
+#include "src/metrics/LatencyRecorder.h"
+#include "src/workload/WorkloadGenerator.h"
+
+// Replays generated order flow through the engine, one benchmark per named market profile.
+// BM_WorkloadLatency times every command on its own and prints a percentile table per profile.
+// BM_WorkloadProbed runs the CycleProbe-instrumented engine and reports cycles per hot-path phase.
+// WORKLOAD_STREAM=<file> additionally replays a stream saved with WorkloadStream::save().
+
+namespace {
+
+constexpr size_t FLOW_COMMANDS = 1'000'000;
+constexpr size_t BATCH_SIZE = 32;
+
+// streams are generated on first use, so filtered-out profiles cost nothing
+const WorkloadStream& streamFor(const WorkloadProfile& profile) {
+    static std::map<std::string, std::unique_ptr<WorkloadStream>> cache;
+    auto& stream = cache[profile.name];
+    if (!stream) {
+        stream = std::make_unique<WorkloadStream>(WorkloadGenerator(profile).generate(FLOW_COMMANDS));
+    }
+    return *stream;
+}
+
+const WorkloadStream& fileStream(const std::string& path) {
+    static std::unique_ptr<WorkloadStream> stream;
+    if (!stream) {
+        stream = std::make_unique<WorkloadStream>(WorkloadStream::load(path));
+    }
+    return *stream;
+}
+
+/**
+ * @brief Times the flow part of a stream; the book is rebuilt from the setup part before every iteration
+ */
+template <typename Engine = MatchingEngine>
+void replay(benchmark::State& state, const WorkloadStream& stream, size_t batch_size) {
+    uint64_t trades = 0;
+    auto listener = MatchingEngineListener{[&](OrderId, OrderId, Price, Quantity) { ++trades; },
+                                           [](const Order&) {}, [](OrderId) {}, [](const Order&) {}};
+    auto setup_listener = make_noop_listener();
+    std::span<const Command> flow(stream.flow);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto book = std::make_unique<OrderBook>(stream.peak_resting_orders + 1, stream.max_price);
+        for (const Command& command : stream.setup) {
+            MatchingEngine::process(command, *book, setup_listener);
+        }
+        state.ResumeTiming();
+
+        if (batch_size <= 1) {
+            for (const Command& command : flow) {
+                Engine::process(command, *book, listener);
+            }
+        } else {
+            for (size_t offset = 0; offset < flow.size(); offset += batch_size) {
+                Engine::processBatch(flow.subspan(offset, std::min(batch_size, flow.size() - offset)), *book,
+                                             listener);
+            }
+        }
+        benchmark::DoNotOptimize(book->bestBid());
+
+        state.PauseTiming();
+        book.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * flow.size());
+    state.counters["trades_per_1k"] = 1000.0 * static_cast<double>(trades) / (state.iterations() * flow.size());
+    state.counters["initial_depth"] = static_cast<double>(stream.setup.size());
+}
+
+/**
+ * @brief Replays the flow once per iteration with a per-operation latency recorder (rdtsc around each command)
+ */
+void replayLatency(benchmark::State& state, const WorkloadStream& stream, const std::string& name) {
+    static const TscClock clock = TscClock::calibrate();
+    auto listener = make_noop_listener();
+    LatencyRecorder recorder;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto book = std::make_unique<OrderBook>(stream.peak_resting_orders + 1, stream.max_price);
+        for (const Command& command : stream.setup) {
+            MatchingEngine::process(command, *book, listener);
+        }
+        state.ResumeTiming();
+
+        for (const Command& command : stream.flow) {
+            recorder.process(command, *book, listener);
+        }
+
+        state.PauseTiming();
+        book.reset();
+        state.ResumeTiming();
+    }
+    LatencyHistogram all = recorder.combined();
+    state.SetItemsProcessed(all.count());
+    state.counters["p50_ns"] = clock.nanos(all.percentile(50));
+    state.counters["p99_ns"] = clock.nanos(all.percentile(99));
+    state.counters["p99.9_ns"] = clock.nanos(all.percentile(99.9));
+    state.counters["max_ns"] = clock.nanos(all.max());
+
+    std::cout << "\n" << name << " latency (ns, " << clock.nanosPerTick() << " ns/tick)\n";
+    recorder.print(std::cout, clock);
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Same replay with the instrumented engine: the time shows the probes' overhead, the counters where the
+ * cycles go (per call of each phase; nested phases are included in their parents)
+ */
+void replayProbed(benchmark::State& state, const WorkloadStream& stream) {
+    CycleProbe::reset();
+    replay<BasicMatchingEngine<CycleProbe>>(state, stream, 1);
+    ProbeSnapshot probes = CycleProbe::snapshot();
+
+    auto perCall = [&](ProbePhase phase) {
+        uint64_t calls = probes.phaseCalls(phase);
+        return calls == 0 ? 0.0 : static_cast<double>(probes.phaseCycles(phase)) / static_cast<double>(calls);
+    };
+    state.counters["match_cyc"] = perCall(ProbePhase::Match);
+    state.counters["fill_cyc"] = perCall(ProbePhase::Fill);
+    state.counters["insert_cyc"] = perCall(ProbePhase::Insert);
+    state.counters["remove_cyc"] = perCall(ProbePhase::Remove);
+    state.counters["cursor_cyc"] = perCall(ProbePhase::CursorScan);
+    state.counters["index_ins_cyc"] = perCall(ProbePhase::IndexInsert);
+    state.counters["index_del_cyc"] = perCall(ProbePhase::IndexErase);
+    state.counters["pool_cyc"] = perCall(ProbePhase::PoolAllocate);
+    uint64_t scans = probes.phaseCalls(ProbePhase::CursorScan);
+    uint64_t aggressors = probes.counter(ProbeCounter::Aggressors);
+    state.counters["ticks_per_scan"] =
+        scans == 0 ? 0.0 : static_cast<double>(probes.counter(ProbeCounter::LevelsWalked)) / scans;
+    state.counters["fills_per_aggr"] =
+        aggressors == 0 ? 0.0 : static_cast<double>(probes.counter(ProbeCounter::Fills)) / aggressors;
+    state.counters["pool_high_water"] = static_cast<double>(probes.peak(ProbePeak::PoolHighWater));
+}
+
+int registerWorkloads() {
+    for (const WorkloadProfile& profile : profiles::all()) {
+        std::string name = profile.name;
+        benchmark::RegisterBenchmark(("BM_Workload/" + name).c_str(),
+                                     [profile](benchmark::State& state) { replay(state, streamFor(profile), 1); })
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(
+            ("BM_WorkloadBatch" + std::to_string(BATCH_SIZE) + "/" + name).c_str(),
+            [profile](benchmark::State& state) { replay(state, streamFor(profile), BATCH_SIZE); })
+            ->Unit(benchmark::kMillisecond);
+        // fixed iterations: the function runs once, so the printed table covers exactly the reported samples
+        benchmark::RegisterBenchmark(
+            ("BM_WorkloadLatency/" + name).c_str(),
+            [profile, name](benchmark::State& state) { replayLatency(state, streamFor(profile), name); })
+            ->Unit(benchmark::kMillisecond)
+            ->Iterations(3);
+        benchmark::RegisterBenchmark(("BM_WorkloadProbed/" + name).c_str(),
+                                     [profile](benchmark::State& state) { replayProbed(state, streamFor(profile)); })
+            ->Unit(benchmark::kMillisecond);
+    }
+    if (const char* path = std::getenv("WORKLOAD_STREAM")) {
+        std::string file = path;
+        benchmark::RegisterBenchmark("BM_Workload/file",
+                                     [file](benchmark::State& state) { replay(state, fileStream(file), 1); })
+            ->Unit(benchmark::kMillisecond);
+    }
+    return 0;
+}
+
+[[maybe_unused]] const int registered = registerWorkloads();
+
+} // namespace
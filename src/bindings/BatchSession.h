@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/domain/Command.h"
+#include "src/engines/MatchingEngine.h"
+
+/**
+ * @brief One trade, as returned to batch callers (32 bytes, mirrored by a NumPy structured dtype)
+ */
+struct TradeRecord {
+    OrderId incoming_id;
+    OrderId resting_id;
+    Price price;
+    Quantity quantity;
+    uint32_t command_index; // position of the aggressing command in its batch
+};
+static_assert(sizeof(TradeRecord) == 32);
+
+enum class BookEventType : uint8_t {
+    Added,        // an order (or its remainder) now rests
+    Canceled,     // price and quantity are 0, the engine only reports the id
+    Modified,     // in-place size reduction; repricing modifies show up as trades and/or Added
+    Rejected,     // `reason` says why
+    UnknownOrder, // cancel or modify of an id that is not resting: the book is left as it was
+    Expired,      // unfilled remainder of an immediate-or-cancel, fill-or-kill or market order
+};
+
+/**
+ * @brief One non-trade book event (32 bytes, mirrored by a NumPy structured dtype)
+ */
+struct BookEventRecord {
+    OrderId id;
+    Price price;
+    Quantity quantity;
+    uint32_t command_index;
+    SymbolId symbol;
+    BookEventType type;
+    Side side;
+    RejectReason reason;
+};
+static_assert(sizeof(BookEventRecord) == 32);
+
+/**
+ * @brief Drives MatchingEngine over whole command batches, for foreign-language callers
+ *
+ * Keeps one book per symbol in [0, symbols) and runs a batch command by command, collecting trades and book events
+ * into flat record vectors. A batch is validated up front (symbol in range, prices within the book, known order
+ * types), so a bad command never reaches the engine's unchecked paths and a rejected batch leaves every book untouched.
+ * Ids are left to the engine: a submit of a resting id comes back as a DuplicateOrder reject, a cancel or modify of an
+ * id that is not resting as an UnknownOrder event. `take*()` hands the filled vectors over (ready to be wrapped
+ * without copying) and starts the next batch with buffers of the same capacity, so a steady run allocates once per
+ * batch, never per event. Not thread-safe: one session per thread.
+ */
+class BatchSession {
+  public:
+    BatchSession(size_t symbols, size_t capacity, Price max_price) : capacity(capacity), max_price(max_price) {
+        books.resize(symbols);
+    }
+
+    /**
+     * @brief Throws std::invalid_argument naming the first bad command; nothing is processed in that case
+     */
+    void validate(std::span<const Command> commands) const {
+        for (size_t i = 0; i < commands.size(); ++i) {
+            const Command& command = commands[i];
+            if (command.symbol >= books.size()) {
+                throw std::invalid_argument("command " + std::to_string(i) + ": symbol out of range");
+            }
+            bool market = command.type == CommandType::Submit && command.order_type == OrderType::Market;
+            if (command.type != CommandType::Cancel && !market && (command.price == 0 || command.price > max_price)) {
+                throw std::invalid_argument("command " + std::to_string(i) + ": price out of range");
+            }
+            if (command.type == CommandType::Submit && command.order_type > OrderType::PostOnly) {
+                throw std::invalid_argument("command " + std::to_string(i) + ": unknown order type");
+            }
+        }
+    }
+
+    void process(std::span<const Command> commands) {
+        validate(commands);
+        auto listener = MatchingEngineListener{
+            [this](OrderId incoming_id, OrderId resting_id, Price price, Quantity quantity) {
+                trades.push_back({incoming_id, resting_id, price, quantity, current});
+            },
+            [this](const Order& order) { event(BookEventType::Added, order); },
+            [this](OrderId id) {
+                events.push_back({id, 0, 0, current, symbol, BookEventType::Canceled, Side::Buy, RejectReason{}});
+            },
+            [this](const Order& order) { event(BookEventType::Modified, order); },
+            [this](const Order& order, RejectReason reason) { event(BookEventType::Rejected, order, reason); },
+            [this](const Order& order) { event(BookEventType::Expired, order); }};
+
+        for (size_t i = 0; i < commands.size(); ++i) {
+            const Command& command = commands[i];
+            current = static_cast<uint32_t>(i);
+            symbol = command.symbol;
+            OrderBook& book = bookFor(command.symbol);
+            bool found = true;
+            switch (command.type) {
+            case CommandType::Submit:
+                MatchingEngine::submitOrder(command.order(), command.order_type, book, listener);
+                break;
+            case CommandType::Cancel:
+                found = MatchingEngine::cancelOrder(command.id, book, listener);
+                break;
+            case CommandType::Modify:
+                found = MatchingEngine::modifyOrder(command.id, command.price, command.quantity, book, listener);
+                break;
+            }
+            if (!found) {
+                events.push_back({command.id, command.price, command.quantity, current, symbol,
+                                  BookEventType::UnknownOrder, command.side, RejectReason{}});
+            }
+        }
+    }
+
+    std::vector<TradeRecord> takeTrades() { return takeAndRenew(trades); }
+    std::vector<BookEventRecord> takeEvents() { return takeAndRenew(events); }
+
+    OrderBook& bookFor(SymbolId symbol) {
+        std::unique_ptr<OrderBook>& book = books.at(symbol);
+        if (!book) {
+            book = std::make_unique<OrderBook>(capacity, max_price);
+        }
+        return *book;
+    }
+
+    size_t symbols() const { return books.size(); }
+
+  private:
+    void event(BookEventType type, const Order& order, RejectReason reason = {}) {
+        events.push_back({order.id, order.price, order.quantity, current, symbol, type, order.side, reason});
+    }
+
+    template <typename Record> static std::vector<Record> takeAndRenew(std::vector<Record>& records) {
+        std::vector<Record> taken = std::move(records);
+        records = std::vector<Record>();
+        records.reserve(taken.capacity());
+        return taken;
+    }
+
+    size_t capacity;
+    Price max_price;
+    std::vector<std::unique_ptr<OrderBook>> books; // created on first use
+
+    std::vector<TradeRecord> trades;
+    std::vector<BookEventRecord> events;
+    uint32_t current = 0; // index of the command being processed
+    SymbolId symbol = 0;
+};
@@ -0,0 +1,138 @@
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "src/bindings/BatchSession.h"
+
+namespace py = pybind11;
+
+PYBIND11_NUMPY_DTYPE(Command, id, price, quantity, symbol, type, side, owner, order_type);
+PYBIND11_NUMPY_DTYPE(TradeRecord, incoming_id, resting_id, price, quantity, command_index);
+PYBIND11_NUMPY_DTYPE(BookEventRecord, id, price, quantity, command_index, symbol, type, side, reason);
+
+namespace {
+
+/**
+ * @brief Hands a filled record vector to NumPy without copying: the array owns the vector through a capsule
+ */
+template <typename Record> py::array_t<Record> adopt(std::vector<Record>&& records) {
+    auto* owned = new std::vector<Record>(std::move(records));
+    py::capsule release(owned, [](void* vector) { delete static_cast<std::vector<Record>*>(vector); });
+    return py::array_t<Record>({owned->size()}, {sizeof(Record)}, owned->data(), release);
+}
+
+using Trade = std::tuple<OrderId, OrderId, Price, Quantity>;
+
+/**
+ * @brief Per-call listener: collects the trades a conventional binding returns from each submit/modify
+ */
+struct CallTrades {
+    std::vector<Trade> trades;
+    bool duplicate = false;
+
+    auto listener() {
+        return MatchingEngineListener{
+            [this](OrderId in, OrderId rest, Price price, Quantity qty) { trades.emplace_back(in, rest, price, qty); },
+            [](const Order&) {}, [](OrderId) {}, [](const Order&) {},
+            [this](const Order&, RejectReason reason) { duplicate = reason == RejectReason::DuplicateOrder; }};
+    }
+};
+
+// per-call commands go through the batch checks (std::invalid_argument surfaces as ValueError)
+OrderBook& checkedBook(BatchSession& session, const Command& command) {
+    session.validate(std::span<const Command>(&command, 1));
+    return session.bookFor(command.symbol);
+}
+
+} // namespace
+
+PYBIND11_MODULE(matching_engine, m) {
+    m.doc() = "Batch-oriented bindings of the matching engine for research backtests";
+
+    py::enum_<Side>(m, "Side").value("Buy", Side::Buy).value("Sell", Side::Sell);
+    py::enum_<CommandType>(m, "CommandType")
+        .value("Submit", CommandType::Submit)
+        .value("Cancel", CommandType::Cancel)
+        .value("Modify", CommandType::Modify);
+    py::enum_<OrderType>(m, "OrderType")
+        .value("Limit", OrderType::Limit)
+        .value("ImmediateOrCancel", OrderType::ImmediateOrCancel)
+        .value("FillOrKill", OrderType::FillOrKill)
+        .value("Market", OrderType::Market)
+        .value("PostOnly", OrderType::PostOnly);
+    py::enum_<BookEventType>(m, "BookEventType")
+        .value("Added", BookEventType::Added)
+        .value("Canceled", BookEventType::Canceled)
+        .value("Modified", BookEventType::Modified)
+        .value("Rejected", BookEventType::Rejected)
+        .value("UnknownOrder", BookEventType::UnknownOrder)
+        .value("Expired", BookEventType::Expired);
+
+    m.attr("command_dtype") = py::dtype::of<Command>();
+    m.attr("trade_dtype") = py::dtype::of<TradeRecord>();
+    m.attr("event_dtype") = py::dtype::of<BookEventRecord>();
+
+    py::class_<BatchSession>(m, "Session")
+        .def(py::init<size_t, size_t, Price>(), py::arg("symbols") = 1, py::arg("capacity") = 1'000'000,
+             py::arg("max_price") = 100'000)
+        .def(
+            "process",
+            [](BatchSession& session, py::array_t<Command, py::array::c_style> commands) {
+                std::span<const Command> batch(commands.data(), static_cast<size_t>(commands.size()));
+                {
+                    py::gil_scoped_release release;
+                    session.process(batch);
+                }
+                return std::make_pair(adopt(session.takeTrades()), adopt(session.takeEvents()));
+            },
+            py::arg("commands").noconvert(),
+            "Runs a C-contiguous command_dtype array (read in place, never copied) with the GIL released. Returns "
+            "(trades, events) as trade_dtype/event_dtype arrays; command_index links each record to its command.")
+        .def(
+            "submit",
+            [](BatchSession& session, OrderId id, Quantity quantity, Price price, Side side, SymbolId symbol,
+               OrderType order_type) {
+                Command command = Command::submit(symbol, Order(id, quantity, price, side), order_type);
+                OrderBook& book = checkedBook(session, command);
+                CallTrades result;
+                auto listener = result.listener();
+                MatchingEngine::submitOrder(command.order(), order_type, book, listener);
+                if (result.duplicate) {
+                    throw std::invalid_argument("order id already resting");
+                }
+                return result.trades;
+            },
+            py::arg("id"), py::arg("quantity"), py::arg("price"), py::arg("side"), py::arg("symbol") = 0,
+            py::arg("order_type") = OrderType::Limit)
+        .def(
+            "cancel",
+            [](BatchSession& session, OrderId id, SymbolId symbol) {
+                OrderBook& book = checkedBook(session, Command::cancel(symbol, id));
+                CallTrades result;
+                auto listener = result.listener();
+                return MatchingEngine::cancelOrder(id, book, listener);
+            },
+            py::arg("id"), py::arg("symbol") = 0)
+        .def(
+            "modify",
+            [](BatchSession& session, OrderId id, Price price, Quantity quantity, SymbolId symbol) {
+                OrderBook& book = checkedBook(session, Command::modify(symbol, id, price, quantity));
+                CallTrades result;
+                auto listener = result.listener();
+                MatchingEngine::modifyOrder(id, price, quantity, book, listener);
+                return result.trades;
+            },
+            py::arg("id"), py::arg("price"), py::arg("quantity"), py::arg("symbol") = 0)
+        .def(
+            "best_bid", [](BatchSession& session, SymbolId symbol) { return session.bookFor(symbol).bestBid(); },
+            py::arg("symbol") = 0)
+        .def(
+            "best_ask", [](BatchSession& session, SymbolId symbol) { return session.bookFor(symbol).bestAsk(); },
+            py::arg("symbol") = 0);
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+
+#include "Order.h"
+
+using SymbolId = uint32_t;
+
+enum class CommandType : uint8_t { Submit, Cancel, Modify };
+
+/**
+ * @brief Fixed-size (32 bytes) order entry command, the unit fed to the engine by gateways, queues and replay
+ */
+struct Command {
+    OrderId id;
+    Price price;
+    Quantity quantity;
+    SymbolId symbol;
+    CommandType type;
+    Side side;
+    OwnerId owner = 0;                       // submits only
+    OrderType order_type = OrderType::Limit; // submits only
+
+    static Command submit(SymbolId symbol, const Order& order, OrderType order_type = OrderType::Limit) {
+        return Command{order.id, order.price, order.quantity, symbol, CommandType::Submit, order.side, order.owner,
+                       order_type};
+    }
+    static Command cancel(SymbolId symbol, OrderId id) {
+        return Command{id, 0, 0, symbol, CommandType::Cancel, Side::Buy};
+    }
+    static Command modify(SymbolId symbol, OrderId id, Price price, Quantity quantity) {
+        return Command{id, price, quantity, symbol, CommandType::Modify, Side::Buy};
+    }
+
+    Order order() const { return Order{id, quantity, price, side, owner}; }
+};
+static_assert(sizeof(Command) == 32);
\ No newline at end of file
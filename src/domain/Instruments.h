@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Order.h"
+
+/**
+ * Example instrument specializations for BasicOrderBook, besides DefaultInstrument (see InstrumentTraits).
+ * Both cap the book below 2^16 orders, which gives 16-bit queue links and 16-byte resting orders (4 per cache line
+ * instead of 2).
+ */
+
+/**
+ * @brief Equity-like instrument: prices in cents up to ~42M (32-bit), odd-lot sized quantities, 32-bit ids, owners
+ * below 256 (an 8-bit owner is what still fits the 16-byte resting order)
+ */
+struct CompactEquity {
+    using PriceType = uint32_t;
+    using QuantityType = uint16_t;
+    using IdType = uint32_t;
+    using OwnerType = uint8_t;
+    static constexpr Price TICK_SIZE = 1;
+    static constexpr Price MIN_PRICE = 0;
+    static constexpr Price MAX_PRICE = DYNAMIC_PRICE;
+    static constexpr size_t MAX_ORDERS = 65'000;
+};
+
+/**
+ * @brief Large-tick future trading in a narrow band: 20'000 ticks of 25 above 1'000'000, so a tick fits 16 bits and
+ * the ladders hold one level per tick instead of one per price unit
+ */
+struct LargeTickFuture {
+    using PriceType = uint16_t;
+    using QuantityType = uint16_t;
+    using IdType = uint32_t;
+    using OwnerType = OwnerId;
+    static constexpr Price TICK_SIZE = 25;
+    static constexpr Price MIN_PRICE = 1'000'000;
+    static constexpr Price MAX_PRICE = MIN_PRICE + 19'999 * TICK_SIZE;
+    static constexpr size_t MAX_ORDERS = 65'000;
+};
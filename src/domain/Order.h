@@ -1,16 +1,122 @@
 #pragma once
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <optional>
 
 using Price = uint64_t;
 using Quantity = uint32_t;
 using OrderId = uint64_t;
 using Timestamp = uint64_t;
+using OwnerId = uint16_t; // participant/session an order belongs to; 0 = no owner (not tracked by the book)
 
-enum class Side { Buy, Sell };
+enum class Side : uint8_t { Buy, Sell };
 
-struct Order {
-    OrderId id;
-    Quantity quantity;
-    Price price;
+/**
+ * @brief What an order does with the book on arrival: Limit rests whatever it does not fill; ImmediateOrCancel fills
+ * what it can and expires the rest; FillOrKill fills completely at once or not at all; Market is an ImmediateOrCancel
+ * without a price limit (its price is ignored); PostOnly only ever rests and is rejected if it would trade
+ */
+enum class OrderType : uint8_t { Limit, ImmediateOrCancel, FillOrKill, Market, PostOnly };
+
+/**
+ * @brief Engine-assigned reference to a resting order: its pool slot and the slot's generation when it was handed
+ * out (see BasicOrderBook::resolve)
+ *
+ * Reported through the optional onOrderAdded(const Order&, OrderHandle) hook and accepted by cancelOrder and
+ * modifyOrder in place of the OrderId: the slot is reached by index, without the id lookup. Handing out a slot and
+ * releasing it both bump its generation (odd while it holds an order), so a handle to an order that has since been
+ * filled, canceled or moved through a re-match no longer resolves, even once the slot holds another order, and
+ * neither does a made-up handle to a free slot.
+ */
+struct OrderHandle {
+    uint32_t slot = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool operator==(const OrderHandle&) const = default;
+};
+
+enum class RejectReason : uint8_t {
+    BookFull,          // no free resting order slot left
+    WouldCross,        // post-only order that would have traded on arrival
+    DuplicateOrder,    // an order with the same id is already resting
+    OutsideInstrument, // a narrow instrument cannot store it: off tick, outside the price band, or a field too wide
+};
+
+/**
+ * @brief Compile-time description of an instrument, used to specialize the book's storage and bounds
+ *
+ * Prices on the wire (Order, Command, listener events) are always Price; a book stores them as ticks, i.e.
+ * (price - PRICE_ORIGIN) / TICK_SIZE in a PriceType, with PRICE_ORIGIN one tick below MIN_PRICE so that tick 0 stays
+ * free (a book uses 0 as "no bid"). Ids, quantities and owners are stored in IdType, QuantityType and OwnerType
+ * (a narrow OwnerType limits which owners the instrument accepts). MAX_PRICE and
+ * MAX_ORDERS may be DYNAMIC, in which case the book takes them at construction; a static MAX_ORDERS below 2^16 also
+ * narrows the queue links of resting orders to 16 bits.
+ */
+template <typename Traits>
+concept InstrumentTraits = requires {
+    requires std::unsigned_integral<typename Traits::PriceType>;
+    requires std::unsigned_integral<typename Traits::QuantityType>;
+    requires std::unsigned_integral<typename Traits::IdType>;
+    requires std::unsigned_integral<typename Traits::OwnerType>;
+    { Traits::TICK_SIZE } -> std::convertible_to<Price>;
+    { Traits::MIN_PRICE } -> std::convertible_to<Price>;
+    { Traits::MAX_PRICE } -> std::convertible_to<Price>;
+    { Traits::MAX_ORDERS } -> std::convertible_to<size_t>;
+    requires Traits::TICK_SIZE > 0;
+    requires sizeof(typename Traits::QuantityType) <= sizeof(Quantity);
+    requires sizeof(typename Traits::OwnerType) <= sizeof(OwnerId);
+};
+
+inline constexpr Price DYNAMIC_PRICE = 0;
+inline constexpr size_t DYNAMIC_ORDERS = 0;
+
+/**
+ * @brief Full-width instrument: ticks are prices, bounds and capacity are runtime arguments (the historical book)
+ */
+struct DefaultInstrument {
+    using PriceType = Price;
+    using QuantityType = Quantity;
+    using IdType = OrderId;
+    using OwnerType = OwnerId;
+    static constexpr Price TICK_SIZE = 1;
+    static constexpr Price MIN_PRICE = 0;
+    static constexpr Price MAX_PRICE = DYNAMIC_PRICE;
+    static constexpr size_t MAX_ORDERS = DYNAMIC_ORDERS;
+};
+
+/**
+ * @brief Limit order, with field widths from the instrument (widest fields first, no interior padding)
+ *
+ * The constructor keeps the historical {id, quantity, price, side} argument order, the owner is optional. It sits in
+ * what used to be tail padding, so carrying it costs no space.
+ */
+template <InstrumentTraits Traits> struct BasicOrder {
+    typename Traits::IdType id;
+    typename Traits::PriceType price;
+    typename Traits::QuantityType quantity;
     Side side;
-};
\ No newline at end of file
+    typename Traits::OwnerType owner;
+
+    BasicOrder() = default;
+    BasicOrder(typename Traits::IdType id, typename Traits::QuantityType quantity, typename Traits::PriceType price,
+               Side side, typename Traits::OwnerType owner = 0)
+        : id(id), price(price), quantity(quantity), side(side), owner(owner) {}
+};
+
+using Order = BasicOrder<DefaultInstrument>;
+static_assert(sizeof(Order) == 24);
+
+/**
+ * @brief Which of an owner's resting orders a mass cancel removes: one side or both, within [min_price, max_price]
+ */
+struct MassCancelFilter {
+    std::optional<Side> side;
+    Price min_price = 0;
+    Price max_price = std::numeric_limits<Price>::max();
+
+    bool matches(Side order_side, Price price) const {
+        return (!side || *side == order_side) && price >= min_price && price <= max_price;
+    }
+};
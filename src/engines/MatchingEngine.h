@@ -1,40 +1,423 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <span>
+#include <vector>
+
+#include "src/domain/Command.h"
+#include "src/metrics/Probe.h"
+#include "src/orderbook/AuctionDepth.h"
 #include "src/orderbook/OrderBook.h"
 
-template <typename TradeCallback, typename AddCallback, typename CancelCallback, typename ModifyCallback>
+struct IgnoreEvent {
+    template <typename... Args> void operator()(Args&&...) const {}
+};
+
+template <typename TradeCallback, typename AddCallback, typename CancelCallback, typename ModifyCallback,
+          typename RejectCallback = IgnoreEvent, typename ExpireCallback = IgnoreEvent>
 struct MatchingEngineListener {
 
     TradeCallback trade_callback;
     AddCallback add_callback;
     CancelCallback cancel_callback;
     ModifyCallback modify_callback;
+    RejectCallback reject_callback = {};
+    ExpireCallback expire_callback = {};
 
     void onTrade(OrderId incoming_id, OrderId resting_id, Price price, Quantity qty) {
         trade_callback(incoming_id, resting_id, price, qty);
     }
 
-    void onOrderAdded(const Order& order) { add_callback(order); }
+    void onOrderAdded(const Order& order)
+        requires std::invocable<AddCallback&, const Order&>
+    {
+        add_callback(order);
+    }
+    // an add callback taking the handle as well gets it
+    void onOrderAdded(const Order& order, OrderHandle handle)
+        requires std::invocable<AddCallback&, const Order&, OrderHandle>
+    {
+        add_callback(order, handle);
+    }
 
     void onOrderCanceled(OrderId id) { cancel_callback(id); }
-    void onOrderModified(const Order& order) { modify_callback(order) }
+    void onOrderModified(const Order& order) { modify_callback(order); }
+    void onOrderRejected(const Order& order, RejectReason reason) { reject_callback(order, reason); }
+    void onOrderExpired(const Order& order) { expire_callback(order); }
 };
 
-struct MatchingEngine {
+struct WarmUpOptions {
+    // resting orders per round, at most the book's capacity
+    size_t orders = 4096;
+    size_t rounds = 8;
+    // pin the book's memory with mlock, on top of prefaulting it
+    bool lock_memory = true;
+};
 
-    template <typename MatchingEngineListener>
-    static void submitOrder(Order order, OrderBook& book, MatchingEngineListener& listener) {
+/**
+ * @brief Stateless price-time priority matching over an OrderBook (any BasicOrderBook specialization)
+ *
+ * `Probe` instruments the hot path (matching loop, fills, inserts, removals, cursor scans, pool and index updates;
+ * see metrics/Probe.h). The default NoProbe compiles to nothing: `MatchingEngine` is that specialization, and
+ * `BasicMatchingEngine<CycleProbe>` is the same engine with per-thread cycle and event counters.
+ *
+ * Order types (see OrderType) are a template parameter of submitOrder, so each one gets its own matching loop and a
+ * plain limit order compiles to exactly the loop it always had. The remainder of an immediate-or-cancel, fill-or-kill
+ * or market order never rests: it is reported through the optional onOrderExpired(const Order&) hook instead.
+ *
+ * A listener with onOrderAdded(const Order&, OrderHandle) is told the handle of every order that rests (see
+ * OrderHandle); cancelOrder and modifyOrder take it in place of the OrderId and then skip the id lookup. Both return
+ * false, with no event, for an order that is not resting (an unknown id or a stale handle). A submit whose id is
+ * still resting is rejected with RejectReason::DuplicateOrder before it matches.
+ *
+ * A book with a narrow instrument (see InstrumentTraits) stores ticks, ids, quantities and owners in its own types:
+ * a submit it cannot hold exactly (see BasicOrderBook::accepts) is rejected with RejectReason::OutsideInstrument, and
+ * a modify to such a price or quantity returns false with no event. The default book takes Orders as they are.
+ */
+template <typename Probe = NoProbe> struct BasicMatchingEngine {
+
+    template <OrderType Type = OrderType::Limit, typename MatchingEngineListener, typename Traits>
+    static void submitOrder(Order order, BasicOrderBook<Traits>& book, MatchingEngineListener& listener) {
+        if constexpr (!BasicOrderBook<Traits>::WIRE_LAYOUT) {
+            // a narrow book would truncate what its types cannot hold; a market order's price is not used
+            Order stored = order;
+            if constexpr (Type == OrderType::Market) {
+                stored.price = book.toPrice(1);
+            }
+            if (!book.accepts(stored)) [[unlikely]] {
+                reject(order, RejectReason::OutsideInstrument, listener);
+                return;
+            }
+        }
+        // the id index holds one entry per id: a submit under an id that is still resting is turned away before it
+        // trades
+        if (book.find(order.id) != nullptr) [[unlikely]] {
+            reject(order, RejectReason::DuplicateOrder, listener);
+            return;
+        }
         if (order.side == Side::Buy) {
             BuyPolicy policy(book);
-            match(order, policy, listener);
+            match<Type>(order, policy, listener);
         } else {
             SellPolicy policy(book);
-            match(order, policy, listener);
+            match<Type>(order, policy, listener);
         }
     }
-    template <typename MatchingEngineListener>
-    static void cancelOrder(OrderId order_id, OrderBook& book, MatchingEngineListener& listener) {
-        Level::RestingOrder* resting_order = book.find(order_id);
+
+    /**
+     * @brief Submit with the order type known only at run time (commands, gateways): one switch, then the same
+     * compile-time paths
+     */
+    template <typename MatchingEngineListener, typename Traits>
+    static void submitOrder(Order order, OrderType type, BasicOrderBook<Traits>& book,
+                            MatchingEngineListener& listener) {
+        switch (type) {
+        case OrderType::Limit:
+            submitOrder<OrderType::Limit>(order, book, listener);
+            break;
+        case OrderType::ImmediateOrCancel:
+            submitOrder<OrderType::ImmediateOrCancel>(order, book, listener);
+            break;
+        case OrderType::FillOrKill:
+            submitOrder<OrderType::FillOrKill>(order, book, listener);
+            break;
+        case OrderType::Market:
+            submitOrder<OrderType::Market>(order, book, listener);
+            break;
+        case OrderType::PostOnly:
+            submitOrder<OrderType::PostOnly>(order, book, listener);
+            break;
+        }
+    }
+    template <typename MatchingEngineListener, typename Traits>
+    static bool cancelOrder(OrderId order_id, BasicOrderBook<Traits>& book, MatchingEngineListener& listener) {
+        return cancelResting(book.find(order_id), book, listener);
+    }
+    template <typename MatchingEngineListener, typename Traits>
+    static bool cancelOrder(OrderHandle handle, BasicOrderBook<Traits>& book, MatchingEngineListener& listener) {
+        return cancelResting(book.resolve(handle), book, listener);
+    }
+    template <typename MatchingEngineListener, typename Traits>
+    static bool modifyOrder(OrderId order_id, Price price, Quantity quantity, BasicOrderBook<Traits>& book,
+                            MatchingEngineListener& listener) {
+        return modifyResting(book.find(order_id), price, quantity, book, listener);
+    }
+    template <typename MatchingEngineListener, typename Traits>
+    static bool modifyOrder(OrderHandle handle, Price price, Quantity quantity, BasicOrderBook<Traits>& book,
+                            MatchingEngineListener& listener) {
+        return modifyResting(book.resolve(handle), price, quantity, book, listener);
+    }
+
+    /**
+     * @brief Cancels every resting order of `owner` passing `filter` (kill switch, session loss) in one pass
+     *
+     * The book walks the owner's list and moves its best-price cursors once; the cancels are reported after that,
+     * together: as one onOrdersCanceled(std::span<const Order>) when the listener has it, otherwise as one
+     * onOrderCanceled per order, followed by the level changes. Returns the number of orders canceled.
+     */
+    template <typename MatchingEngineListener, typename Traits>
+    static size_t massCancel(OwnerId owner, BasicOrderBook<Traits>& book, MatchingEngineListener& listener,
+                             const MassCancelFilter& filter = {}) {
+        // reused across calls: a steady run of kill switches does not allocate
+        thread_local std::vector<Order> canceled;
+        canceled.clear();
+        book.removeOwned(owner, filter, [](const Order& order) { canceled.push_back(order); });
+        if (canceled.empty()) {
+            return 0;
+        }
+
+        if constexpr (requires { listener.onOrdersCanceled(std::span<const Order>(canceled)); }) {
+            listener.onOrdersCanceled(std::span<const Order>(canceled));
+        } else {
+            for (const Order& order : canceled) {
+                listener.onOrderCanceled(order.id);
+            }
+        }
+        if constexpr (requires { listener.onLevelChanged(Side::Buy, Price{}); }) {
+            for (const Order& order : canceled) {
+                listener.onLevelChanged(order.side, order.price);
+            }
+        }
+        return canceled.size();
+    }
+
+    /**
+     * @brief Indicative price of the running auction: what uncross() would execute now (price 0 if nothing crosses)
+     */
+    template <typename Traits>
+    static AuctionResult auctionPrice(BasicOrderBook<Traits>& book, Price reference_price = 0) {
+        return auctionEquilibrium(book, reference_price);
+    }
+
+    /**
+     * @brief Ends a call auction: executes everything that crosses at the single equilibrium price, then returns
+     * the book to continuous matching
+     *
+     * The price comes from the aggregated depth (see auctionEquilibrium); execution then walks both sides from their
+     * best level in price-time priority, pairing the best bid with the best ask until the auction volume is done, so
+     * every order that trades would also trade at that price in continuous matching and none behind it in the queue
+     * is filled first. Trades are reported as onTrade(buy_id, sell_id, price, quantity), with level changes as in
+     * continuous matching. What is left does not cross.
+     */
+    template <typename MatchingEngineListener, typename Traits>
+    static AuctionResult uncross(BasicOrderBook<Traits>& book, MatchingEngineListener& listener,
+                                 Price reference_price = 0) {
+        ProbeScope scope(Probe{}, ProbePhase::Match);
+        AuctionResult result = auctionEquilibrium(book, reference_price);
+        for (uint64_t remaining = result.volume; remaining > 0;) {
+            auto& bid_level = book.bestBidLevel();
+            auto* bid = book.top(bid_level);
+            auto& ask_level = book.bestAskLevel();
+            auto* ask = book.top(ask_level);
+
+            // read everything the trade report needs before the fills may release the slots
+            OrderId buy_id = bid->order.id;
+            OrderId sell_id = ask->order.id;
+            Price bid_price = book.priceOf(*bid);
+            Price ask_price = book.priceOf(*ask);
+            Quantity trade_quantity = static_cast<Quantity>(
+                std::min<uint64_t>(remaining, std::min<Quantity>(bid->order.quantity, ask->order.quantity)));
+            remaining -= trade_quantity;
+            book.fillBidOrder(bid_level, bid, trade_quantity, Probe{});
+            book.fillAskOrder(ask_level, ask, trade_quantity, Probe{});
+
+            listener.onTrade(buy_id, sell_id, result.price, trade_quantity);
+            levelChanged(Side::Buy, bid_price, listener);
+            levelChanged(Side::Sell, ask_price, listener);
+        }
+        book.endAuction();
+        return result;
+    }
+
+    template <typename MatchingEngineListener, typename Traits>
+    static void process(const Command& command, BasicOrderBook<Traits>& book, MatchingEngineListener& listener) {
+        switch (command.type) {
+        case CommandType::Submit:
+            if (command.order_type == OrderType::Limit) [[likely]] {
+                submitOrder(command.order(), book, listener);
+            } else {
+                submitOrder(command.order(), command.order_type, book, listener);
+            }
+            break;
+        case CommandType::Cancel:
+            cancelOrder(command.id, book, listener);
+            break;
+        case CommandType::Modify:
+            modifyOrder(command.id, command.price, command.quantity, book, listener);
+            break;
+        }
+    }
+
+    // 2 MiB of resting order slots, plus their index buckets and levels: past what stays in the private caches
+    static constexpr size_t PREFETCH_MIN_SLOTS = size_t{1} << 16;
+
+    /**
+     * @brief Processes a batch of commands in order, prefetching the state later commands will touch
+     *
+     * A cancel or modify is prefetched in three steps while earlier commands run: its id-index bucket
+     * (INDEX_LOOKAHEAD commands ahead), then the resting order slot the now cached bucket points to
+     * (ORDER_LOOKAHEAD), then what unlinking the now cached order touches, its level and queue neighbours
+     * (UNLINK_LOOKAHEAD). The id is looked up once, at ORDER_LOOKAHEAD: the handle of the order found is kept in a
+     * small ring by batch position, and the later steps and the command itself resolve it (two indexed loads) instead
+     * of hashing the id again. An order the earlier commands have removed (or re-matched) in the meantime no longer
+     * resolves, and neither does one not yet resting at lookup time: those commands look the id up when they run.
+     * A submit prefetches its id-index bucket too (submitOrder probes it for a duplicate, then the insert lands there)
+     * and, at ORDER_LOOKAHEAD, the level it would rest on. A book that has never held more than PREFETCH_MIN_SLOTS orders
+     * stays cache resident, where the lookahead has no misses to hide and only costs: its batches run through
+     * process() directly. Prefetching has no side effects: listener events and the final book are exactly those of
+     * calling process() on each command in turn.
+     */
+    template <typename MatchingEngineListener, typename Traits>
+    static void processBatch(std::span<const Command> commands, BasicOrderBook<Traits>& book,
+                             MatchingEngineListener& listener) {
+        const size_t count = commands.size();
+        if (book.resting_orders_pool.highWaterMark() < PREFETCH_MIN_SLOTS) {
+            for (const Command& command : commands) {
+                process(command, book, listener);
+            }
+            return;
+        }
+        // handles of the orders targeted by the commands at positions [i, i + ORDER_LOOKAHEAD], by position
+        std::array<OrderHandle, TARGET_RING> targets;
+        for (size_t i = 0; i < count; ++i) {
+            if (i + INDEX_LOOKAHEAD < count) {
+                book.prefetchIndex(commands[i + INDEX_LOOKAHEAD].id);
+            }
+            if (i + ORDER_LOOKAHEAD < count) {
+                targets[(i + ORDER_LOOKAHEAD) % TARGET_RING] = prefetchTargets(commands[i + ORDER_LOOKAHEAD], book);
+            }
+            if (i + UNLINK_LOOKAHEAD < count && commands[i + UNLINK_LOOKAHEAD].type != CommandType::Submit) {
+                if (const auto* resting_order = book.resolve(targets[(i + UNLINK_LOOKAHEAD) % TARGET_RING])) {
+                    book.prefetchUnlink(*resting_order);
+                }
+            }
+
+            const Command& command = commands[i];
+            if (command.type == CommandType::Submit || i < ORDER_LOOKAHEAD) {
+                process(command, book, listener);
+                continue;
+            }
+            auto* resting_order = book.resolve(targets[i % TARGET_RING]);
+            if (resting_order == nullptr) [[unlikely]] {
+                resting_order = book.find(command.id);
+            }
+            if (command.type == CommandType::Cancel) {
+                cancelResting(resting_order, book, listener);
+            } else {
+                modifyResting(resting_order, command.price, command.quantity, book, listener);
+            }
+        }
+    }
+
+    /**
+     * @brief Gets a book ready for its first real order: prefaults (and locks, see WarmUpOptions) its memory, then
+     * runs synthetic rounds of adds, modifies, sweeps, cancels and a mass cancel through processBatch, discarding the
+     * events, and leaves the book as constructed (see BasicOrderBook::reset), windows included.
+     *
+     * The rounds take the slots, index entries, levels and code paths the first orders would take cold (the book and
+     * index code is shared with every listener; only the thin engine loop is specific to the discarding one). The
+     * book must be empty and is warmed around the middle of its bid window, with one reserved owner. Returns false if
+     * the memory could not all be made resident or locked (RLIMIT_MEMLOCK): the warm-up runs anyway.
+     */
+    template <typename Traits> static bool warmUp(BasicOrderBook<Traits>& book, const WarmUpOptions& options = {}) {
+        assert(!book.inAuction() && !book.hasBids() && !book.hasAsks());
+        bool resident = book.prefault(options.lock_memory);
+
+        const Price max_tick = book.max_price;
+        const Price levels = std::min<Price>(WARM_UP_LEVELS, (max_tick - 1) / 2);
+        const size_t orders = std::min(options.orders, book.resting_orders_pool.capacity());
+        if (levels == 0 || orders == 0) {
+            return resident;
+        }
+        const Price bid_centre = (book.bids.windowBegin() + book.bids.windowEnd()) / 2;
+        const Price ask_centre = (book.asks.windowBegin() + book.asks.windowEnd()) / 2;
+        const Price mid = std::clamp(bid_centre, levels + 1, max_tick - levels);
+        auto price = [&](Side side, Price offset) {
+            return book.toPrice(side == Side::Buy ? mid - offset : mid + offset);
+        };
+
+        MatchingEngineListener<IgnoreEvent, IgnoreEvent, IgnoreEvent, IgnoreEvent> discard{};
+        std::vector<Command> commands;
+        const size_t sweeps = orders / 4;
+        commands.reserve(orders * 2 + sweeps * 2);
+        for (size_t round = 0; round < options.rounds; ++round) {
+            commands.clear();
+            // both sides rest, never crossing, spread over `levels` ticks each side of mid
+            for (size_t i = 0; i < orders; ++i) {
+                Side side = i % 2 ? Side::Sell : Side::Buy;
+                Quantity quantity = 1 + i % 4;
+                commands.push_back(Command::submit(
+                    0, Order{i + 1, quantity, price(side, 1 + (i / 2) % levels), side, WARM_UP_OWNER}));
+            }
+            // every fourth resized in place or moved one level further out
+            for (size_t i = 0; i < orders; i += 4) {
+                Side side = i % 2 ? Side::Sell : Side::Buy;
+                Price offset = 1 + (i / 2) % levels + (i % 8 == 0 && (i / 2) % levels + 1 < levels);
+                commands.push_back(Command::modify(0, i + 1, price(side, offset), 1));
+            }
+            // sweeps across every level of the other side, alternately resting their remainder and expiring it
+            for (size_t j = 0; j < sweeps; ++j) {
+                Side side = j % 2 ? Side::Sell : Side::Buy;
+                Order order{orders + j + 1, 4, price(side == Side::Buy ? Side::Sell : Side::Buy, levels), side,
+                            WARM_UP_OWNER};
+                OrderType type = j % 4 < 2 ? OrderType::Limit : OrderType::ImmediateOrCancel;
+                commands.push_back(Command::submit(0, order, type));
+            }
+            // half of the ids canceled one by one (some are long gone), the rest by owner
+            for (size_t i = 0; i < (orders + sweeps) / 2; ++i) {
+                commands.push_back(Command::cancel(0, i + 1));
+            }
+            processBatch(std::span<const Command>(commands), book, discard);
+            massCancel(WARM_UP_OWNER, book, discard);
+        }
+
+        book.reset();
+        book.bids.recentre(bid_centre);
+        book.asks.recentre(ask_centre);
+        return resident;
+    }
+
+  private:
+    static constexpr Price WARM_UP_LEVELS = 32;
+    static constexpr OwnerId WARM_UP_OWNER = 1;
+
+    static constexpr size_t INDEX_LOOKAHEAD = 8;
+    static constexpr size_t ORDER_LOOKAHEAD = 4;
+    static constexpr size_t UNLINK_LOOKAHEAD = 2;
+
+    // ring of looked-up targets in processBatch: the positions from i to i + ORDER_LOOKAHEAD are live at once
+    static constexpr size_t TARGET_RING = std::bit_ceil(ORDER_LOOKAHEAD + 1);
+
+    // returns the handle of the order a cancel or modify targets, an unresolvable one if it is not resting (yet)
+    template <typename Traits>
+    static OrderHandle prefetchTargets(const Command& command, BasicOrderBook<Traits>& book) {
+        if (command.type == CommandType::Submit) {
+            book.prefetchLevel(command.side, command.price);
+            return {};
+        }
+        const auto* resting_order = book.find(command.id);
+        if (resting_order == nullptr) {
+            return {};
+        }
+        __builtin_prefetch(resting_order, 1);
+        if (command.type == CommandType::Modify) {
+            // the side is in the slot being fetched: hint both ladders rather than wait for it
+            book.prefetchLevel(Side::Buy, command.price);
+            book.prefetchLevel(Side::Sell, command.price);
+        }
+        return book.handleOf(*resting_order);
+    }
+
+    template <typename MatchingEngineListener, typename Traits>
+    static bool cancelResting(typename BasicOrderBook<Traits>::RestingOrder* resting_order,
+                              BasicOrderBook<Traits>& book, MatchingEngineListener& listener) {
+        if (resting_order == nullptr) [[unlikely]] {
+            return false;
+        }
         if (resting_order->order.side == Side::Buy) {
             BuyPolicy policy(book);
             cancel(resting_order, policy, listener);
@@ -42,11 +425,24 @@ struct MatchingEngine {
             SellPolicy policy(book);
             cancel(resting_order, policy, listener);
         }
+        return true;
     }
-    template <typename MatchingEngineListener>
-    static void modifyOrder(OrderId order_id, Price price, Quantity quantity, OrderBook& book,
-                            MatchingEngineListener& listener) {
-        Level::RestingOrder* resting_order = book.find(order_id);
+
+    template <typename MatchingEngineListener, typename Traits>
+    static bool modifyResting(typename BasicOrderBook<Traits>::RestingOrder* resting_order, Price price,
+                              Quantity quantity, BasicOrderBook<Traits>& book, MatchingEngineListener& listener) {
+        if (resting_order == nullptr) [[unlikely]] {
+            return false;
+        }
+        if constexpr (!BasicOrderBook<Traits>::WIRE_LAYOUT) {
+            // same bounds as a submit: relink would store the new price and quantity truncated
+            Order modified = book.toOrder(*resting_order);
+            modified.price = price;
+            modified.quantity = quantity;
+            if (!book.accepts(modified)) [[unlikely]] {
+                return false;
+            }
+        }
         if (resting_order->order.side == Side::Buy) {
             BuyPolicy policy(book);
             modify(resting_order, price, quantity, policy, listener);
@@ -54,105 +450,236 @@ struct MatchingEngine {
             SellPolicy policy(book);
             modify(resting_order, price, quantity, policy, listener);
         }
+        return true;
     }
 
-  private:
-    struct BuyPolicy {
-        OrderBook& book;
-        BuyPolicy(OrderBook& b) : book(b) {}
+    template <typename Book> struct BuyPolicy {
+        using Level = typename Book::Level;
+        using RestingOrder = typename Book::RestingOrder;
+
+        static constexpr Side RESTING_SIDE = Side::Buy;
+        static constexpr Side OPPOSITE_SIDE = Side::Sell;
+
+        Book& book;
+        BuyPolicy(Book& b) : book(b) {}
 
         bool hasMatchingOrders() { return book.hasAsks(); }
 
         bool canMatch(Order& buy_order) { return buy_order.price >= book.bestAsk(); }
 
+        bool covers(Order& buy_order) { return book.asksCover(book.toTick(buy_order.price), buy_order.quantity); }
+
+        // the price a market buy matches with: any ask
+        Price marketPrice() { return book.toPrice(book.max_price); }
+
         Level& matchLevel() { return book.bestAskLevel(); }
 
-        Level& getRestingLevel(Price price) { return book.bidLevel(price); }
+        RestingOrder* top(Level& ask_level) { return book.top(ask_level); }
+
+        Level& getRestingLevel(Price tick) { return book.bidLevel(tick); }
 
-        void updateMatchableTOB() { book.incrementAskCursor(); }
+        void updateMatchableTOB() { book.incrementAskCursor(Probe{}); }
 
-        void updateRestingTOB() { book.decrementBidCursor(); }
+        void updateRestingTOB() { book.decrementBidCursor(Probe{}); }
 
-        void insert(Order& buy_order) { book.insertBid(buy_order); }
+        RestingOrder* insert(Order& buy_order) { return book.insertBid(buy_order, Probe{}); }
 
-        void fillRestingOrder(Level& bid_level, Level::RestingOrder* bid, Quantity trade_quantity) {
-            book.fillBidOrder(bid_level, bid, trade_quantity);
+        void fillRestingOrder(Level& bid_level, RestingOrder* bid, Quantity trade_quantity) {
+            book.fillBidOrder(bid_level, bid, trade_quantity, Probe{});
         }
 
-        void fillOppositeOrder(Level& ask_level, Level::RestingOrder* ask, Quantity trade_quantity) {
-            book.fillAskOrder(ask_level, ask, trade_quantity);
+        void fillOppositeOrder(Level& ask_level, RestingOrder* ask, Quantity trade_quantity) {
+            book.fillAskOrder(ask_level, ask, trade_quantity, Probe{});
         }
 
-        void cancel(Level::RestingOrder* bid) { book.removeBid(bid); }
+        void cancel(RestingOrder* bid) { book.removeBid(bid, Probe{}); }
+
+        void relink(RestingOrder* bid, Price tick, Quantity quantity) { book.relinkBid(bid, tick, quantity, Probe{}); }
     };
 
-    struct SellPolicy {
-        OrderBook& book;
-        SellPolicy(OrderBook& b) : book(b) {}
+    template <typename Book> struct SellPolicy {
+        using Level = typename Book::Level;
+        using RestingOrder = typename Book::RestingOrder;
+
+        static constexpr Side RESTING_SIDE = Side::Sell;
+        static constexpr Side OPPOSITE_SIDE = Side::Buy;
+
+        Book& book;
+        SellPolicy(Book& b) : book(b) {}
 
         bool hasMatchingOrders() { return book.hasBids(); }
 
         bool canMatch(Order& sell_order) { return sell_order.price <= book.bestBid(); }
 
+        bool covers(Order& sell_order) { return book.bidsCover(book.toTick(sell_order.price), sell_order.quantity); }
+
+        // the price a market sell matches with: any bid
+        Price marketPrice() { return book.toPrice(0); }
+
         Level& matchLevel() { return book.bestBidLevel(); }
 
-        Level& getRestingLevel(Price price) { return book.askLevel(price); }
+        RestingOrder* top(Level& bid_level) { return book.top(bid_level); }
+
+        Level& getRestingLevel(Price tick) { return book.askLevel(tick); }
 
-        void insert(Order& sell_order) { book.insertAsk(sell_order); }
+        RestingOrder* insert(Order& sell_order) { return book.insertAsk(sell_order, Probe{}); }
 
-        void fillOppositeOrder(Level& bid_level, Level::RestingOrder* bid, Quantity trade_quantity) {
-            book.fillBidOrder(bid_level, bid, trade_quantity);
+        void fillOppositeOrder(Level& bid_level, RestingOrder* bid, Quantity trade_quantity) {
+            book.fillBidOrder(bid_level, bid, trade_quantity, Probe{});
         }
 
-        void fillRestingOrder(Level& ask_level, Level::RestingOrder* ask, Quantity trade_quantity) {
-            book.fillAskOrder(ask_level, ask, trade_quantity);
+        void fillRestingOrder(Level& ask_level, RestingOrder* ask, Quantity trade_quantity) {
+            book.fillAskOrder(ask_level, ask, trade_quantity, Probe{});
         }
 
-        void cancel(Level::RestingOrder* ask) { book.removeAsk(ask); }
+        void cancel(RestingOrder* ask) { book.removeAsk(ask, Probe{}); }
+
+        void relink(RestingOrder* ask, Price tick, Quantity quantity) { book.relinkAsk(ask, tick, quantity, Probe{}); }
     };
 
-    template <typename Policy, typename MatchingEngineListener>
+    template <OrderType Type = OrderType::Limit, typename Policy, typename MatchingEngineListener>
     static void match(Order& order, Policy& book_policy, MatchingEngineListener& listener) {
+        ProbeScope scope(Probe{}, ProbePhase::Match);
+        [[maybe_unused]] uint64_t fills = 0;
+
+        // in an auction orders only accumulate, uncross() matches them
+        const bool continuous = !book_policy.book.inAuction();
+        if constexpr (Type == OrderType::PostOnly) {
+            if (continuous && book_policy.hasMatchingOrders() && book_policy.canMatch(order)) {
+                reject(order, RejectReason::WouldCross, listener);
+                return;
+            }
+        }
+        if constexpr (Type == OrderType::FillOrKill) {
+            // decided on aggregate level quantities, before any resting order is touched
+            if (!continuous || !book_policy.covers(order)) {
+                expire(order, listener);
+                return;
+            }
+        }
+        [[maybe_unused]] const Price limit_price = order.price;
+        if constexpr (Type == OrderType::Market) {
+            order.price = book_policy.marketPrice();
+        }
 
-        while (order.quantity > 0 && book_policy.canMatch(order) && book_policy.hasMatchingOrders()) {
-            Level& match_level = book_policy.matchLevel();
-            Level::RestingOrder* matching_order = match_level.top();
+        while (continuous && order.quantity > 0 && book_policy.canMatch(order) && book_policy.hasMatchingOrders()) {
+            auto& match_level = book_policy.matchLevel();
+            auto* matching_order = book_policy.top(match_level);
 
-            Quantity trade_quantity = std::min(order.quantity, matching_order->order.quantity);
+            // read everything the trade report needs before the fill may release the slot
+            OrderId resting_id = matching_order->order.id;
+            Price trade_price = book_policy.book.priceOf(*matching_order);
+            Quantity trade_quantity = std::min<Quantity>(order.quantity, matching_order->order.quantity);
             order.quantity -= trade_quantity;
             book_policy.fillOppositeOrder(match_level, matching_order, trade_quantity);
 
-            listener.onTrade(order.id, matching_order->order.id, matching_order->order.price, trade_quantity);
+            listener.onTrade(order.id, resting_id, trade_price, trade_quantity);
+            levelChanged(Policy::OPPOSITE_SIDE, trade_price, listener);
+            if constexpr (Probe::ENABLED) {
+                ++fills;
+            }
+        }
+        if constexpr (Probe::ENABLED) {
+            if (fills > 0) {
+                Probe{}.count(ProbeCounter::Fills, fills);
+                Probe{}.count(ProbeCounter::Aggressors);
+                Probe{}.peak(ProbePeak::FillsPerAggressor, fills);
+            }
         }
 
         if (order.quantity > 0) {
-            book_policy.insert(order);
+            if constexpr (Type == OrderType::Limit || Type == OrderType::PostOnly) {
+                if (auto* resting_order = book_policy.insert(order)) [[likely]] {
+                    added(order, *resting_order, book_policy.book, listener);
+                    levelChanged(Policy::RESTING_SIDE, order.price, listener);
+                } else {
+                    reject(order, RejectReason::BookFull, listener);
+                }
+            } else {
+                order.price = limit_price;
+                expire(order, listener);
+            }
+        }
+    }
+
+    // rejects are optional for listeners: one without onOrderRejected just doesn't hear about them
+    template <typename MatchingEngineListener>
+    static void reject(const Order& order, RejectReason reason, MatchingEngineListener& listener) {
+        if constexpr (requires { listener.onOrderRejected(order, reason); }) {
+            listener.onOrderRejected(order, reason);
+        }
+    }
+
+    // so are expiries: the unfilled remainder of an order that may not rest
+    template <typename MatchingEngineListener>
+    static void expire(const Order& order, MatchingEngineListener& listener) {
+        if constexpr (requires { listener.onOrderExpired(order); }) {
+            listener.onOrderExpired(order);
+        }
+    }
+
+    // the handle of a resting order goes to listeners that take it
+    template <typename Book, typename MatchingEngineListener>
+    static void added(const Order& order, const typename Book::RestingOrder& resting_order, Book& book,
+                      MatchingEngineListener& listener) {
+        if constexpr (requires { listener.onOrderAdded(order, OrderHandle{}); }) {
+            listener.onOrderAdded(order, book.handleOf(resting_order));
+        } else {
             listener.onOrderAdded(order);
         }
     }
 
+    // level changes are optional as well: they let a listener maintain aggregated depth (see MarketDataBuilder)
+    template <typename MatchingEngineListener>
+    static void levelChanged(Side side, Price price, MatchingEngineListener& listener) {
+        if constexpr (requires { listener.onLevelChanged(side, price); }) {
+            listener.onLevelChanged(side, price);
+        }
+    }
+
     template <typename Policy, typename MatchingEngineListener>
-    static void cancel(Level::RestingOrder* resting_order, Policy& book_policy, MatchingEngineListener& listener) {
+    static void cancel(typename Policy::RestingOrder* resting_order, Policy& book_policy,
+                       MatchingEngineListener& listener) {
         OrderId id = resting_order->order.id;
+        Price price = book_policy.book.priceOf(*resting_order);
         book_policy.cancel(resting_order);
         listener.onOrderCanceled(id);
+        levelChanged(Policy::RESTING_SIDE, price, listener);
     }
 
     template <typename Policy, typename MatchingEngineListener>
-    static void modify(Level::RestingOrder* resting_order, Price price, Quantity quantity, Policy& book_policy,
-                       MatchingEngineListener& listener) {
+    static void modify(typename Policy::RestingOrder* resting_order, Price price, Quantity quantity,
+                       Policy& book_policy, MatchingEngineListener& listener) {
 
-        if (price == resting_order->order.price && quantity < resting_order->order.quantity) {
-            Level& order_level = book_policy.getRestingLevel(resting_order->order.price);
+        if (price == book_policy.book.priceOf(*resting_order) && quantity < resting_order->order.quantity) {
+            auto& order_level = book_policy.getRestingLevel(resting_order->order.price);
             Quantity delta = resting_order->order.quantity - quantity;
+            // built before the fill: down to zero it releases the slot
+            Order modified_order = book_policy.book.toOrder(*resting_order);
+            modified_order.quantity = quantity;
             book_policy.fillRestingOrder(order_level, resting_order, delta);
-            listener.onOrderModified(resting_order->order);
+            listener.onOrderModified(modified_order);
+            levelChanged(Policy::RESTING_SIDE, price, listener);
         } else {
-            Order modified_order = resting_order->order;
+            Order modified_order = book_policy.book.toOrder(*resting_order);
+            Price old_price = modified_order.price;
             modified_order.price = price;
             modified_order.quantity = quantity;
+            if (quantity > 0 && (book_policy.book.inAuction() ||
+                                 !(book_policy.hasMatchingOrders() && book_policy.canMatch(modified_order)))) {
+                // nothing to match (or an auction, which does not match): move the order to the back of its new queue
+                // in place (same slot, same index entry) and report it exactly as the cancel-and-resubmit below would
+                book_policy.relink(resting_order, book_policy.book.toTick(price), quantity);
+                levelChanged(Policy::RESTING_SIDE, old_price, listener);
+                added(modified_order, *resting_order, book_policy.book, listener);
+                levelChanged(Policy::RESTING_SIDE, price, listener);
+                return;
+            }
             book_policy.cancel(resting_order);
+            levelChanged(Policy::RESTING_SIDE, old_price, listener);
             match(modified_order, book_policy, listener);
         }
     }
-};
\ No newline at end of file
+};
+
+using MatchingEngine = BasicMatchingEngine<>;
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "MatchingEngine.h"
+#include "src/domain/Command.h"
+#include "src/infrastructure/LockFreeQueue.h"
+#include "src/infrastructure/Thread.h"
+#include "src/marketdata/BookView.h"
+
+/**
+ * @brief Multi-symbol runtime: symbols are partitioned over N worker threads, each pinned to its own core
+ *
+ * Symbol s belongs to shard s % N. A worker owns the books of its symbols exclusively (it even builds them, so
+ * their memory is first touched from its core) and receives commands through its own SPSC LockFreeQueue, so no
+ * book state is ever shared between threads. Every shard has its own listener instance.
+ *
+ * Threading contract: submit()/trySubmit()/waitUntilDrained() must all be called from one ingress thread, which is
+ * the single producer of every shard queue. Listener callbacks run on the worker threads.
+ *
+ * With `publish_views`, every symbol also gets a BookView that its worker publishes after each batch of commands
+ * (once per book the batch touched, before the batch counts as processed): view(symbol) can then be read from any
+ * thread, at any time after start(), without disturbing the worker.
+ */
+template <typename Listener> class ShardedEngine {
+  public:
+    using BookFactory = std::function<std::unique_ptr<OrderBook>(SymbolId)>;
+    using ListenerFactory = std::function<Listener(size_t shard)>;
+
+    /**
+     * @param cores cores[i] is the core of shard i; shards without an entry are not pinned
+     * @param publish_views maintain a BookView per symbol (see view())
+     */
+    ShardedEngine(size_t shard_count, SymbolId symbol_count, BookFactory make_book, ListenerFactory make_listener,
+                  std::vector<int> cores = {}, size_t queue_capacity = 1 << 16, bool publish_views = false)
+        : symbol_count(symbol_count), make_book(std::move(make_book)), cores(std::move(cores)),
+          publish_views(publish_views) {
+        assert(shard_count > 0);
+        shards.reserve(shard_count);
+        for (size_t i = 0; i < shard_count; ++i) {
+            shards.push_back(std::make_unique<Shard>(queue_capacity, make_listener(i)));
+        }
+    }
+
+    ~ShardedEngine() { stop(); }
+
+    ShardedEngine(const ShardedEngine&) = delete;
+    ShardedEngine& operator=(const ShardedEngine&) = delete;
+
+    /**
+     * @brief Launches the workers and waits until every one of them has built its books
+     */
+    void start() {
+        running.store(true, std::memory_order_release);
+        for (size_t i = 0; i < shards.size(); ++i) {
+            shards[i]->thread = std::thread([this, i] { run(i); });
+        }
+        for (auto& shard : shards) {
+            while (!shard->ready.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /**
+     * @brief Lets the workers drain their queues, then joins them
+     */
+    void stop() {
+        running.store(false, std::memory_order_release);
+        for (auto& shard : shards) {
+            if (shard->thread.joinable()) {
+                shard->thread.join();
+            }
+        }
+    }
+
+    /**
+     * @brief Enqueues a command for the shard owning its symbol, false if that queue is full
+     */
+    bool trySubmit(const Command& command) {
+        assert(command.symbol < symbol_count);
+        Shard& shard = *shards[shardOf(command.symbol)];
+        if (!shard.queue.push(command)) [[unlikely]] {
+            return false;
+        }
+        ++shard.submitted;
+        return true;
+    }
+
+    /**
+     * @brief Enqueues a command, spinning while the target queue is full (back-pressure on the ingress thread)
+     */
+    void submit(const Command& command) {
+        while (!trySubmit(command)) {
+            cpuRelax();
+        }
+    }
+
+    /**
+     * @brief Spins until every command submitted so far has been processed
+     */
+    void waitUntilDrained() {
+        for (auto& shard : shards) {
+            while (shard->processed.load(std::memory_order_acquire) != shard->submitted) {
+                cpuRelax();
+            }
+        }
+    }
+
+    size_t shardCount() const { return shards.size(); }
+    size_t shardOf(SymbolId symbol) const { return symbol % shards.size(); }
+
+    // only safe while the shard's worker is stopped or drained
+    Listener& listener(size_t shard) { return shards[shard]->listener; }
+    OrderBook& book(SymbolId symbol) { return *shards[shardOf(symbol)]->books[symbol / shards.size()]; }
+
+    // safe from any thread once start() has returned, only with `publish_views`
+    const BookView<>& view(SymbolId symbol) const {
+        assert(publish_views);
+        return *shards[shardOf(symbol)]->views[symbol / shards.size()];
+    }
+
+  private:
+    // commands processed between two publications of the progress counter
+    static constexpr size_t MAX_BATCH = 64;
+
+    struct Shard {
+        Shard(size_t queue_capacity, Listener listener) : queue(queue_capacity), listener(std::move(listener)) {}
+
+        LockFreeQueue<Command> queue;
+        std::vector<std::unique_ptr<OrderBook>> books; // indexed by symbol / shard count
+        std::vector<std::unique_ptr<BookView<>>> views; // likewise, empty without `publish_views`
+        std::vector<size_t> touched;                    // books the current batch ran commands on, to publish
+        std::vector<bool> is_touched;
+        Listener listener;
+        std::thread thread;
+        uint64_t submitted = 0; // written by the ingress thread only
+
+        alignas(64) std::atomic<uint64_t> processed{0};
+        std::atomic<bool> ready{false};
+    };
+
+    void run(size_t index) {
+        Shard& shard = *shards[index];
+        if (index < cores.size()) {
+            pinCurrentThread(cores[index]);
+        }
+        for (SymbolId symbol = static_cast<SymbolId>(index); symbol < symbol_count;
+             symbol += static_cast<SymbolId>(shards.size())) {
+            shard.books.push_back(make_book(symbol));
+            if (publish_views) {
+                shard.views.push_back(std::make_unique<BookView<>>());
+                shard.views.back()->publish(*shard.books.back());
+            }
+        }
+        shard.touched.reserve(MAX_BATCH);
+        shard.is_touched.assign(shard.books.size(), false);
+        shard.ready.store(true, std::memory_order_release);
+
+        uint64_t processed = 0;
+        bool stopping = false;
+        while (true) {
+            size_t batch = shard.queue.consumeBatch(
+                [&](const Command& command) {
+                    size_t local = command.symbol / shards.size();
+                    MatchingEngine::process(command, *shard.books[local], shard.listener);
+                    if (publish_views && !shard.is_touched[local]) {
+                        shard.is_touched[local] = true;
+                        shard.touched.push_back(local);
+                    }
+                },
+                MAX_BATCH);
+            if (batch > 0) {
+                for (size_t local : shard.touched) {
+                    shard.views[local]->publish(*shard.books[local]);
+                    shard.is_touched[local] = false;
+                }
+                shard.touched.clear();
+                processed += batch;
+                shard.processed.store(processed, std::memory_order_release);
+                continue;
+            }
+            if (stopping) {
+                break;
+            }
+            // one more pass over the queue after seeing the stop flag: everything pushed before stop() is processed
+            stopping = !running.load(std::memory_order_acquire);
+            if (!stopping) {
+                cpuRelax();
+            }
+        }
+    }
+
+    SymbolId symbol_count;
+    BookFactory make_book;
+    std::vector<int> cores;
+    bool publish_views;
+    std::vector<std::unique_ptr<Shard>> shards;
+    std::atomic<bool> running{false};
+};
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "src/domain/Command.h"
+#include "src/gateway/FixEncoder.h"
+#include "src/gateway/FixParser.h"
+#include "src/gateway/TcpSocket.h"
+#include "src/infrastructure/Thread.h"
+
+/**
+ * @brief An inbound message as the client sees it: ExecutionReport (8), OrderCancelReject (9) or a session message
+ */
+struct FixExecution {
+    char msg_type = 0;
+    char exec_type = 0;
+    char ord_status = 0;
+    Side side = Side::Buy;
+    uint64_t seq_num = 0;
+    uint64_t cl_ord_id = 0;
+    uint64_t orig_cl_ord_id = 0;
+    Price price = 0;
+    Price last_price = 0;
+    Quantity last_quantity = 0;
+    Quantity leaves = 0;
+    uint32_t reject_reason = 0; // OrdRejReason (8) or CxlRejReason (9)
+};
+
+/**
+ * @brief Order-entry client and load generator for FixGateway, over one non-blocking TCP connection
+ *
+ * Requests are encoded into a preallocated send buffer and written by flush(), so a load generator queues a whole
+ * window of orders and sends it with a few system calls; send(const Command&) replays workload commands (see
+ * workload/WorkloadGenerator.h), using command ids as ClOrdIDs. poll() reads whatever arrived and hands each
+ * message to a handler. Keep windows well below what the gateway's and the kernel's buffers hold when one thread
+ * both sends and reads, or flush() waits on a gateway that waits on this client. Setup errors and malformed input
+ * throw.
+ */
+class FixClient {
+  public:
+    explicit FixClient(std::string comp_id, std::string target_comp_id = "ENGINE", size_t buffer_size = 1 << 20)
+        : comp_id(std::move(comp_id)), target_comp_id(std::move(target_comp_id)), buffer_size(buffer_size),
+          input(std::make_unique_for_overwrite<char[]>(buffer_size)),
+          output(std::make_unique_for_overwrite<char[]>(buffer_size)) {}
+
+    void connect(const std::string& address, uint16_t port) { socket = TcpSocket::connect(address, port); }
+
+    void logon(uint64_t heartbeat_interval = 30) {
+        queue(encoder.begin("A", comp_id, target_comp_id, ++sent_seq_num)
+                  .uintField(FixTag::ENCRYPT_METHOD, 0)
+                  .uintField(FixTag::HEART_BT_INT, heartbeat_interval));
+    }
+
+    void logout() { queue(encoder.begin("5", comp_id, target_comp_id, ++sent_seq_num)); }
+
+    /**
+     * @brief NewOrderSingle; the order type is sent as OrdType, TimeInForce and ExecInst, a market order has no Price
+     */
+    void newOrder(uint64_t cl_ord_id, Side side, Quantity quantity, Price price, OrderType type = OrderType::Limit) {
+        encoder.begin("D", comp_id, target_comp_id, ++sent_seq_num)
+            .uintField(FixTag::CL_ORD_ID, cl_ord_id)
+            .textField(FixTag::SYMBOL, "SYM")
+            .charField(FixTag::SIDE, side == Side::Buy ? '1' : '2')
+            .uintField(FixTag::ORDER_QTY, quantity)
+            .charField(FixTag::ORD_TYPE, type == OrderType::Market ? '1' : '2');
+        if (type != OrderType::Market) {
+            encoder.uintField(FixTag::PRICE, price);
+        }
+        if (type == OrderType::ImmediateOrCancel || type == OrderType::FillOrKill) {
+            encoder.charField(FixTag::TIME_IN_FORCE, type == OrderType::ImmediateOrCancel ? '3' : '4');
+        }
+        if (type == OrderType::PostOnly) {
+            encoder.charField(FixTag::EXEC_INST, '6');
+        }
+        queue(encoder);
+    }
+
+    void cancel(uint64_t orig_cl_ord_id) {
+        queue(encoder.begin("F", comp_id, target_comp_id, ++sent_seq_num)
+                  .uintField(FixTag::ORIG_CL_ORD_ID, orig_cl_ord_id)
+                  .uintField(FixTag::CL_ORD_ID, ++request_ids)
+                  .textField(FixTag::SYMBOL, "SYM"));
+    }
+
+    void replace(uint64_t orig_cl_ord_id, Price price, Quantity quantity) {
+        queue(encoder.begin("G", comp_id, target_comp_id, ++sent_seq_num)
+                  .uintField(FixTag::ORIG_CL_ORD_ID, orig_cl_ord_id)
+                  .uintField(FixTag::CL_ORD_ID, ++request_ids)
+                  .textField(FixTag::SYMBOL, "SYM")
+                  .uintField(FixTag::ORDER_QTY, quantity)
+                  .charField(FixTag::ORD_TYPE, '2')
+                  .uintField(FixTag::PRICE, price));
+    }
+
+    void send(const Command& command) {
+        switch (command.type) {
+        case CommandType::Submit:
+            newOrder(command.id, command.side, command.quantity, command.price, command.order_type);
+            break;
+        case CommandType::Cancel:
+            cancel(command.id);
+            break;
+        case CommandType::Modify:
+            replace(command.id, command.price, command.quantity);
+            break;
+        }
+    }
+
+    /**
+     * @brief Writes every queued message, spinning while the socket cannot take more
+     */
+    void flush() {
+        size_t written = 0;
+        for (uint64_t spins = 1; written < output_size; ++spins) {
+            ptrdiff_t sent = socket.send(output.get() + written, output_size - written);
+            if (sent < 0) {
+                throw std::runtime_error("FIX connection lost");
+            }
+            written += static_cast<size_t>(sent);
+            if (sent > 0) {
+                continue;
+            }
+            // the gateway may share this core
+            if (spins % 64 == 0) {
+                std::this_thread::yield();
+            } else {
+                cpuRelax();
+            }
+        }
+        output_size = 0;
+    }
+
+    /**
+     * @brief Reads what has arrived and calls `handler(const FixExecution&)` for each complete message, returns how
+     * many; false from connected() once the gateway has closed the connection
+     */
+    template <typename Handler> size_t poll(Handler&& handler) {
+        ptrdiff_t bytes = socket.receive(input.get() + input_size, buffer_size - input_size);
+        if (bytes < 0) {
+            socket.close();
+            return 0;
+        }
+        input_size += static_cast<size_t>(bytes);
+
+        size_t offset = 0;
+        size_t handled = 0;
+        while (true) {
+            std::string_view pending(input.get() + offset, input_size - offset);
+            size_t frame = fixFrameLength(pending);
+            if (frame == 0) {
+                break;
+            }
+            if (frame == FIX_MALFORMED) {
+                throw std::runtime_error("malformed FIX message from gateway");
+            }
+            handler(decode(pending.substr(0, frame)));
+            offset += frame;
+            ++handled;
+        }
+        input_size -= offset;
+        std::memmove(input.get(), input.get() + offset, input_size);
+        return handled;
+    }
+
+    bool connected() const { return socket.valid(); }
+
+  private:
+    static FixExecution decode(std::string_view frame) {
+        size_t checksum_at = frame.size() - FIX_TRAILER_SIZE;
+        uint64_t declared = 0;
+        if (!parseFixUint(frame.substr(checksum_at + 3, 3), declared) ||
+            declared != fixChecksum(frame.data(), checksum_at)) {
+            throw std::runtime_error("bad FIX checksum from gateway");
+        }
+        FixExecution execution;
+        uint64_t number = 0;
+        forEachFixField(frame, [&](uint32_t tag, std::string_view value) {
+            bool numeric = parseFixUint(value, number);
+            switch (tag) {
+            case FixTag::MSG_TYPE:
+                execution.msg_type = value.empty() ? 0 : value[0];
+                break;
+            case FixTag::EXEC_TYPE:
+                execution.exec_type = value.empty() ? 0 : value[0];
+                break;
+            case FixTag::ORD_STATUS:
+                execution.ord_status = value.empty() ? 0 : value[0];
+                break;
+            case FixTag::SIDE:
+                execution.side = value == "2" ? Side::Sell : Side::Buy;
+                break;
+            case FixTag::MSG_SEQ_NUM:
+                execution.seq_num = numeric ? number : 0;
+                break;
+            case FixTag::CL_ORD_ID:
+                execution.cl_ord_id = numeric ? number : 0;
+                break;
+            case FixTag::ORIG_CL_ORD_ID:
+                execution.orig_cl_ord_id = numeric ? number : 0;
+                break;
+            case FixTag::PRICE:
+                execution.price = numeric ? number : 0;
+                break;
+            case FixTag::LAST_PX:
+                execution.last_price = numeric ? number : 0;
+                break;
+            case FixTag::LAST_QTY:
+                execution.last_quantity = numeric ? static_cast<Quantity>(number) : 0;
+                break;
+            case FixTag::LEAVES_QTY:
+                execution.leaves = numeric ? static_cast<Quantity>(number) : 0;
+                break;
+            case FixTag::ORD_REJ_REASON:
+            case FixTag::CXL_REJ_REASON:
+                execution.reject_reason = numeric ? static_cast<uint32_t>(number) : 0;
+                break;
+            default:
+                break;
+            }
+        });
+        return execution;
+    }
+
+    void queue(const FixEncoder& message) {
+        if (buffer_size - output_size < FixEncoder::MAX_MESSAGE) {
+            flush();
+        }
+        output_size += message.finish(output.get() + output_size, buffer_size - output_size);
+    }
+
+    std::string comp_id;
+    std::string target_comp_id;
+    size_t buffer_size;
+    TcpSocket socket;
+    FixEncoder encoder;
+    std::unique_ptr<char[]> input;
+    std::unique_ptr<char[]> output;
+    size_t input_size = 0;
+    size_t output_size = 0;
+    uint64_t sent_seq_num = 0;
+    uint64_t request_ids = 0;
+};
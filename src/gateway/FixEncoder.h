@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "src/gateway/FixParser.h"
+
+/**
+ * @brief Builds one FIX 4.4 message at a time in a fixed scratch buffer and frames it into caller-provided memory
+ *
+ * The body (MsgType onwards) is written first, so BodyLength is known without reserving or shifting digits;
+ * finish() then writes BeginString, BodyLength, the body and the CheckSum in one pass. No allocation: the scratch
+ * buffer is a member, and the output is typically the free tail of a connection's preallocated send buffer.
+ * Callers keep bodies under MAX_BODY bytes (the gateway's messages are well below: a dozen numeric fields and comp
+ * ids of at most FIX_MAX_COMP_ID characters).
+ */
+class FixEncoder {
+  public:
+    static constexpr size_t MAX_BODY = 512;
+    static constexpr size_t MAX_MESSAGE = MAX_BODY + 32;
+
+    /**
+     * @brief Starts a message with the standard header fields after BodyLength
+     */
+    FixEncoder& begin(std::string_view msg_type, std::string_view sender, std::string_view target, uint64_t seq_num) {
+        length = 0;
+        return textField(FixTag::MSG_TYPE, msg_type)
+            .textField(FixTag::SENDER_COMP_ID, sender)
+            .textField(FixTag::TARGET_COMP_ID, target)
+            .uintField(FixTag::MSG_SEQ_NUM, seq_num);
+    }
+
+    FixEncoder& uintField(uint32_t tag, uint64_t value) {
+        writeTag(tag);
+        writeUint(value);
+        body[length++] = FIX_SOH;
+        return *this;
+    }
+
+    FixEncoder& charField(uint32_t tag, char value) {
+        writeTag(tag);
+        body[length++] = value;
+        body[length++] = FIX_SOH;
+        return *this;
+    }
+
+    FixEncoder& textField(uint32_t tag, std::string_view value) {
+        writeTag(tag);
+        std::memcpy(body.data() + length, value.data(), value.size());
+        length += value.size();
+        body[length++] = FIX_SOH;
+        return *this;
+    }
+
+    /**
+     * @brief Writes the framed message to `out`, returns its size, or 0 (and writes nothing) if it needs more than
+     * `capacity` bytes
+     */
+    size_t finish(char* out, size_t capacity) const {
+        char length_digits[20];
+        size_t length_size = formatUint(length, length_digits);
+        size_t header = FIX_BEGIN_STRING.size() + 2 + length_size + 1;
+        size_t total = header + length + FIX_TRAILER_SIZE;
+        if (total > capacity) {
+            return 0;
+        }
+        char* cursor = out;
+        std::memcpy(cursor, FIX_BEGIN_STRING.data(), FIX_BEGIN_STRING.size());
+        cursor += FIX_BEGIN_STRING.size();
+        *cursor++ = '9';
+        *cursor++ = '=';
+        std::memcpy(cursor, length_digits, length_size);
+        cursor += length_size;
+        *cursor++ = FIX_SOH;
+        std::memcpy(cursor, body.data(), length);
+        cursor += length;
+
+        uint8_t checksum = fixChecksum(out, header + length);
+        *cursor++ = '1';
+        *cursor++ = '0';
+        *cursor++ = '=';
+        *cursor++ = static_cast<char>('0' + checksum / 100);
+        *cursor++ = static_cast<char>('0' + checksum / 10 % 10);
+        *cursor++ = static_cast<char>('0' + checksum % 10);
+        *cursor = FIX_SOH;
+        return total;
+    }
+
+    size_t bodySize() const { return length; }
+
+  private:
+    // decimal digits of `value` into `out` (at least 20 bytes), returns how many
+    static size_t formatUint(uint64_t value, char* out) {
+        char reversed[20];
+        size_t count = 0;
+        do {
+            reversed[count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = reversed[count - 1 - i];
+        }
+        return count;
+    }
+
+    void writeTag(uint32_t tag) {
+        length += formatUint(tag, body.data() + length);
+        body[length++] = '=';
+    }
+
+    void writeUint(uint64_t value) { length += formatUint(value, body.data() + length); }
+
+    std::array<char, MAX_BODY> body;
+    size_t length = 0;
+};
@@ -0,0 +1,636 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "src/engines/MatchingEngine.h"
+#include "src/gateway/FixEncoder.h"
+#include "src/gateway/FixParser.h"
+#include "src/gateway/TcpSocket.h"
+#include "src/infrastructure/Thread.h"
+
+// engine order id = session owner << FIX_CL_ORD_ID_BITS | ClOrdID: every event routes back to its session by id alone
+inline constexpr unsigned FIX_CL_ORD_ID_BITS = 48;
+inline constexpr uint64_t FIX_MAX_CL_ORD_ID = (uint64_t{1} << FIX_CL_ORD_ID_BITS) - 1;
+
+struct FixGatewayConfig {
+    std::string address = "127.0.0.1";
+    uint16_t port = 0; // 0: any free port, see FixGateway::port()
+    std::string comp_id = "ENGINE";
+    size_t max_sessions = 16;
+    size_t receive_buffer = 64 * 1024; // per session, bounds the size of one inbound message
+    size_t send_buffer = 1 << 20;      // per session, a session whose pending reports outgrow it is disconnected
+    bool cancel_on_disconnect = true;
+};
+
+/**
+ * @brief FIX 4.4 order entry over TCP for one book: NewOrderSingle, OrderCancelRequest and OrderCancelReplaceRequest
+ * in, ExecutionReports and OrderCancelRejects out
+ *
+ * One thread owns the gateway and the book and busy-polls: poll() accepts connections, reads every session's
+ * non-blocking socket into its preallocated receive buffer, frames and parses the messages in place (see
+ * FixParser.h, no per-message allocation), runs each through MatchingEngine and encodes the resulting reports
+ * straight into the session's preallocated send buffer, which is written out once per poll. start() runs that loop
+ * on a thread of its own.
+ *
+ * Each SenderCompID trades as an owner of its own, bound at Logon and kept while the comp id is logged on or has
+ * orders resting, and orders are entered into the engine as owner << 48 | ClOrdID, so ClOrdIDs are numeric, below
+ * 2^48 and unique per SenderCompID. Only sessions logged on under that comp id hear about, cancel or replace its
+ * orders, whichever slot they connect to; a second Logon for a comp id that is already logged on is refused. An
+ * order keeps the ClOrdID it was entered with:
+ * OrigClOrdID of cancels and replaces names it, and every report about it carries it (the request's own ClOrdID is
+ * not used). Prices and quantities are integers in engine units and Symbol is not interpreted. Orders are limit
+ * (OrdType 2) or market (1); TimeInForce day (0, the default), immediate-or-cancel (3) or fill-or-kill (4) and
+ * ExecInst 6 (post-only) select the engine's OrderType, and a remainder that may not rest is reported as canceled.
+ * Session layer: a Logon must come first and is answered, Logout is answered and closes,
+ * heartbeats and other messages are ignored, inbound sequence numbers are not checked (no resend or gap fill).
+ * Reports carry LeavesQty but not CumQty. A disconnect cancels the session's resting orders unless
+ * `cancel_on_disconnect` is off, in which case they wait for their comp id to log on again.
+ */
+template <InstrumentTraits Traits = DefaultInstrument> class FixGateway {
+  public:
+    FixGateway(BasicOrderBook<Traits>& book, FixGatewayConfig config = {})
+        : book(book), config(std::move(config)),
+          listening(TcpSocket::listen(this->config.address, this->config.port)), sessions(this->config.max_sessions) {
+        for (Session& session : sessions) {
+            session.input = std::make_unique_for_overwrite<char[]>(this->config.receive_buffer);
+            session.output = std::make_unique_for_overwrite<char[]>(this->config.send_buffer);
+        }
+        owners.reserve(sessions.size());
+    }
+
+    ~FixGateway() { stop(); }
+
+    FixGateway(const FixGateway&) = delete;
+    FixGateway& operator=(const FixGateway&) = delete;
+
+    uint16_t port() const { return listening.localPort(); }
+
+    /**
+     * @brief Busy-polls on a new thread (pinned to `core` unless -1) until stop()
+     */
+    void start(int core = -1) {
+        running.store(true, std::memory_order_release);
+        poller = std::thread([this, core] {
+            if (core >= 0) {
+                pinCurrentThread(core);
+            }
+            for (uint64_t idle = 0; running.load(std::memory_order_acquire);) {
+                if (poll() > 0) {
+                    idle = 0;
+                } else if (++idle % 64 == 0) {
+                    // a client or load generator may share this core
+                    std::this_thread::yield();
+                } else {
+                    cpuRelax();
+                }
+            }
+        });
+    }
+
+    void stop() {
+        if (!poller.joinable()) {
+            return;
+        }
+        running.store(false, std::memory_order_release);
+        poller.join();
+    }
+
+    /**
+     * @brief One pass over the listening socket and every session, returns the number of messages handled
+     */
+    size_t poll() {
+        if (polls++ % ACCEPT_INTERVAL == 0) {
+            acceptConnections();
+        }
+        size_t handled = 0;
+        for (Session& session : sessions) {
+            if (!session.socket.valid()) {
+                continue;
+            }
+            handled += receive(session);
+            if (session.output_end > session.output_begin) {
+                flushOutput(session);
+            }
+            if (session.closing) {
+                disconnect(session);
+            }
+        }
+        return handled;
+    }
+
+    // ---------------------------------------------------------------- polling thread only (or once stopped)
+
+    size_t connectedSessions() const {
+        size_t connected = 0;
+        for (const Session& session : sessions) {
+            connected += session.socket.valid() ? 1 : 0;
+        }
+        return connected;
+    }
+
+    uint64_t messagesReceived() const { return received; }
+
+  private:
+    static constexpr uint64_t ACCEPT_INTERVAL = 64; // polls between accept() calls
+    // owners go in the bits above the ClOrdID and must fit the instrument's owner field
+    static constexpr size_t MAX_OWNERS = std::min<size_t>((size_t{1} << (64 - FIX_CL_ORD_ID_BITS)) - 1,
+                                                          std::numeric_limits<typename Traits::OwnerType>::max());
+
+    // ExecType / OrdStatus values
+    static constexpr char EXEC_NEW = '0';
+    static constexpr char EXEC_CANCELED = '4';
+    static constexpr char EXEC_REPLACED = '5';
+    static constexpr char EXEC_REJECTED = '8';
+    static constexpr char EXEC_TRADE = 'F';
+    static constexpr char STATUS_NEW = '0';
+    static constexpr char STATUS_PARTIALLY_FILLED = '1';
+    static constexpr char STATUS_FILLED = '2';
+    static constexpr char STATUS_CANCELED = '4';
+    static constexpr char STATUS_REJECTED = '8';
+
+    // OrdRejReason / CxlRejReason values
+    static constexpr uint32_t REJECT_OTHER = 99;
+    static constexpr uint32_t REJECT_EXCEEDS_LIMIT = 3;
+    static constexpr uint32_t REJECT_DUPLICATE = 6;
+    static constexpr uint32_t REJECT_UNSUPPORTED = 11;
+    static constexpr uint32_t REJECT_QUANTITY = 13;
+    static constexpr uint32_t CXL_REJECT_UNKNOWN_ORDER = 1;
+
+    struct Session {
+        TcpSocket socket;
+        std::unique_ptr<char[]> input;
+        std::unique_ptr<char[]> output;
+        size_t input_size = 0;
+        size_t output_begin = 0; // [output_begin, output_end) is encoded but not yet written to the socket
+        size_t output_end = 0;
+        uint64_t sent_seq_num = 0;
+        OwnerId owner = 0; // of the comp id logged on, 0 before Logon
+        bool logged_on = false;
+        bool closing = false; // disconnect at the end of this poll (protocol error, slow reader, logout)
+        char target[FIX_MAX_COMP_ID];
+        size_t target_size = 0;
+
+        std::string_view targetCompId() const { return {target, target_size}; }
+        bool reachable() const { return logged_on && !closing; }
+    };
+
+    /**
+     * @brief A SenderCompID's owner id (its index + 1) and the session logged on under it, if any
+     */
+    struct Owner {
+        char comp_id[FIX_MAX_COMP_ID];
+        size_t comp_id_size = 0;
+        Session* session = nullptr;
+
+        std::string_view compId() const { return {comp_id, comp_id_size}; }
+    };
+
+    /**
+     * @brief The message being run through the engine: who sent it and what it is about
+     */
+    struct Inflight {
+        Session* session = nullptr;
+        uint64_t cl_ord_id = 0;
+        Side side = Side::Buy;
+        Price price = 0;
+        Quantity quantity = 0; // entered quantity (new order) or new quantity (replace)
+        Quantity leaves = 0;   // of the aggressor, as its trades come in
+        bool replace = false;
+    };
+
+    // MatchingEngine listener: turns engine events into reports for the sessions involved
+    struct EngineEvents {
+        FixGateway& gateway;
+
+        void onTrade(OrderId, OrderId resting_id, Price price, Quantity quantity) {
+            gateway.trade(resting_id, price, quantity);
+        }
+        void onOrderAdded(const Order& order) { gateway.added(order); }
+        void onOrderCanceled(OrderId) { gateway.canceled(); }
+        void onOrdersCanceled(std::span<const Order> orders) { gateway.massCanceled(orders); }
+        void onOrderModified(const Order&) {} // only from replaces, reported up front
+        void onOrderRejected(const Order&, RejectReason reason) {
+            Inflight& inflight = gateway.inflight;
+            uint32_t code = REJECT_EXCEEDS_LIMIT;
+            std::string_view text;
+            if (reason == RejectReason::WouldCross) {
+                code = REJECT_OTHER;
+                text = "post-only order would trade";
+            } else if (reason == RejectReason::DuplicateOrder) {
+                code = REJECT_DUPLICATE;
+                text = "duplicate ClOrdID";
+            } else if (reason == RejectReason::OutsideInstrument) {
+                code = REJECT_OTHER;
+                text = "price or quantity outside the instrument";
+            }
+            gateway.executionReport(*inflight.session, inflight.cl_ord_id, EXEC_REJECTED, STATUS_REJECTED,
+                                    inflight.side, inflight.price, 0, 0, 0, code, text);
+        }
+        void onOrderExpired(const Order&) { gateway.canceled(); }
+    };
+
+    static OrderId engineId(OwnerId owner, uint64_t cl_ord_id) {
+        return static_cast<OrderId>(owner) << FIX_CL_ORD_ID_BITS | cl_ord_id;
+    }
+
+    static bool validClOrdId(uint64_t cl_ord_id) { return cl_ord_id != 0 && cl_ord_id <= FIX_MAX_CL_ORD_ID; }
+
+    // OrdType, TimeInForce and ExecInst as one engine order type, false for a combination the engine has no type for
+    static bool orderTypeOf(const FixMessage& message, OrderType& type) {
+        bool post_only = message.exec_inst.find('6') != std::string_view::npos;
+        bool day = message.time_in_force == 0 || message.time_in_force == '0';
+        if (message.ord_type == '1') {
+            type = OrderType::Market;
+            return !post_only && (day || message.time_in_force == '3');
+        }
+        if (message.ord_type != '2') {
+            return false;
+        }
+        if (day) {
+            type = post_only ? OrderType::PostOnly : OrderType::Limit;
+            return true;
+        }
+        type = message.time_in_force == '3' ? OrderType::ImmediateOrCancel : OrderType::FillOrKill;
+        return !post_only && (message.time_in_force == '3' || message.time_in_force == '4');
+    }
+
+    Session* sessionOf(OrderId id) {
+        size_t owner = static_cast<size_t>(id >> FIX_CL_ORD_ID_BITS) - 1;
+        Session* session = owner < owners.size() ? owners[owner].session : nullptr;
+        return session != nullptr && session->reachable() ? session : nullptr;
+    }
+
+    /**
+     * @brief The owner `comp_id` logs on as: the one it already has, unless a session holds it; else one left with
+     * no session and nothing resting, or a new one. nullptr if the Logon has to be refused.
+     */
+    Owner* bindOwner(std::string_view comp_id) {
+        Owner* vacant = nullptr;
+        for (Owner& owner : owners) {
+            if (owner.compId() == comp_id) {
+                return owner.session == nullptr ? &owner : nullptr;
+            }
+            if (vacant == nullptr && owner.session == nullptr && !book.hasOwned(ownerId(owner))) {
+                vacant = &owner;
+            }
+        }
+        if (vacant == nullptr) {
+            if (owners.size() == MAX_OWNERS) {
+                return nullptr;
+            }
+            vacant = &owners.emplace_back();
+        }
+        std::memcpy(vacant->comp_id, comp_id.data(), comp_id.size());
+        vacant->comp_id_size = comp_id.size();
+        return vacant;
+    }
+
+    OwnerId ownerId(const Owner& owner) const { return static_cast<OwnerId>(&owner - owners.data() + 1); }
+
+    // ---------------------------------------------------------------- connections
+
+    void acceptConnections() {
+        for (TcpSocket connection = listening.accept(); connection.valid(); connection = listening.accept()) {
+            for (Session& session : sessions) {
+                if (!session.socket.valid()) {
+                    session.socket = std::move(connection);
+                    break;
+                }
+            }
+            // all slots taken: the connection is closed as it goes out of scope
+        }
+    }
+
+    size_t receive(Session& session) {
+        char* free_space = session.input.get() + session.input_size;
+        ptrdiff_t bytes = session.socket.receive(free_space, config.receive_buffer - session.input_size);
+        if (bytes <= 0) {
+            session.closing |= bytes < 0;
+            return 0;
+        }
+        session.input_size += static_cast<size_t>(bytes);
+
+        size_t offset = 0;
+        size_t handled = 0;
+        while (!session.closing) {
+            std::string_view pending(session.input.get() + offset, session.input_size - offset);
+            size_t frame = fixFrameLength(pending);
+            if (frame == 0) {
+                break;
+            }
+            if (frame == FIX_MALFORMED) {
+                session.closing = true;
+                break;
+            }
+            handle(session, pending.substr(0, frame));
+            offset += frame;
+            ++handled;
+        }
+        // keep the incomplete tail for the next read; a message that can never fit is a protocol error
+        session.input_size -= offset;
+        std::memmove(session.input.get(), session.input.get() + offset, session.input_size);
+        session.closing |= session.input_size == config.receive_buffer;
+        return handled;
+    }
+
+    void flushOutput(Session& session) {
+        ptrdiff_t sent = session.socket.send(session.output.get() + session.output_begin,
+                                             session.output_end - session.output_begin);
+        if (sent < 0) {
+            session.closing = true;
+            return;
+        }
+        session.output_begin += static_cast<size_t>(sent);
+        if (session.output_begin == session.output_end) {
+            session.output_begin = session.output_end = 0;
+        }
+    }
+
+    void disconnect(Session& session) {
+        flushOutput(session); // best effort, e.g. the Logout reply
+        session.socket.close();
+        bool cancel = session.logged_on && config.cancel_on_disconnect;
+        OwnerId owner = session.owner;
+        if (owner != 0) {
+            owners[owner - 1].session = nullptr;
+        }
+        session.owner = 0;
+        session.input_size = session.output_begin = session.output_end = 0;
+        session.sent_seq_num = 0;
+        session.target_size = 0;
+        session.logged_on = session.closing = false;
+        if (cancel) {
+            EngineEvents events{*this};
+            MatchingEngine::massCancel(owner, book, events);
+        }
+    }
+
+    // ---------------------------------------------------------------- inbound
+
+    void handle(Session& session, std::string_view frame) {
+        ++received;
+        FixMessage message;
+        FixParseError error = parseFixMessage(frame, message);
+        if (error == FixParseError::BadChecksum || error == FixParseError::Malformed) {
+            session.closing = true;
+            return;
+        }
+        if (!session.logged_on) {
+            logon(session, message, error);
+            return;
+        }
+        if (message.msg_type.size() != 1) {
+            return;
+        }
+        switch (message.msg_type[0]) {
+        case 'D':
+            newOrder(session, message, error);
+            break;
+        case 'F':
+            cancel(session, message, error);
+            break;
+        case 'G':
+            replace(session, message, error);
+            break;
+        case '5':
+            send(session, encoder.begin("5", config.comp_id, session.targetCompId(), ++session.sent_seq_num));
+            session.closing = true;
+            break;
+        default:
+            break;
+        }
+    }
+
+    void logon(Session& session, const FixMessage& message, FixParseError error) {
+        if (error != FixParseError::None || !message.is("A") || message.sender_comp_id.empty() ||
+            message.sender_comp_id.size() > FIX_MAX_COMP_ID) {
+            session.closing = true;
+            return;
+        }
+        Owner* owner = bindOwner(message.sender_comp_id);
+        if (owner == nullptr) {
+            session.closing = true;
+            return;
+        }
+        owner->session = &session;
+        session.owner = ownerId(*owner);
+        std::memcpy(session.target, message.sender_comp_id.data(), message.sender_comp_id.size());
+        session.target_size = message.sender_comp_id.size();
+        session.logged_on = true;
+        send(session, encoder.begin("A", config.comp_id, session.targetCompId(), ++session.sent_seq_num)
+                          .uintField(FixTag::ENCRYPT_METHOD, 0)
+                          .uintField(FixTag::HEART_BT_INT, message.heartbeat_interval));
+    }
+
+    void newOrder(Session& session, const FixMessage& message, FixParseError error) {
+        uint64_t cl_ord_id = message.cl_ord_id;
+        Side side = message.side == '2' ? Side::Sell : Side::Buy;
+        auto reject = [&](uint32_t reason, std::string_view text) {
+            executionReport(session, cl_ord_id, EXEC_REJECTED, STATUS_REJECTED, side, message.price, 0, 0, 0, reason,
+                            text);
+        };
+        if (error != FixParseError::None) {
+            return reject(REJECT_OTHER, "invalid field value");
+        }
+        if (!message.has_cl_ord_id || !validClOrdId(cl_ord_id)) {
+            return reject(REJECT_OTHER, "ClOrdID must be in [1, 2^48)");
+        }
+        if (message.side != '1' && message.side != '2') {
+            return reject(REJECT_UNSUPPORTED, "unsupported Side");
+        }
+        OrderType type = OrderType::Limit;
+        if (!orderTypeOf(message, type)) {
+            return reject(REJECT_UNSUPPORTED, "unsupported OrdType, TimeInForce or ExecInst");
+        }
+        bool market = type == OrderType::Market;
+        if (!market && !message.has_price) {
+            return reject(REJECT_OTHER, "limit orders need a Price");
+        }
+        if (!message.has_quantity || message.quantity == 0 ||
+            message.quantity > std::numeric_limits<Quantity>::max()) {
+            return reject(REJECT_QUANTITY, "invalid OrderQty");
+        }
+        Order order(engineId(session.owner, cl_ord_id), static_cast<Quantity>(message.quantity),
+                    market ? 0 : message.price, side, session.owner);
+        // a market order has no price of its own: the instrument check runs on the lowest valid one
+        Order checked = order;
+        checked.price = market ? book.toPrice(1) : order.price;
+        if (!book.accepts(checked)) {
+            return reject(REJECT_OTHER, "price or quantity outside the instrument");
+        }
+
+        // a ClOrdID still resting comes back from the engine as a DuplicateOrder reject
+        inflight = {&session, cl_ord_id, side, order.price, order.quantity, order.quantity};
+        EngineEvents events{*this};
+        MatchingEngine::submitOrder(order, type, book, events);
+    }
+
+    void cancel(Session& session, const FixMessage& message, FixParseError error) {
+        auto* resting_order = referencedOrder(session, message, error, '1');
+        if (resting_order == nullptr) {
+            return;
+        }
+        Order order = book.toOrder(*resting_order);
+        inflight = {&session, message.orig_cl_ord_id, order.side, order.price, order.quantity, 0};
+        EngineEvents events{*this};
+        // the order is already found: its handle spares the engine a second id lookup
+        MatchingEngine::cancelOrder(book.handleOf(*resting_order), book, events);
+    }
+
+    void replace(Session& session, const FixMessage& message, FixParseError error) {
+        auto* resting_order = referencedOrder(session, message, error, '2');
+        if (resting_order == nullptr) {
+            return;
+        }
+        Order order = book.toOrder(*resting_order);
+        Order replacement(order.id, static_cast<Quantity>(message.quantity), message.price, order.side, order.owner);
+        if (!message.has_price || !message.has_quantity || message.quantity == 0 ||
+            message.quantity > std::numeric_limits<Quantity>::max() || !book.accepts(replacement)) {
+            cancelReject(session, message, '2', REJECT_OTHER);
+            return;
+        }
+        inflight = {&session, message.orig_cl_ord_id, order.side, replacement.price, replacement.quantity,
+                    replacement.quantity, true};
+        // the engine may re-match the order before it rests again: acknowledge first, fills follow
+        executionReport(session, inflight.cl_ord_id, EXEC_REPLACED, STATUS_NEW, inflight.side, inflight.price,
+                        inflight.quantity);
+        EngineEvents events{*this};
+        MatchingEngine::modifyOrder(book.handleOf(*resting_order), replacement.price, replacement.quantity, book,
+                                    events);
+    }
+
+    // the session's resting order a cancel or replace refers to, nullptr (and an OrderCancelReject sent) if none
+    auto* referencedOrder(Session& session, const FixMessage& message, FixParseError error, char response_to) {
+        decltype(book.find(0)) resting_order = nullptr;
+        if (error == FixParseError::None && message.has_orig_cl_ord_id && validClOrdId(message.orig_cl_ord_id)) {
+            resting_order = book.find(engineId(session.owner, message.orig_cl_ord_id));
+        }
+        if (resting_order == nullptr) {
+            cancelReject(session, message, response_to, CXL_REJECT_UNKNOWN_ORDER);
+        }
+        return resting_order;
+    }
+
+    // ---------------------------------------------------------------- engine events
+
+    void trade(OrderId resting_id, Price price, Quantity quantity) {
+        inflight.leaves -= quantity;
+        executionReport(*inflight.session, inflight.cl_ord_id, EXEC_TRADE,
+                        inflight.leaves == 0 ? STATUS_FILLED : STATUS_PARTIALLY_FILLED, inflight.side, inflight.price,
+                        inflight.leaves, price, quantity);
+
+        if (Session* resting_session = sessionOf(resting_id)) {
+            // the fill is already applied: a resting order that is gone was filled completely
+            const auto* resting_order = book.find(resting_id);
+            Quantity leaves = resting_order == nullptr ? 0 : book.toOrder(*resting_order).quantity;
+            Side side = inflight.side == Side::Buy ? Side::Sell : Side::Buy;
+            executionReport(*resting_session, resting_id & FIX_MAX_CL_ORD_ID, EXEC_TRADE,
+                            leaves == 0 ? STATUS_FILLED : STATUS_PARTIALLY_FILLED, side, price, leaves, price,
+                            quantity);
+        }
+    }
+
+    void added(const Order& order) {
+        if (inflight.replace) {
+            return;
+        }
+        executionReport(*inflight.session, inflight.cl_ord_id, EXEC_NEW,
+                        order.quantity < inflight.quantity ? STATUS_PARTIALLY_FILLED : STATUS_NEW, order.side,
+                        order.price, order.quantity);
+    }
+
+    void canceled() {
+        executionReport(*inflight.session, inflight.cl_ord_id, EXEC_CANCELED, STATUS_CANCELED, inflight.side,
+                        inflight.price, 0);
+    }
+
+    void massCanceled(std::span<const Order> orders) {
+        for (const Order& order : orders) {
+            if (Session* session = sessionOf(order.id)) {
+                executionReport(*session, order.id & FIX_MAX_CL_ORD_ID, EXEC_CANCELED, STATUS_CANCELED, order.side,
+                                order.price, 0);
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------- outbound
+
+    void executionReport(Session& session, uint64_t cl_ord_id, char exec_type, char ord_status, Side side, Price price,
+                         Quantity leaves, Price last_price = 0, Quantity last_quantity = 0, uint32_t reject_reason = 0,
+                         std::string_view text = {}) {
+        if (!session.reachable()) {
+            return;
+        }
+        encoder.begin("8", config.comp_id, session.targetCompId(), ++session.sent_seq_num)
+            .uintField(FixTag::ORDER_ID, engineId(session.owner, cl_ord_id))
+            .uintField(FixTag::CL_ORD_ID, cl_ord_id)
+            .uintField(FixTag::EXEC_ID, ++exec_ids)
+            .charField(FixTag::EXEC_TYPE, exec_type)
+            .charField(FixTag::ORD_STATUS, ord_status)
+            .charField(FixTag::SIDE, side == Side::Buy ? '1' : '2')
+            .uintField(FixTag::PRICE, price)
+            .uintField(FixTag::LEAVES_QTY, leaves);
+        if (last_quantity > 0) {
+            encoder.uintField(FixTag::LAST_QTY, last_quantity).uintField(FixTag::LAST_PX, last_price);
+        }
+        if (exec_type == EXEC_REJECTED) {
+            encoder.uintField(FixTag::ORD_REJ_REASON, reject_reason);
+        }
+        if (!text.empty()) {
+            encoder.textField(FixTag::TEXT, text);
+        }
+        send(session, encoder);
+    }
+
+    void cancelReject(Session& session, const FixMessage& message, char response_to, uint32_t reason) {
+        send(session, encoder.begin("9", config.comp_id, session.targetCompId(), ++session.sent_seq_num)
+                          .uintField(FixTag::ORDER_ID, 0)
+                          .uintField(FixTag::CL_ORD_ID, message.cl_ord_id)
+                          .uintField(FixTag::ORIG_CL_ORD_ID, message.orig_cl_ord_id)
+                          .charField(FixTag::ORD_STATUS, STATUS_REJECTED)
+                          .charField(FixTag::CXL_REJ_RESPONSE_TO, response_to)
+                          .uintField(FixTag::CXL_REJ_REASON, reason));
+    }
+
+    // frames the encoded message into the session's send buffer; a session that cannot take it is disconnected
+    void send(Session& session, const FixEncoder& message) {
+        if (config.send_buffer - session.output_end < FixEncoder::MAX_MESSAGE) {
+            flushOutput(session);
+            size_t pending = session.output_end - session.output_begin;
+            std::memmove(session.output.get(), session.output.get() + session.output_begin, pending);
+            session.output_begin = 0;
+            session.output_end = pending;
+            if (config.send_buffer - pending < FixEncoder::MAX_MESSAGE) {
+                session.closing = true;
+                return;
+            }
+        }
+        session.output_end +=
+            message.finish(session.output.get() + session.output_end, config.send_buffer - session.output_end);
+    }
+
+    BasicOrderBook<Traits>& book;
+    FixGatewayConfig config;
+    TcpSocket listening;
+    std::vector<Session> sessions;
+    std::vector<Owner> owners; // never shrinks: an owner id stays with its comp id while it has orders resting
+    FixEncoder encoder;
+    Inflight inflight;
+    uint64_t exec_ids = 0;
+    uint64_t received = 0;
+    uint64_t polls = 0;
+    std::thread poller;
+    std::atomic<bool> running{false};
+};
@@ -0,0 +1,340 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+inline constexpr char FIX_SOH = '\x01';
+inline constexpr std::string_view FIX_BEGIN_STRING = "8=FIX.4.4\x01";
+inline constexpr size_t FIX_TRAILER_SIZE = 7; // "10=" + 3 digits + SOH
+inline constexpr size_t FIX_MALFORMED = static_cast<size_t>(-1);
+inline constexpr size_t FIX_MAX_COMP_ID = 16; // longest SenderCompID/TargetCompID the gateway accepts
+
+/**
+ * @brief Tag numbers of the FIX 4.4 fields the gateway reads or writes
+ */
+struct FixTag {
+    static constexpr uint32_t BEGIN_STRING = 8;
+    static constexpr uint32_t BODY_LENGTH = 9;
+    static constexpr uint32_t CHECKSUM = 10;
+    static constexpr uint32_t CL_ORD_ID = 11;
+    static constexpr uint32_t CUM_QTY = 14;
+    static constexpr uint32_t EXEC_ID = 17;
+    static constexpr uint32_t EXEC_INST = 18;
+    static constexpr uint32_t LAST_PX = 31;
+    static constexpr uint32_t LAST_QTY = 32;
+    static constexpr uint32_t MSG_SEQ_NUM = 34;
+    static constexpr uint32_t MSG_TYPE = 35;
+    static constexpr uint32_t ORDER_ID = 37;
+    static constexpr uint32_t ORDER_QTY = 38;
+    static constexpr uint32_t ORD_STATUS = 39;
+    static constexpr uint32_t ORD_TYPE = 40;
+    static constexpr uint32_t ORIG_CL_ORD_ID = 41;
+    static constexpr uint32_t PRICE = 44;
+    static constexpr uint32_t REF_SEQ_NUM = 45;
+    static constexpr uint32_t SENDER_COMP_ID = 49;
+    static constexpr uint32_t SIDE = 54;
+    static constexpr uint32_t SYMBOL = 55;
+    static constexpr uint32_t TARGET_COMP_ID = 56;
+    static constexpr uint32_t TEXT = 58;
+    static constexpr uint32_t TIME_IN_FORCE = 59;
+    static constexpr uint32_t ENCRYPT_METHOD = 98;
+    static constexpr uint32_t CXL_REJ_REASON = 102;
+    static constexpr uint32_t ORD_REJ_REASON = 103;
+    static constexpr uint32_t HEART_BT_INT = 108;
+    static constexpr uint32_t EXEC_TYPE = 150;
+    static constexpr uint32_t LEAVES_QTY = 151;
+    static constexpr uint32_t CXL_REJ_RESPONSE_TO = 434;
+};
+
+/**
+ * @brief Which delimiter scan forEachFixField uses; Vector falls back to Scalar on targets without SSE2
+ */
+enum class FixScan : uint8_t { Scalar, Vector };
+
+// bit i set where block[i] is SOH or '='
+#if defined(__AVX2__)
+inline constexpr size_t FIX_SCAN_BLOCK = 32;
+inline uint32_t fixDelimiterMask(const char* block) {
+    __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    __m256i delimiters = _mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(FIX_SOH)),
+                                         _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('=')));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(delimiters));
+}
+#elif defined(__SSE2__)
+inline constexpr size_t FIX_SCAN_BLOCK = 16;
+inline uint32_t fixDelimiterMask(const char* block) {
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+    __m128i delimiters = _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(FIX_SOH)),
+                                      _mm_cmpeq_epi8(bytes, _mm_set1_epi8('=')));
+    return static_cast<uint32_t>(_mm_movemask_epi8(delimiters));
+}
+#endif
+
+/**
+ * @brief Turns delimiter positions into fields: the first '=' of a field ends its tag, a SOH ends its value
+ */
+template <typename Visitor> struct FixFieldSplitter {
+    const char* data;
+    Visitor& visit;
+    size_t field_start = 0;
+    size_t equals = 0; // one past the field's first '=', 0 while there is none
+    bool malformed = false;
+
+    void delimiter(size_t position) {
+        if (data[position] == '=') {
+            if (equals == 0) {
+                equals = position + 1;
+            }
+            return;
+        }
+        // SOH
+        size_t tag_length = equals == 0 ? 0 : equals - 1 - field_start;
+        if (tag_length == 0 || tag_length > 9) {
+            malformed = true;
+            return;
+        }
+        uint32_t tag = 0;
+        for (size_t i = field_start; i < equals - 1; ++i) {
+            auto digit = static_cast<uint32_t>(data[i] - '0');
+            if (digit > 9) {
+                malformed = true;
+                return;
+            }
+            tag = tag * 10 + digit;
+        }
+        visit(tag, std::string_view(data + equals, position - equals));
+        field_start = position + 1;
+        equals = 0;
+    }
+};
+
+/**
+ * @brief Splits `message` into tag=value fields in place and calls `visit(uint32_t tag, std::string_view value)` for
+ * each, in order; false (after visiting the fields before it) if a field has no tag, a non-numeric tag or no SOH
+ *
+ * The Vector scan compares 32 (AVX2) or 16 (SSE2) bytes at a time against SOH and '=' and only looks at the
+ * positions that matched, so the cost is per field rather than per byte. Values are views into `message`: nothing
+ * is copied or allocated. An '=' inside a value is part of the value.
+ */
+template <FixScan Scan = FixScan::Vector, typename Visitor>
+bool forEachFixField(std::string_view message, Visitor&& visit) {
+    FixFieldSplitter<Visitor> splitter{message.data(), visit};
+    size_t position = 0;
+#if defined(__SSE2__)
+    if constexpr (Scan == FixScan::Vector) {
+        for (; position + FIX_SCAN_BLOCK <= message.size(); position += FIX_SCAN_BLOCK) {
+            for (uint32_t mask = fixDelimiterMask(message.data() + position); mask != 0; mask &= mask - 1) {
+                splitter.delimiter(position + static_cast<size_t>(__builtin_ctz(mask)));
+                if (splitter.malformed) [[unlikely]] {
+                    return false;
+                }
+            }
+        }
+    }
+#endif
+    for (; position < message.size(); ++position) {
+        if (message[position] == FIX_SOH || message[position] == '=') {
+            splitter.delimiter(position);
+            if (splitter.malformed) [[unlikely]] {
+                return false;
+            }
+        }
+    }
+    return splitter.field_start == message.size();
+}
+
+/**
+ * @brief FIX checksum: sum of the bytes mod 256 (16 bytes per step with SSE2)
+ */
+inline uint8_t fixChecksum(const char* data, size_t size) {
+    uint32_t sum = 0;
+    size_t position = 0;
+#if defined(__SSE2__)
+    __m128i total = _mm_setzero_si128();
+    for (; position + 16 <= size; position += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+        total = _mm_add_epi64(total, _mm_sad_epu8(bytes, _mm_setzero_si128()));
+    }
+    sum = static_cast<uint32_t>(_mm_cvtsi128_si32(total) + _mm_cvtsi128_si32(_mm_srli_si128(total, 8)));
+#endif
+    for (; position < size; ++position) {
+        sum += static_cast<unsigned char>(data[position]);
+    }
+    return static_cast<uint8_t>(sum);
+}
+
+/**
+ * @brief Parses an unsigned decimal (1 to 19 digits, nothing else), false otherwise
+ */
+inline bool parseFixUint(std::string_view value, uint64_t& out) {
+    if (value.empty() || value.size() > 19) {
+        return false;
+    }
+    uint64_t result = 0;
+    for (char c : value) {
+        auto digit = static_cast<uint64_t>(c - '0');
+        if (digit > 9) {
+            return false;
+        }
+        result = result * 10 + digit;
+    }
+    out = result;
+    return true;
+}
+
+/**
+ * @brief Length of the complete message at the start of `buffer`: 0 if more bytes are needed, FIX_MALFORMED if the
+ * bytes cannot start a FIX 4.4 message (wrong BeginString, bad BodyLength, trailer not where BodyLength says)
+ */
+inline size_t fixFrameLength(std::string_view buffer) {
+    size_t prefix = std::min(buffer.size(), FIX_BEGIN_STRING.size());
+    if (buffer.substr(0, prefix) != FIX_BEGIN_STRING.substr(0, prefix)) {
+        return FIX_MALFORMED;
+    }
+    if (buffer.size() < FIX_BEGIN_STRING.size() + 2) {
+        return 0;
+    }
+    size_t position = FIX_BEGIN_STRING.size();
+    if (buffer[position] != '9' || buffer[position + 1] != '=') {
+        return FIX_MALFORMED;
+    }
+    position += 2;
+    size_t body_length = 0;
+    size_t digits_start = position;
+    for (; position < buffer.size() && buffer[position] != FIX_SOH; ++position) {
+        auto digit = static_cast<size_t>(buffer[position] - '0');
+        if (digit > 9 || position - digits_start == 6) {
+            return FIX_MALFORMED;
+        }
+        body_length = body_length * 10 + digit;
+    }
+    if (position == buffer.size()) {
+        return 0;
+    }
+    if (position == digits_start) {
+        return FIX_MALFORMED;
+    }
+    size_t total = position + 1 + body_length + FIX_TRAILER_SIZE;
+    if (buffer.size() < total) {
+        return 0;
+    }
+    std::string_view trailer = buffer.substr(total - FIX_TRAILER_SIZE, FIX_TRAILER_SIZE);
+    if (trailer.substr(0, 3) != "10=" || trailer.back() != FIX_SOH) {
+        return FIX_MALFORMED;
+    }
+    return total;
+}
+
+enum class FixParseError : uint8_t {
+    None,
+    BadChecksum,
+    Malformed, // a field without tag or SOH
+    BadValue,  // a field the gateway reads has a value it cannot use; FixMessage::bad_tag says which
+};
+
+/**
+ * @brief The fields of an order-entry or session message, as read from one frame (views into the frame)
+ */
+struct FixMessage {
+    std::string_view msg_type;
+    std::string_view sender_comp_id;
+    std::string_view symbol;
+    std::string_view exec_inst; // space-separated instructions, '6' = post-only (participate don't initiate)
+    uint64_t seq_num = 0;
+    uint64_t cl_ord_id = 0;
+    uint64_t orig_cl_ord_id = 0;
+    uint64_t price = 0;
+    uint64_t quantity = 0;
+    uint64_t heartbeat_interval = 0;
+    char side = 0;          // '1' buy, '2' sell
+    char ord_type = 0;      // '1' market, '2' limit
+    char time_in_force = 0; // '0' day (also when absent), '3' immediate-or-cancel, '4' fill-or-kill
+    bool has_cl_ord_id = false;
+    bool has_orig_cl_ord_id = false;
+    bool has_price = false;
+    bool has_quantity = false;
+    uint32_t bad_tag = 0;
+
+    bool is(std::string_view type) const { return msg_type == type; }
+};
+
+/**
+ * @brief Verifies the checksum of a complete frame (see fixFrameLength) and reads its fields into `message`
+ *
+ * Prices and quantities must be plain unsigned integers (engine units); ClOrdID/OrigClOrdID must be numeric.
+ */
+template <FixScan Scan = FixScan::Vector> FixParseError parseFixMessage(std::string_view frame, FixMessage& message) {
+    size_t checksum_at = frame.size() - FIX_TRAILER_SIZE;
+    uint64_t declared = 0;
+    if (!parseFixUint(frame.substr(checksum_at + 3, 3), declared) ||
+        declared != fixChecksum(frame.data(), checksum_at)) {
+        return FixParseError::BadChecksum;
+    }
+
+    message = FixMessage{};
+    auto number = [&](uint32_t tag, std::string_view value, uint64_t& out) {
+        if (!parseFixUint(value, out) && message.bad_tag == 0) {
+            message.bad_tag = tag;
+        }
+    };
+    bool well_formed = forEachFixField<Scan>(frame, [&](uint32_t tag, std::string_view value) {
+        switch (tag) {
+        case FixTag::MSG_TYPE:
+            message.msg_type = value;
+            break;
+        case FixTag::MSG_SEQ_NUM:
+            number(tag, value, message.seq_num);
+            break;
+        case FixTag::SENDER_COMP_ID:
+            message.sender_comp_id = value;
+            break;
+        case FixTag::CL_ORD_ID:
+            number(tag, value, message.cl_ord_id);
+            message.has_cl_ord_id = true;
+            break;
+        case FixTag::ORIG_CL_ORD_ID:
+            number(tag, value, message.orig_cl_ord_id);
+            message.has_orig_cl_ord_id = true;
+            break;
+        case FixTag::PRICE:
+            number(tag, value, message.price);
+            message.has_price = true;
+            break;
+        case FixTag::ORDER_QTY:
+            number(tag, value, message.quantity);
+            message.has_quantity = true;
+            break;
+        case FixTag::SIDE:
+            message.side = value.size() == 1 ? value[0] : '?';
+            break;
+        case FixTag::ORD_TYPE:
+            message.ord_type = value.size() == 1 ? value[0] : '?';
+            break;
+        case FixTag::TIME_IN_FORCE:
+            message.time_in_force = value.size() == 1 ? value[0] : '?';
+            break;
+        case FixTag::EXEC_INST:
+            message.exec_inst = value;
+            break;
+        case FixTag::SYMBOL:
+            message.symbol = value;
+            break;
+        case FixTag::HEART_BT_INT:
+            number(tag, value, message.heartbeat_interval);
+            break;
+        default:
+            break;
+        }
+    });
+    if (!well_formed) {
+        return FixParseError::Malformed;
+    }
+    return message.bad_tag == 0 ? FixParseError::None : FixParseError::BadValue;
+}
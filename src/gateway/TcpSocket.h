@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/**
+ * @brief Owning, move-only TCP socket for the gateway and its client: IPv4, non-blocking, Nagle off
+ *
+ * Setup (listen, connect) throws std::system_error; the data path never throws. receive() and send() return the
+ * byte count, 0 when nothing could be transferred right now (would block), and -1 once the connection is gone
+ * (peer closed, reset).
+ */
+class TcpSocket {
+  public:
+    TcpSocket() = default;
+    explicit TcpSocket(int fd) : fd(fd) {}
+    ~TcpSocket() { close(); }
+
+    TcpSocket(TcpSocket&& other) noexcept : fd(std::exchange(other.fd, -1)) {}
+    TcpSocket& operator=(TcpSocket&& other) noexcept {
+        if (this != &other) {
+            close();
+            fd = std::exchange(other.fd, -1);
+        }
+        return *this;
+    }
+    TcpSocket(const TcpSocket&) = delete;
+    TcpSocket& operator=(const TcpSocket&) = delete;
+
+    /**
+     * @brief Non-blocking listening socket on `address`:`port` (port 0: any free port, see localPort())
+     */
+    static TcpSocket listen(const std::string& address, uint16_t port, int backlog = 64) {
+        TcpSocket socket(::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0));
+        socket.check(socket.fd, "socket");
+        int reuse = 1;
+        ::setsockopt(socket.fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        sockaddr_in endpoint = socket.resolve(address, port);
+        socket.check(::bind(socket.fd, reinterpret_cast<sockaddr*>(&endpoint), sizeof(endpoint)), "bind " + address);
+        socket.check(::listen(socket.fd, backlog), "listen " + address);
+        return socket;
+    }
+
+    /**
+     * @brief Connects (blocking), then switches the connection to non-blocking
+     */
+    static TcpSocket connect(const std::string& address, uint16_t port) {
+        TcpSocket socket(::socket(AF_INET, SOCK_STREAM, 0));
+        socket.check(socket.fd, "socket");
+        sockaddr_in endpoint = socket.resolve(address, port);
+        socket.check(::connect(socket.fd, reinterpret_cast<sockaddr*>(&endpoint), sizeof(endpoint)),
+                     "connect " + address + ":" + std::to_string(port));
+        socket.check(::fcntl(socket.fd, F_SETFL, ::fcntl(socket.fd, F_GETFL) | O_NONBLOCK), "fcntl");
+        socket.noDelay();
+        return socket;
+    }
+
+    /**
+     * @brief The next pending connection (non-blocking, Nagle off), or an invalid socket if there is none
+     */
+    TcpSocket accept() const {
+        TcpSocket connection(::accept4(fd, nullptr, nullptr, SOCK_NONBLOCK));
+        if (connection.valid()) {
+            connection.noDelay();
+        }
+        return connection;
+    }
+
+    ptrdiff_t receive(char* data, size_t size) const {
+        ssize_t received = ::recv(fd, data, size, 0);
+        if (received > 0) {
+            return received;
+        }
+        if (received == 0) {
+            return -1;
+        }
+        return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ? 0 : -1;
+    }
+
+    ptrdiff_t send(const char* data, size_t size) const {
+        ssize_t sent = ::send(fd, data, size, MSG_NOSIGNAL);
+        if (sent >= 0) {
+            return sent;
+        }
+        return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ? 0 : -1;
+    }
+
+    uint16_t localPort() const {
+        sockaddr_in endpoint{};
+        socklen_t size = sizeof(endpoint);
+        ::getsockname(fd, reinterpret_cast<sockaddr*>(&endpoint), &size);
+        return ntohs(endpoint.sin_port);
+    }
+
+    bool valid() const { return fd >= 0; }
+
+    void close() {
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+
+  private:
+    void noDelay() {
+        int enabled = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled));
+    }
+
+    sockaddr_in resolve(const std::string& address, uint16_t port) {
+        sockaddr_in endpoint{};
+        endpoint.sin_family = AF_INET;
+        endpoint.sin_port = htons(port);
+        if (::inet_pton(AF_INET, address.c_str(), &endpoint.sin_addr) != 1) {
+            errno = EINVAL;
+            check(-1, "address " + address);
+        }
+        return endpoint;
+    }
+
+    void check(int result, const std::string& what) {
+        if (result < 0) {
+            int error = errno;
+            close();
+            throw std::system_error(error, std::generic_category(), what);
+        }
+    }
+
+    int fd = -1;
+};
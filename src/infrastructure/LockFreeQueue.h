@@ -1,49 +1,149 @@
 #pragma once
+#include <algorithm>
 #include <atomic>
-#include <vector>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <utility>
 
+/**
+ * @brief Bounded single-producer / single-consumer ring
+ *
+ * The capacity is rounded up to a power of two and the head/tail counters only ever grow, so a slot is
+ * `counter & mask` and all slots are usable. Each side keeps a private copy of the other side's counter and only
+ * re-reads the shared one when the ring looks full (producer) or empty (consumer), so in steady state each side
+ * touches nothing but its own cache line and the slots.
+ */
 template <typename T> class LockFreeQueue {
 
   public:
-    LockFreeQueue(size_t size) {
-        buffer.resize(size);
-        head.store(0);
-        tail.store(0);
+    LockFreeQueue(size_t size)
+        : capacity(std::bit_ceil(std::max<size_t>(size, 2))), mask(capacity - 1),
+          buffer(static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t(CACHE_LINE)))) {}
+
+    ~LockFreeQueue() {
+        size_t current_tail = consumer.tail.load(std::memory_order_relaxed);
+        size_t current_head = producer.head.load(std::memory_order_relaxed);
+        for (; current_tail != current_head; ++current_tail) {
+            std::destroy_at(&buffer[current_tail & mask]);
+        }
+        ::operator delete(buffer, std::align_val_t(CACHE_LINE));
     }
 
-    bool push(const T& item) {
-        size_t current_head = head.load(std::memory_order_relaxed);
-        size_t next_head = (current_head + 1) % buffer.size();
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+    // ---------------------------------------------------------------- producer side
+
+    bool push(const T& item) { return emplace(item); }
 
-        if (next_head == tail.load(std::memory_order_acquire)) {
-            return false;
+    template <typename... Args> bool emplace(Args&&... args) {
+        size_t current_head = producer.head.load(std::memory_order_relaxed);
+        if (current_head - producer.cached_tail == capacity) [[unlikely]] {
+            producer.cached_tail = consumer.tail.load(std::memory_order_acquire);
+            if (current_head - producer.cached_tail == capacity) {
+                return false;
+            }
         }
 
-        buffer[current_head] = item;
+        std::construct_at(&buffer[current_head & mask], std::forward<Args>(args)...);
 
-        head.store(next_head, std::memory_order_release);
+        producer.head.store(current_head + 1, std::memory_order_release);
         return true;
     }
 
-    bool pop(T& item) {
-        size_t current_tail = tail.load(std::memory_order_relaxed);
+    /**
+     * @brief Pushes as many items as fit, publishing them with a single release store; returns how many were pushed
+     */
+    size_t pushBatch(std::span<const T> items) {
+        size_t current_head = producer.head.load(std::memory_order_relaxed);
+        size_t free_slots = capacity - (current_head - producer.cached_tail);
+        if (free_slots < items.size()) {
+            producer.cached_tail = consumer.tail.load(std::memory_order_acquire);
+            free_slots = capacity - (current_head - producer.cached_tail);
+        }
 
-        if (current_tail == head.load(std::memory_order_acquire)) {
-            return false;
+        size_t count = std::min(free_slots, items.size());
+        for (size_t i = 0; i < count; ++i) {
+            std::construct_at(&buffer[(current_head + i) & mask], items[i]);
         }
-        item = buffer[current_tail];
 
-        size_t next_tail = (current_tail + 1) % buffer.size();
+        producer.head.store(current_head + count, std::memory_order_release);
+        return count;
+    }
+
+    // ---------------------------------------------------------------- consumer side
+
+    bool pop(T& item) {
+        return consume([&item](T& front) { item = std::move(front); });
+    }
+
+    /**
+     * @brief Hands the front item to `handler` in place (no copy out of the ring), then releases its slot
+     */
+    template <typename Handler> bool consume(Handler&& handler) {
+        size_t current_tail = consumer.tail.load(std::memory_order_relaxed);
+        if (current_tail == consumer.cached_head) [[unlikely]] {
+            consumer.cached_head = producer.head.load(std::memory_order_acquire);
+            if (current_tail == consumer.cached_head) {
+                return false;
+            }
+        }
 
-        tail.store(next_tail, std::memory_order_release);
+        T& front = buffer[current_tail & mask];
+        handler(front);
+        std::destroy_at(&front);
 
+        consumer.tail.store(current_tail + 1, std::memory_order_release);
         return true;
     }
 
+    /**
+     * @brief Hands up to `max_items` items to `handler` in place, releasing all their slots with a single store
+     */
+    template <typename Handler> size_t consumeBatch(Handler&& handler, size_t max_items = SIZE_MAX) {
+        size_t current_tail = consumer.tail.load(std::memory_order_relaxed);
+        if (consumer.cached_head - current_tail < max_items) {
+            consumer.cached_head = producer.head.load(std::memory_order_acquire);
+        }
+
+        size_t count = std::min(consumer.cached_head - current_tail, max_items);
+        for (size_t i = 0; i < count; ++i) {
+            T& item = buffer[(current_tail + i) & mask];
+            handler(item);
+            std::destroy_at(&item);
+        }
+
+        if (count > 0) {
+            consumer.tail.store(current_tail + count, std::memory_order_release);
+        }
+        return count;
+    }
+
+    size_t popBatch(std::span<T> items) {
+        size_t count = 0;
+        return consumeBatch([&](T& item) { items[count++] = std::move(item); }, items.size());
+    }
+
+    size_t maxSize() const { return capacity; }
+
   private:
-    std::vector<T> buffer;
+    static constexpr size_t CACHE_LINE = 64;
+
+    const size_t capacity;
+    const size_t mask;
+    T* const buffer;
+
+    // cache line separation (we make sure that producer and consumer state live on differents cache lines)
+    struct alignas(CACHE_LINE) ProducerState {
+        std::atomic<size_t> head{0};
+        size_t cached_tail = 0;
+    } producer;
 
-    // cache line separation (we make sure that these two variables are on differents cache lines)
-    alignas(64) std::atomic<size_t> head;
-    alignas(64) std::atomic<size_t> tail;
-};
\ No newline at end of file
+    struct alignas(CACHE_LINE) ConsumerState {
+        std::atomic<size_t> tail{0};
+        size_t cached_head = 0;
+    } consumer;
+};
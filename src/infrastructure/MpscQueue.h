@@ -0,0 +1,111 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**
+ * @brief Bounded multi-producer / single-consumer ring (sequence-numbered slots)
+ *
+ * Producers claim a slot with one CAS on the shared head, fill it, then publish it through the slot's own sequence
+ * number; the consumer never touches the head, it only waits for the sequence of its next slot. A slow producer
+ * delays the consumer only for its own slot: slots claimed after it may already be filled but are consumed in order.
+ */
+template <typename T> class MpscQueue {
+
+  public:
+    MpscQueue(size_t size)
+        : capacity(std::bit_ceil(std::max<size_t>(size, 2))), mask(capacity - 1),
+          slots(static_cast<Slot*>(::operator new(capacity * sizeof(Slot), std::align_val_t(CACHE_LINE)))) {
+        for (size_t i = 0; i < capacity; ++i) {
+            std::construct_at(&slots[i].sequence, i);
+        }
+    }
+
+    ~MpscQueue() {
+        while (consume([](T&) {})) {
+        }
+        for (size_t i = 0; i < capacity; ++i) {
+            std::destroy_at(&slots[i].sequence);
+        }
+        ::operator delete(slots, std::align_val_t(CACHE_LINE));
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    // ---------------------------------------------------------------- producer side (any thread)
+
+    bool push(const T& item) { return emplace(item); }
+
+    template <typename... Args> bool emplace(Args&&... args) {
+        size_t position = head.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &slots[position & mask];
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            auto lag = static_cast<std::ptrdiff_t>(sequence - position);
+            if (lag == 0) {
+                if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (lag < 0) {
+                return false; // the consumer hasn't released this slot yet: full
+            } else {
+                position = head.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::construct_at(slot->item(), std::forward<Args>(args)...);
+        slot->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // ---------------------------------------------------------------- consumer side (one thread)
+
+    bool pop(T& item) {
+        return consume([&item](T& front) { item = std::move(front); });
+    }
+
+    template <typename Handler> bool consume(Handler&& handler) {
+        Slot& slot = slots[tail & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != tail + 1) {
+            return false;
+        }
+        handler(*slot.item());
+        std::destroy_at(slot.item());
+        slot.sequence.store(tail + capacity, std::memory_order_release);
+        ++tail;
+        return true;
+    }
+
+    template <typename Handler> size_t consumeBatch(Handler&& handler, size_t max_items = SIZE_MAX) {
+        size_t count = 0;
+        while (count < max_items && consume(handler)) {
+            ++count;
+        }
+        return count;
+    }
+
+    size_t maxSize() const { return capacity; }
+
+  private:
+    static constexpr size_t CACHE_LINE = 64;
+
+    struct Slot {
+        std::atomic<size_t> sequence; // == position: free for producers, == position + 1: filled
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* item() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    const size_t capacity;
+    const size_t mask;
+    Slot* const slots;
+
+    alignas(CACHE_LINE) std::atomic<size_t> head{0};
+    alignas(CACHE_LINE) size_t tail = 0; // consumer only
+};
@@ -1,32 +1,183 @@
 #pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
-#include <stdexcept>
-#include <vector>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
 
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "src/infrastructure/Prefault.h"
+
+struct PoolOptions {
+    // objects committed (mapped and, if requested, prefaulted) at construction, the rest is committed chunk by chunk
+    // on demand; SIZE_MAX commits the whole capacity up front
+    size_t initial_capacity = SIZE_MAX;
+    // back chunks with 2 MiB pages: explicit hugetlb pages if the system has some reserved, transparent huge pages
+    // otherwise
+    bool huge_pages = false;
+    // touch every page of a chunk when it is committed so the hot path never takes a page fault
+    bool prefault = true;
+};
+
+/**
+ * @brief Fixed-capacity pool with index addressing and an intrusive free list
+ *
+ * The whole capacity is reserved as one range of virtual memory at construction, but only committed chunk by
+ * chunk, so growing never moves live objects and `pool[index]` stays a single add. Freed slots hold the index of
+ * the next free slot in their first bytes: no side vector, no allocation after construction.
+ * Exhaustion is not an error: allocate() returns nullptr and the caller decides (the engine rejects the order).
+ */
 template <typename T> class ObjectPool {
-  private:
-    std::vector<T> store;
-    std::vector<size_t> free_indices;
+    static_assert(sizeof(T) >= sizeof(uint32_t), "freed slots store the free list link");
+    static_assert(std::is_trivially_destructible_v<T>, "the pool never runs destructors");
 
   public:
-    ObjectPool(size_t size) {
-        store.resize(size);
-        for (size_t i = 0; i < size; ++i) {
-            free_indices.push_back(i);
+    static constexpr uint32_t NIL = UINT32_MAX;
+    static constexpr size_t CHUNK_BYTES = 2 * 1024 * 1024;
+
+    explicit ObjectPool(size_t capacity, PoolOptions options = {}) : slot_capacity(capacity), options(options) {
+        assert(capacity < NIL);
+        size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        size_t bytes = std::max(capacity * sizeof(T), sizeof(T));
+        chunk_bytes = std::min(CHUNK_BYTES, roundUp(bytes, page));
+        reserved_bytes = roundUp(bytes, chunk_bytes);
+
+        // over-reserve one chunk so the committed range can start on a chunk (huge page) boundary
+        void* reservation = mmap(nullptr, reserved_bytes + chunk_bytes, PROT_NONE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (reservation == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        mapping = static_cast<char*>(reservation);
+        mapping_bytes = reserved_bytes + chunk_bytes;
+        store = reinterpret_cast<T*>(roundUp(reinterpret_cast<uintptr_t>(mapping), chunk_bytes));
+
+        size_t initial = std::min(options.initial_capacity, capacity);
+        while (committed < initial && grow()) {
         }
     }
 
+    ~ObjectPool() {
+        if (mapping != nullptr) {
+            munmap(mapping, mapping_bytes);
+        }
+    }
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    ObjectPool(ObjectPool&& other) noexcept
+        : store(other.store), slot_capacity(other.slot_capacity), committed(other.committed),
+          committed_bytes(other.committed_bytes), fresh(other.fresh),
+          free_head(other.free_head), options(other.options), chunk_bytes(other.chunk_bytes),
+          reserved_bytes(other.reserved_bytes), mapping(std::exchange(other.mapping, nullptr)),
+          mapping_bytes(other.mapping_bytes) {}
+
     T* allocate() {
-        if (free_indices.empty()) [[unlikely]] {
-            throw std::runtime_error("Pool exhausted!");
+        uint32_t index;
+        if (free_head != NIL) [[likely]] {
+            index = free_head;
+            std::memcpy(&free_head, &store[index], sizeof(uint32_t));
+        } else if (fresh < committed || grow()) {
+            index = static_cast<uint32_t>(fresh++);
+        } else [[unlikely]] {
+            return nullptr;
         }
-        size_t index = free_indices.back();
-        free_indices.pop_back();
-        return &store[index];
+        return new (&store[index]) T;
     }
 
     void deallocate(T* object) {
-        size_t index = object - &store[0];
-        free_indices.push_back(index);
+        uint32_t index = static_cast<uint32_t>(indexOf(object));
+        std::memcpy(static_cast<void*>(object), &free_head, sizeof(uint32_t));
+        free_head = index;
+    }
+
+    T& operator[](size_t index) { return store[index]; }
+    size_t indexOf(const T* object) const { return object - store; }
+
+    size_t capacity() const { return slot_capacity; }
+    size_t committedCapacity() const { return committed; }
+    // number of slots ever handed out: live objects never exceeded it
+    size_t highWaterMark() const { return fresh; }
+
+    /**
+     * @brief Commits the rest of the capacity and makes all of it resident (see prefaultRange), pinned with mlock if
+     * `lock`; false if a chunk could not be committed or the lock was refused
+     */
+    bool prefault(bool lock) {
+        while (grow()) {
+        }
+        return (committed == slot_capacity) & prefaultRange(store, committed_bytes, lock);
+    }
+
+    // forgets every slot handed out so far, which must all have been released: the pool hands out slots from the
+    // first one again, as if unused, and its memory stays committed
+    void reset() {
+        fresh = 0;
+        free_head = NIL;
+    }
+
+  private:
+    static size_t roundUp(size_t value, size_t alignment) { return (value + alignment - 1) / alignment * alignment; }
+
+    /**
+     * @brief Commits the next chunk of the reservation, false once the capacity is fully committed
+     */
+    bool grow() {
+        if (committed >= slot_capacity) {
+            return false;
+        }
+        char* chunk = reinterpret_cast<char*>(store) + committed_bytes;
+        if (!commitChunk(chunk)) [[unlikely]] {
+            return false;
+        }
+        committed_bytes += chunk_bytes;
+        committed = std::min(slot_capacity, committed_bytes / sizeof(T));
+        return true;
     }
-};
\ No newline at end of file
+
+    bool commitChunk(char* chunk) {
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED;
+#ifdef MAP_HUGETLB
+        if (options.huge_pages && chunk_bytes == CHUNK_BYTES) {
+            int huge_flags = flags | MAP_HUGETLB | (options.prefault ? MAP_POPULATE : 0);
+            if (mmap(chunk, chunk_bytes, PROT_READ | PROT_WRITE, huge_flags, -1, 0) != MAP_FAILED) {
+                return true;
+            }
+        }
+#endif
+        if (mmap(chunk, chunk_bytes, PROT_READ | PROT_WRITE, flags, -1, 0) == MAP_FAILED) {
+            return false;
+        }
+#ifdef MADV_HUGEPAGE
+        if (options.huge_pages) {
+            madvise(chunk, chunk_bytes, MADV_HUGEPAGE);
+        }
+#endif
+        if (options.prefault) {
+            size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            for (size_t offset = 0; offset < chunk_bytes; offset += page) {
+                static_cast<volatile char*>(chunk)[offset] = 0;
+            }
+        }
+        return true;
+    }
+
+    T* store;
+    size_t slot_capacity;
+    size_t committed = 0; // slots backed by read/write memory
+    size_t committed_bytes = 0;
+    size_t fresh = 0;     // slots below this index have been handed out at least once
+    uint32_t free_head = NIL;
+
+    PoolOptions options;
+    size_t chunk_bytes;
+    size_t reserved_bytes;
+    char* mapping = nullptr;
+    size_t mapping_bytes = 0;
+};
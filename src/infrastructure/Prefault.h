@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+/**
+ * @brief Makes [address, address + bytes) resident before the hot path needs it: every page is written with its own
+ * first byte (backed by a private page, contents unchanged), then, with `lock`, pinned with mlock so it is never
+ * paged out again. Returns false if locking was asked for and refused (RLIMIT_MEMLOCK, no CAP_IPC_LOCK); the pages
+ * are resident either way.
+ *
+ * Only for memory no other thread writes meanwhile: the touch is a plain read-modify-write.
+ */
+inline bool prefaultRange(void* address, size_t bytes, bool lock) {
+    const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto* begin = static_cast<volatile char*>(address);
+    // the first byte of the range, then the first byte of every later page it covers
+    for (size_t offset = 0; offset < bytes; offset += page - reinterpret_cast<uintptr_t>(begin + offset) % page) {
+        begin[offset] = begin[offset];
+    }
+    return !lock || mlock(address, bytes) == 0;
+}
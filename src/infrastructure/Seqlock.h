@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "src/infrastructure/Thread.h"
+
+/**
+ * @brief Single-writer sequence lock around a trivially copyable value, for any number of concurrent readers
+ *
+ * The writer bumps the sequence to odd, stores the value, then bumps it back to even: it never waits and never
+ * learns how many readers there are. A reader copies the value between two reads of the sequence and keeps the copy
+ * if both are the same even number, i.e. no store overlapped it. Readers never write shared memory, so they do not
+ * disturb each other or the writer beyond sharing its cache lines.
+ *
+ * The value is held as relaxed atomic 64-bit words (the data race-free form of the seqlock), and the sequence
+ * shares the first cache line with it: a small value is one line for the writer to dirty and for a reader to fetch.
+ */
+template <typename T> class alignas(64) Seqlock {
+    static_assert(std::is_trivially_copyable_v<T>, "readers copy the value while it may be overwritten");
+
+  public:
+    /**
+     * @brief Publishes `value` (writer thread only)
+     */
+    void store(const T& value) {
+        uint64_t words[WORDS] = {};
+        std::memcpy(words, &value, sizeof(T));
+        uint64_t sequence = sequence_number.load(std::memory_order_relaxed);
+        sequence_number.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < WORDS; ++i) {
+            data[i].store(words[i], std::memory_order_relaxed);
+        }
+        sequence_number.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief One attempt at a consistent copy: false, leaving `value` untouched, if a store was in progress or
+     * overlapped the copy. Bounded, so wait-free.
+     */
+    bool tryLoad(T& value) const {
+        uint64_t before = sequence_number.load(std::memory_order_acquire);
+        if (before & 1) {
+            return false;
+        }
+        uint64_t words[WORDS];
+        for (size_t i = 0; i < WORDS; ++i) {
+            words[i] = data[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_number.load(std::memory_order_relaxed) != before) {
+            return false;
+        }
+        std::memcpy(&value, words, sizeof(T));
+        return true;
+    }
+
+    /**
+     * @brief A consistent copy of the latest value, retrying while stores overlap (only a writer that publishes
+     * without pause can hold a reader back)
+     */
+    T load() const {
+        T value;
+        while (!tryLoad(value)) {
+            cpuRelax();
+        }
+        return value;
+    }
+
+    // number of stores so far; a reader can poll it to see whether anything new was published
+    uint64_t version() const { return sequence_number.load(std::memory_order_acquire) / 2; }
+
+  private:
+    static constexpr size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    std::atomic<uint64_t> sequence_number{0};
+    std::atomic<uint64_t> data[WORDS] = {}; // a default T (all zero bytes) until the first store
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "src/infrastructure/Seqlock.h"
+#include "src/marketdata/MarketDataBuilder.h"
+#include "src/orderbook/OrderBook.h"
+
+// levels per side of a BookView unless specified
+inline constexpr size_t BOOK_VIEW_DEPTH = 10;
+
+/**
+ * @brief Price and aggregate quantity of one level
+ */
+struct DepthLevel {
+    Price price = 0;
+    Quantity quantity = 0;
+
+    bool operator==(const DepthLevel&) const = default;
+};
+
+/**
+ * @brief The best `Depth` levels of each side, best first; only the first bid_count / ask_count entries are set
+ */
+template <size_t Depth = BOOK_VIEW_DEPTH> struct BookDepth {
+    uint32_t bid_count = 0;
+    uint32_t ask_count = 0;
+    std::array<DepthLevel, Depth> bids = {};
+    std::array<DepthLevel, Depth> asks = {};
+
+    bool operator==(const BookDepth&) const = default;
+};
+
+/**
+ * @brief Top of book and top-`Depth` levels of one book, readable from any thread while the matching thread runs
+ *
+ * The thread that owns the book calls publish() whenever readers should catch up (after a command or a batch); any
+ * number of other threads call top() / depth() or their single-attempt try forms. Both views sit behind their own
+ * Seqlock on their own cache lines, so a top-of-book reader fetches one line and never waits for a depth store.
+ * The writer never waits for readers, and a publish that changes nothing stores nothing: readers polling an idle
+ * book keep their cache lines and the writer keeps its own.
+ */
+template <size_t Depth = BOOK_VIEW_DEPTH> class BookView {
+    static_assert(Depth > 0);
+
+  public:
+    /**
+     * @brief Reads the book's best levels and publishes what changed (owner thread only): O(Depth) occupied-level
+     * lookups, independent of the number of orders
+     */
+    template <InstrumentTraits Traits> void publish(BasicOrderBook<Traits>& book) {
+        using PriceLadder = typename BasicOrderBook<Traits>::PriceLadder;
+        BookDepth<Depth> depth;
+        // max_bid is 0 without bids, prevOccupied is npos past the last one
+        for (Price tick = book.max_bid; tick != PriceLadder::npos && tick > 0 && depth.bid_count < Depth;
+             tick = book.bids.prevOccupied(tick - 1)) {
+            depth.bids[depth.bid_count++] = {book.toPrice(tick), book.bids.quantityAt(tick)};
+        }
+        for (Price tick = book.hasAsks() ? book.min_ask : PriceLadder::npos;
+             tick != PriceLadder::npos && depth.ask_count < Depth; tick = book.asks.nextOccupied(tick + 1)) {
+            depth.asks[depth.ask_count++] = {book.toPrice(tick), book.asks.quantityAt(tick)};
+        }
+
+        TopOfBook top{depth.bids[0].price, depth.bids[0].quantity, depth.asks[0].price, depth.asks[0].quantity};
+        if (top != last_top) {
+            top_of_book.store(top);
+            last_top = top;
+        }
+        if (depth != last_depth) {
+            book_depth.store(depth);
+            last_depth = depth;
+        }
+    }
+
+    TopOfBook top() const { return top_of_book.load(); }
+    BookDepth<Depth> depth() const { return book_depth.load(); }
+
+    // wait-free: false, leaving the argument untouched, if a publish overlapped the read
+    bool tryTop(TopOfBook& top) const { return top_of_book.tryLoad(top); }
+    bool tryDepth(BookDepth<Depth>& depth) const { return book_depth.tryLoad(depth); }
+
+    // number of changed views published so far, to poll for news without copying
+    uint64_t topVersion() const { return top_of_book.version(); }
+    uint64_t depthVersion() const { return book_depth.version(); }
+
+  private:
+    // the owner's copies of what it last published: the change check touches no shared cache line
+    TopOfBook last_top;
+    BookDepth<Depth> last_depth;
+
+    Seqlock<TopOfBook> top_of_book;
+    Seqlock<BookDepth<Depth>> book_depth;
+};
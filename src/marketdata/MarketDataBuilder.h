@@ -0,0 +1,167 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "src/domain/Order.h"
+#include "src/orderbook/OrderBook.h"
+
+/**
+ * @brief New aggregate quantity of one price level; 0 means the level is gone
+ */
+struct LevelUpdate {
+    Price price;
+    Quantity quantity;
+    Side side;
+};
+
+/**
+ * @brief Best bid and ask with their aggregate quantities; an empty side has price and quantity 0
+ */
+struct TopOfBook {
+    Price bid_price = 0;
+    Quantity bid_quantity = 0;
+    Price ask_price = 0;
+    Quantity ask_quantity = 0;
+
+    bool operator==(const TopOfBook&) const = default;
+};
+
+struct MarketDataBatch {
+    std::span<const LevelUpdate> levels; // one entry per level touched since the previous publish, first touch first
+    TopOfBook top;
+    bool top_changed;
+};
+
+/**
+ * @brief Incremental, conflated L2 depth for one book
+ *
+ * The engine reports every level whose aggregate quantity may have changed (onLevelChanged, see
+ * MarketDataListener); the builder only remembers which levels are dirty, once each, in a small open-addressing
+ * set. publish() then reads the current Level::getTotalQuantity() of each dirty level: ten orders added and
+ * cancelled at one price within a batch cost one update, and publishing costs O(levels touched), not O(orders).
+ * Nothing is allocated once the buffers have grown to the largest batch seen.
+ */
+class MarketDataBuilder {
+  public:
+    explicit MarketDataBuilder(size_t expected_levels_per_batch = 256)
+        : table(std::bit_ceil(std::max<size_t>(expected_levels_per_batch * 2, 16)), EMPTY), mask(table.size() - 1) {
+        updates.reserve(expected_levels_per_batch);
+        slots.reserve(expected_levels_per_batch);
+    }
+
+    void markDirty(Side side, Price price) {
+        uint64_t key = (price << 1) | static_cast<uint64_t>(side);
+        size_t i = slotOf(key);
+        for (; table[i] != EMPTY; i = (i + 1) & mask) {
+            if (table[i] == key) {
+                return;
+            }
+        }
+        table[i] = key;
+        slots.push_back(i);
+        updates.push_back(LevelUpdate{price, 0, side});
+        if (slots.size() * 2 > table.size()) [[unlikely]] {
+            grow();
+        }
+    }
+
+    size_t dirtyLevels() const { return updates.size(); }
+
+    /**
+     * @brief Conflated updates since the previous publish plus the current top of book; the span stays valid until
+     * the next publish()
+     */
+    MarketDataBatch publish(OrderBook& book) {
+        for (LevelUpdate& update : updates) {
+            update.quantity = (update.side == Side::Buy ? book.bids : book.asks).quantityAt(update.price);
+        }
+        for (size_t slot : slots) {
+            table[slot] = EMPTY;
+        }
+        slots.clear();
+        std::swap(published, updates);
+        updates.clear();
+
+        TopOfBook top;
+        if (book.hasBids()) {
+            top.bid_price = book.bestBid();
+            top.bid_quantity = book.bestBidLevel().getTotalQuantity();
+        }
+        if (book.hasAsks()) {
+            top.ask_price = book.bestAsk();
+            top.ask_quantity = book.bestAskLevel().getTotalQuantity();
+        }
+        bool top_changed = top != last_top;
+        last_top = top;
+        return MarketDataBatch{published, top, top_changed};
+    }
+
+  private:
+    static constexpr uint64_t EMPTY = UINT64_MAX;
+
+    size_t slotOf(uint64_t key) const { return (key * 0x9E3779B97F4A7C15ull) >> (64 - std::countr_zero(table.size())); }
+
+    void grow() {
+        table.assign(table.size() * 2, EMPTY);
+        mask = table.size() - 1;
+        for (size_t k = 0; k < updates.size(); ++k) {
+            uint64_t key = (updates[k].price << 1) | static_cast<uint64_t>(updates[k].side);
+            size_t i = slotOf(key);
+            while (table[i] != EMPTY) {
+                i = (i + 1) & mask;
+            }
+            table[i] = key;
+            slots[k] = i;
+        }
+    }
+
+    std::vector<uint64_t> table; // (price << 1 | side) of every dirty level, EMPTY otherwise
+    size_t mask;
+    std::vector<size_t> slots;   // table slot of each dirty level, to clear the table in O(dirty)
+    std::vector<LevelUpdate> updates;
+    std::vector<LevelUpdate> published;
+    TopOfBook last_top;
+};
+
+/**
+ * @brief Listener adapter: forwards every event to `listener` and feeds level changes to `market_data`
+ */
+template <typename Listener> struct MarketDataListener {
+    Listener& listener;
+    MarketDataBuilder& market_data;
+
+    void onTrade(OrderId incoming_id, OrderId resting_id, Price price, Quantity qty) {
+        listener.onTrade(incoming_id, resting_id, price, qty);
+    }
+    void onOrderAdded(const Order& order) { listener.onOrderAdded(order); }
+    void onOrderAdded(const Order& order, OrderHandle handle)
+        requires requires(Listener& inner) { inner.onOrderAdded(order, handle); }
+    {
+        listener.onOrderAdded(order, handle);
+    }
+    void onOrderCanceled(OrderId id) { listener.onOrderCanceled(id); }
+    void onOrdersCanceled(std::span<const Order> orders)
+        requires requires(Listener& inner) { inner.onOrdersCanceled(orders); }
+    {
+        listener.onOrdersCanceled(orders);
+    }
+    void onOrderModified(const Order& order) { listener.onOrderModified(order); }
+    void onOrderRejected(const Order& order, RejectReason reason)
+        requires requires(Listener& inner) { inner.onOrderRejected(order, reason); }
+    {
+        listener.onOrderRejected(order, reason);
+    }
+    void onOrderExpired(const Order& order)
+        requires requires(Listener& inner) { inner.onOrderExpired(order); }
+    {
+        listener.onOrderExpired(order);
+    }
+
+    void onLevelChanged(Side side, Price price) { market_data.markDirty(side, price); }
+};
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Fixed-size log-linear (HDR-style) histogram of 64-bit values
+ *
+ * Values below 2^SIGNIFICANT_BITS get one bucket each; above that every power of two is split into 2^(BITS-1) equal
+ * buckets, so a value is stored with a relative error below 2^-(BITS-1) (< 1.6%) over the whole 64-bit range, in
+ * a flat ~30 KB array: recording is a count-leading-zeros, two shifts and an increment, and never allocates.
+ * Histograms recorded on different threads or runs are combined with `merge`.
+ */
+class LatencyHistogram {
+  public:
+    static constexpr unsigned SIGNIFICANT_BITS = 7;
+    static constexpr uint64_t SUB_BUCKETS = uint64_t{1} << SIGNIFICANT_BITS;
+    static constexpr uint64_t HALF_BUCKETS = SUB_BUCKETS / 2;
+    static constexpr size_t BUCKETS = (64 - SIGNIFICANT_BITS) * HALF_BUCKETS + SUB_BUCKETS;
+
+    void record(uint64_t value) {
+        ++counts[bucket(value)];
+        ++total;
+        sum += value;
+        min_value = std::min(min_value, value);
+        max_value = std::max(max_value, value);
+    }
+
+    void merge(const LatencyHistogram& other) {
+        for (size_t i = 0; i < BUCKETS; ++i) {
+            counts[i] += other.counts[i];
+        }
+        total += other.total;
+        sum += other.sum;
+        min_value = std::min(min_value, other.min_value);
+        max_value = std::max(max_value, other.max_value);
+    }
+
+    void reset() { *this = LatencyHistogram(); }
+
+    uint64_t count() const { return total; }
+    uint64_t min() const { return total == 0 ? 0 : min_value; }
+    uint64_t max() const { return max_value; }
+    double mean() const { return total == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(total); }
+
+    /**
+     * @brief Smallest recorded-bucket upper bound that covers `percent`% of the values (0 when empty)
+     *
+     * Reporting the bucket's upper bound (capped by the exact max) errs on the pessimistic side, as SLAs want.
+     */
+    uint64_t percentile(double percent) const {
+        if (total == 0) {
+            return 0;
+        }
+        auto rank = static_cast<uint64_t>(std::ceil(percent / 100.0 * static_cast<double>(total)));
+        rank = std::clamp<uint64_t>(rank, 1, total);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKETS; ++i) {
+            seen += counts[i];
+            if (seen >= rank) {
+                return std::min(upperBound(i), max_value);
+            }
+        }
+        return max_value;
+    }
+
+    static size_t bucket(uint64_t value) {
+        if (value < SUB_BUCKETS) {
+            return value;
+        }
+        unsigned shift = std::bit_width(value) - SIGNIFICANT_BITS; // >= 1
+        return shift * HALF_BUCKETS + (value >> shift);
+    }
+
+    static uint64_t lowerBound(size_t index) {
+        if (index < SUB_BUCKETS) {
+            return index;
+        }
+        unsigned shift = static_cast<unsigned>(index / HALF_BUCKETS - 1);
+        return (index - shift * HALF_BUCKETS) << shift;
+    }
+
+    static uint64_t upperBound(size_t index) {
+        if (index < SUB_BUCKETS) {
+            return index;
+        }
+        unsigned shift = static_cast<unsigned>(index / HALF_BUCKETS - 1);
+        uint64_t mantissa = index - shift * HALF_BUCKETS;
+        return ((mantissa + 1) << shift) - 1; // wraps to UINT64_MAX for the last bucket
+    }
+
+  private:
+    std::array<uint64_t, BUCKETS> counts{};
+    uint64_t total = 0;
+    uint64_t sum = 0;
+    uint64_t min_value = std::numeric_limits<uint64_t>::max();
+    uint64_t max_value = 0;
+};
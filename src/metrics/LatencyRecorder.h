@@ -0,0 +1,103 @@
+#pragma once
+
+#include <array>
+#include <cstdio>
+#include <ostream>
+
+#include "src/engines/MatchingEngine.h"
+#include "src/metrics/LatencyHistogram.h"
+#include "src/metrics/TscClock.h"
+
+/**
+ * @brief One latency histogram (in TSC ticks) per engine operation
+ *
+ * Wraps the `MatchingEngine` entry points: each call is timed with `TscClock` and recorded under its command type,
+ * so it works the same in a benchmark loop and in an embedded engine's dispatch loop. A recorder belongs to one
+ * thread; per-thread (or per-run) recorders are combined with `merge` before reporting. The cost is two fenced TSC
+ * reads and a histogram increment per operation, roughly 20-40 ns on current x86.
+ */
+class LatencyRecorder {
+  public:
+    static constexpr size_t OPERATIONS = 3;
+
+    template <typename MatchingEngineListener>
+    void submitOrder(const Order& order, OrderBook& book, MatchingEngineListener& listener) {
+        uint64_t begin = TscClock::start();
+        MatchingEngine::submitOrder(order, book, listener);
+        histograms[index(CommandType::Submit)].record(TscClock::stop() - begin);
+    }
+
+    template <typename MatchingEngineListener>
+    void cancelOrder(OrderId order_id, OrderBook& book, MatchingEngineListener& listener) {
+        uint64_t begin = TscClock::start();
+        MatchingEngine::cancelOrder(order_id, book, listener);
+        histograms[index(CommandType::Cancel)].record(TscClock::stop() - begin);
+    }
+
+    template <typename MatchingEngineListener>
+    void modifyOrder(OrderId order_id, Price price, Quantity quantity, OrderBook& book,
+                     MatchingEngineListener& listener) {
+        uint64_t begin = TscClock::start();
+        MatchingEngine::modifyOrder(order_id, price, quantity, book, listener);
+        histograms[index(CommandType::Modify)].record(TscClock::stop() - begin);
+    }
+
+    template <typename MatchingEngineListener>
+    void process(const Command& command, OrderBook& book, MatchingEngineListener& listener) {
+        uint64_t begin = TscClock::start();
+        MatchingEngine::process(command, book, listener);
+        histograms[index(command.type)].record(TscClock::stop() - begin);
+    }
+
+    const LatencyHistogram& histogram(CommandType type) const { return histograms[index(type)]; }
+
+    /**
+     * @brief All operations together
+     */
+    LatencyHistogram combined() const {
+        LatencyHistogram all;
+        for (const LatencyHistogram& histogram : histograms) {
+            all.merge(histogram);
+        }
+        return all;
+    }
+
+    void merge(const LatencyRecorder& other) {
+        for (size_t i = 0; i < OPERATIONS; ++i) {
+            histograms[i].merge(other.histograms[i]);
+        }
+    }
+
+    void reset() {
+        for (LatencyHistogram& histogram : histograms) {
+            histogram.reset();
+        }
+    }
+
+    /**
+     * @brief Percentile table in nanoseconds, one row per operation plus the total
+     */
+    void print(std::ostream& out, const TscClock& clock) const {
+        char line[160];
+        std::snprintf(line, sizeof(line), "%-8s %12s %8s %8s %8s %8s %8s %8s %10s\n", "op", "count", "mean", "p50",
+                      "p90", "p99", "p99.9", "p99.99", "max");
+        out << line;
+        auto row = [&](const char* name, const LatencyHistogram& histogram) {
+            std::snprintf(line, sizeof(line), "%-8s %12llu %8.0f %8.0f %8.0f %8.0f %8.0f %8.0f %10.0f\n", name,
+                          static_cast<unsigned long long>(histogram.count()), clock.nanos(1) * histogram.mean(),
+                          clock.nanos(histogram.percentile(50)), clock.nanos(histogram.percentile(90)),
+                          clock.nanos(histogram.percentile(99)), clock.nanos(histogram.percentile(99.9)),
+                          clock.nanos(histogram.percentile(99.99)), clock.nanos(histogram.max()));
+            out << line;
+        };
+        row("submit", histogram(CommandType::Submit));
+        row("cancel", histogram(CommandType::Cancel));
+        row("modify", histogram(CommandType::Modify));
+        row("all", combined());
+    }
+
+  private:
+    static size_t index(CommandType type) { return static_cast<size_t>(type); }
+
+    std::array<LatencyHistogram, OPERATIONS> histograms;
+};
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "src/metrics/TscClock.h"
+
+/**
+ * @brief Hot-path phases timed by an enabled probe (nested: a Fill includes its PoolRelease, IndexErase and
+ * CursorScan)
+ */
+enum class ProbePhase : uint8_t {
+    Match,        // one incoming order through the matching loop, resting remainder included
+    Fill,         // OrderBook::fillAskOrder/fillBidOrder
+    Insert,       // OrderBook::insertBid/insertAsk
+    Remove,       // OrderBook::removeBid/removeAsk (cancels and repricing modifies)
+    CursorScan,   // incrementAskCursor/decrementBidCursor
+    PoolAllocate, // resting order slot allocation
+    PoolRelease,  // resting order slot release
+    IndexInsert,  // id index insert
+    IndexErase,   // id index erase
+    Relink,       // OrderBook::relinkBid/relinkAsk (in-place repricing and size-up modifies)
+};
+inline constexpr size_t PROBE_PHASES = 10;
+
+enum class ProbeCounter : uint8_t {
+    LevelsWalked, // ticks the best bid/ask cursors moved while scanning for the next occupied level
+    Fills,        // resting orders traded against
+    Aggressors,   // incoming orders that traded at least once
+};
+inline constexpr size_t PROBE_COUNTERS = 3;
+
+enum class ProbePeak : uint8_t {
+    FillsPerAggressor, // most fills caused by a single incoming order
+    PoolHighWater,     // most resting order slots ever handed out
+};
+inline constexpr size_t PROBE_PEAKS = 2;
+
+/**
+ * @brief Plain copy of probe data, as taken by a reader
+ */
+struct ProbeSnapshot {
+    std::array<uint64_t, PROBE_PHASES> cycles{};
+    std::array<uint64_t, PROBE_PHASES> calls{};
+    std::array<uint64_t, PROBE_COUNTERS> counters{};
+    std::array<uint64_t, PROBE_PEAKS> peaks{};
+
+    uint64_t phaseCycles(ProbePhase phase) const { return cycles[static_cast<size_t>(phase)]; }
+    uint64_t phaseCalls(ProbePhase phase) const { return calls[static_cast<size_t>(phase)]; }
+    uint64_t counter(ProbeCounter counter) const { return counters[static_cast<size_t>(counter)]; }
+    uint64_t peak(ProbePeak peak) const { return peaks[static_cast<size_t>(peak)]; }
+
+    ProbeSnapshot& operator+=(const ProbeSnapshot& other) {
+        for (size_t i = 0; i < PROBE_PHASES; ++i) {
+            cycles[i] += other.cycles[i];
+            calls[i] += other.calls[i];
+        }
+        for (size_t i = 0; i < PROBE_COUNTERS; ++i) {
+            counters[i] += other.counters[i];
+        }
+        for (size_t i = 0; i < PROBE_PEAKS; ++i) {
+            peaks[i] = std::max(peaks[i], other.peaks[i]);
+        }
+        return *this;
+    }
+};
+
+/**
+ * @brief One thread's probe data: written only by its owner, readable at any time by others
+ *
+ * Every field is a relaxed atomic updated with a plain load + store (no read-modify-write, the owner is the only
+ * writer), so recording costs the same as with plain integers and a reader never blocks the writer. A snapshot is
+ * consistent per field, not across fields.
+ */
+struct alignas(64) ProbeBuffer {
+    std::array<std::atomic<uint64_t>, PROBE_PHASES> cycles{};
+    std::array<std::atomic<uint64_t>, PROBE_PHASES> calls{};
+    std::array<std::atomic<uint64_t>, PROBE_COUNTERS> counters{};
+    std::array<std::atomic<uint64_t>, PROBE_PEAKS> peaks{};
+
+    static void add(std::atomic<uint64_t>& field, uint64_t value) {
+        field.store(field.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    static void raise(std::atomic<uint64_t>& field, uint64_t value) {
+        if (value > field.load(std::memory_order_relaxed)) {
+            field.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    void clear() {
+        for (size_t i = 0; i < PROBE_PHASES; ++i) {
+            cycles[i].store(0, std::memory_order_relaxed);
+            calls[i].store(0, std::memory_order_relaxed);
+        }
+        for (auto& field : counters) {
+            field.store(0, std::memory_order_relaxed);
+        }
+        for (auto& field : peaks) {
+            field.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    ProbeSnapshot snapshot() const {
+        ProbeSnapshot copy;
+        for (size_t i = 0; i < PROBE_PHASES; ++i) {
+            copy.cycles[i] = cycles[i].load(std::memory_order_relaxed);
+            copy.calls[i] = calls[i].load(std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < PROBE_COUNTERS; ++i) {
+            copy.counters[i] = counters[i].load(std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < PROBE_PEAKS; ++i) {
+            copy.peaks[i] = peaks[i].load(std::memory_order_relaxed);
+        }
+        return copy;
+    }
+};
+
+/**
+ * @brief The default probe: every hook is an empty inline function, so instrumented code compiles to nothing
+ */
+struct NoProbe {
+    static constexpr bool ENABLED = false;
+
+    uint64_t begin() const { return 0; }
+    void end(ProbePhase, uint64_t) const {}
+    void count(ProbeCounter, uint64_t = 1) const {}
+    void peak(ProbePeak, uint64_t) const {}
+};
+
+/**
+ * @brief Enabled probe: TSC cycle counts per phase and event counters, into the calling thread's ProbeBuffer
+ *
+ * Buffers come from a fixed registry claimed on a thread's first use (one atomic increment, no lock) and outlive
+ * their thread, so `snapshot()` from any thread sums every engine thread that ever recorded. Threads beyond
+ * MAX_THREADS share a scratch buffer that snapshots ignore. Cycles come from the unfenced TscClock::now(): they are
+ * meant for breakdowns over many calls, and include the probe's own overhead (a TSC read costs ~20 cycles).
+ */
+struct CycleProbe {
+    static constexpr bool ENABLED = true;
+    static constexpr size_t MAX_THREADS = 256;
+
+    uint64_t begin() const { return TscClock::now(); }
+
+    void end(ProbePhase phase, uint64_t begin) const {
+        ProbeBuffer& own = buffer();
+        ProbeBuffer::add(own.cycles[static_cast<size_t>(phase)], TscClock::now() - begin);
+        ProbeBuffer::add(own.calls[static_cast<size_t>(phase)], 1);
+    }
+
+    void count(ProbeCounter counter, uint64_t value = 1) const {
+        ProbeBuffer::add(buffer().counters[static_cast<size_t>(counter)], value);
+    }
+
+    void peak(ProbePeak peak, uint64_t value) const {
+        ProbeBuffer::raise(buffer().peaks[static_cast<size_t>(peak)], value);
+    }
+
+    /**
+     * @brief The calling thread's buffer
+     */
+    static ProbeBuffer& buffer() {
+        thread_local ProbeBuffer* own = claim();
+        return *own;
+    }
+
+    /**
+     * @brief Sum over every registered thread, safe to call from any thread while the engines run
+     */
+    static ProbeSnapshot snapshot() {
+        ProbeSnapshot total;
+        size_t threads = std::min(registered.load(std::memory_order_acquire), MAX_THREADS);
+        for (size_t i = 0; i < threads; ++i) {
+            total += buffers[i].snapshot();
+        }
+        return total;
+    }
+
+    /**
+     * @brief Zeroes every buffer; only meaningful while no engine thread is recording
+     */
+    static void reset() {
+        for (ProbeBuffer& buffer : buffers) {
+            buffer.clear();
+        }
+    }
+
+  private:
+    static ProbeBuffer* claim() {
+        size_t slot = registered.fetch_add(1, std::memory_order_acq_rel);
+        return slot < MAX_THREADS ? &buffers[slot] : &overflow;
+    }
+
+    static inline std::array<ProbeBuffer, MAX_THREADS> buffers{};
+    static inline std::atomic<size_t> registered{0};
+    static inline ProbeBuffer overflow{};
+};
+
+/**
+ * @brief Times a scope as one phase: free with NoProbe
+ */
+template <typename Probe> class ProbeScope {
+  public:
+    ProbeScope(Probe probe, ProbePhase phase) : probe(probe), phase(phase), start(probe.begin()) {}
+    ~ProbeScope() { probe.end(phase, start); }
+
+    ProbeScope(const ProbeScope&) = delete;
+    ProbeScope& operator=(const ProbeScope&) = delete;
+
+  private:
+    [[no_unique_address]] Probe probe;
+    ProbePhase phase;
+    uint64_t start;
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/**
+ * @brief Cycle counter for latency measurement, with a calibrated conversion to nanoseconds
+ *
+ * On x86 `start()`/`stop()` read the TSC fenced so the measured code can't drift out of the interval (lfence before
+ * the first read, rdtscp + lfence for the second). Assumes an invariant TSC, as on every x86 server since Nehalem.
+ * Elsewhere the ticks are steady_clock nanoseconds and the conversion is the identity.
+ */
+class TscClock {
+  public:
+    /**
+     * @brief Unfenced read: cheapest, but neighbouring instructions may be reordered across it (fine for phase
+     * breakdowns summed over many calls, not for single-operation latency)
+     */
+    static uint64_t now() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return steadyNanos();
+#endif
+    }
+
+    static uint64_t start() {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_lfence();
+        uint64_t ticks = __rdtsc();
+        _mm_lfence();
+        return ticks;
+#else
+        return steadyNanos();
+#endif
+    }
+
+    static uint64_t stop() {
+#if defined(__x86_64__) || defined(__i386__)
+        unsigned core;
+        uint64_t ticks = __rdtscp(&core);
+        _mm_lfence();
+        return ticks;
+#else
+        return steadyNanos();
+#endif
+    }
+
+    /**
+     * @brief Measures the tick rate against steady_clock over `interval` (sleeping, so this is off the hot path)
+     */
+    static TscClock calibrate(std::chrono::milliseconds interval = std::chrono::milliseconds(50)) {
+#if defined(__x86_64__) || defined(__i386__)
+        uint64_t first_nanos = steadyNanos();
+        uint64_t first_ticks = start();
+        std::this_thread::sleep_for(interval);
+        uint64_t last_ticks = stop();
+        uint64_t last_nanos = steadyNanos();
+        return TscClock(static_cast<double>(last_nanos - first_nanos) / static_cast<double>(last_ticks - first_ticks));
+#else
+        (void)interval;
+        return TscClock(1.0);
+#endif
+    }
+
+    explicit TscClock(double nanos_per_tick) : nanos_per_tick(nanos_per_tick) {}
+
+    double nanos(uint64_t ticks) const { return static_cast<double>(ticks) * nanos_per_tick; }
+    double nanosPerTick() const { return nanos_per_tick; }
+
+  private:
+    static uint64_t steadyNanos() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    double nanos_per_tick;
+};
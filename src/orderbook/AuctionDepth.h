@@ -0,0 +1,142 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "OrderBook.h"
+
+/**
+ * @brief In-place inclusive prefix sum: values[i] becomes values[0] + ... + values[i]
+ *
+ * Four 64-bit lanes per step with AVX2 (two with SSE2): each block is summed in log2(lanes) shift-and-add steps,
+ * then the running total carried over from the previous block is added to every lane.
+ */
+inline void inclusivePrefixSum(uint64_t* values, size_t count) {
+    size_t i = 0;
+    uint64_t carry = 0;
+#if defined(__AVX2__)
+    __m256i running = _mm256_setzero_si256();
+    for (; i + 4 <= count; i += 4) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        // [x0, x1, x2, x3] + [0, x0, x1, x2], then + [0, 0, y0, y1]
+        x = _mm256_add_epi64(x, _mm256_blend_epi32(_mm256_permute4x64_epi64(x, _MM_SHUFFLE(2, 1, 0, 0)),
+                                                   _mm256_setzero_si256(), 0b00000011));
+        x = _mm256_add_epi64(x, _mm256_blend_epi32(_mm256_permute4x64_epi64(x, _MM_SHUFFLE(1, 0, 0, 0)),
+                                                   _mm256_setzero_si256(), 0b00001111));
+        x = _mm256_add_epi64(x, running);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i), x);
+        running = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+    carry = static_cast<uint64_t>(_mm256_extract_epi64(running, 0));
+#elif defined(__SSE2__)
+    __m128i running = _mm_setzero_si128();
+    for (; i + 2 <= count; i += 2) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        x = _mm_add_epi64(_mm_add_epi64(x, _mm_slli_si128(x, 8)), running);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(values + i), x);
+        running = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+    carry = static_cast<uint64_t>(_mm_cvtsi128_si64(running));
+#endif
+    for (; i < count; ++i) {
+        carry += values[i];
+        values[i] = carry;
+    }
+}
+
+/**
+ * @brief Outcome of a call auction: the price it uncrosses at and what trades there (price 0: the book does not
+ * cross, nothing trades)
+ */
+struct AuctionResult {
+    Price price = 0;
+    uint64_t volume = 0; // executable quantity at `price`, on each side
+    int64_t surplus = 0; // bid depth minus ask depth at `price`: the imbalance left over
+};
+
+/**
+ * @brief Equilibrium price of a (crossed) book, from its aggregated depth alone
+ *
+ * Only the ticks between the best ask and the best bid can clear. Their level quantities are copied out of the two
+ * ladders (asks ascending, bids descending) and prefix-summed into cumulative supply S(p), the ask quantity at or
+ * below p, and demand D(p), the bid quantity at or above p. The price is then picked by the usual auction rules, in
+ * order: the largest executable volume min(D, S); the smallest absolute surplus D - S; if every remaining surplus is
+ * positive the highest price (buy pressure), if every one is negative the lowest; otherwise the price closest to
+ * `reference_price` (the midpoint of the candidates when that is 0). The cost depends on the width of the crossed
+ * range, never on the number of orders resting in it.
+ */
+template <InstrumentTraits Traits>
+AuctionResult auctionEquilibrium(BasicOrderBook<Traits>& book, Price reference_price = 0) {
+    if (!book.hasBids() || !book.hasAsks() || book.bestBid() < book.bestAsk()) {
+        return {};
+    }
+    const Price low = book.min_ask;
+    const Price high = book.max_bid;
+    const size_t count = high - low + 1;
+
+    // reused across calls, like the mass-cancel buffer: repeated indicative prices do not allocate
+    thread_local std::vector<uint64_t> supply;
+    thread_local std::vector<uint64_t> demand;
+    supply.resize(count);
+    demand.resize(count);
+    book.asks.template copyQuantities<false>(low, high, supply.data());
+    book.bids.template copyQuantities<true>(low, high, demand.data());
+    inclusivePrefixSum(supply.data(), count);
+    inclusivePrefixSum(demand.data(), count); // demand[count - 1 - i]: bids at or above low + i
+
+    uint64_t best_volume = 0;
+    uint64_t best_imbalance = UINT64_MAX;
+    size_t first = 0;
+    size_t last = 0;
+    bool all_positive = true;
+    bool all_negative = true;
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t ask_depth = supply[i];
+        uint64_t bid_depth = demand[count - 1 - i];
+        uint64_t volume = std::min(ask_depth, bid_depth);
+        uint64_t imbalance = bid_depth > ask_depth ? bid_depth - ask_depth : ask_depth - bid_depth;
+        if (volume > best_volume || (volume == best_volume && imbalance < best_imbalance)) {
+            best_volume = volume;
+            best_imbalance = imbalance;
+            first = i;
+            all_positive = true;
+            all_negative = true;
+        } else if (volume != best_volume || imbalance != best_imbalance) {
+            continue;
+        }
+        last = i;
+        all_positive &= bid_depth > ask_depth;
+        all_negative &= bid_depth < ask_depth;
+    }
+
+    size_t pick = first;
+    if (all_positive) {
+        pick = last;
+    } else if (!all_negative && first != last) {
+        // mixed surpluses: the candidate closest to the reference price (candidates need not be adjacent)
+        Price target = low + first + (last - first) / 2;
+        if (reference_price != 0) {
+            target = std::clamp(book.toTick(std::max(reference_price, book.toPrice(0))), low + first, low + last);
+        }
+        Price closest = UINT64_MAX;
+        for (size_t i = first; i <= last; ++i) {
+            uint64_t ask_depth = supply[i];
+            uint64_t bid_depth = demand[count - 1 - i];
+            uint64_t imbalance = bid_depth > ask_depth ? bid_depth - ask_depth : ask_depth - bid_depth;
+            Price distance = low + i > target ? low + i - target : target - (low + i);
+            if (std::min(ask_depth, bid_depth) == best_volume && imbalance == best_imbalance && distance < closest) {
+                closest = distance;
+                pick = i;
+            }
+        }
+    }
+    auto bid_depth = static_cast<int64_t>(demand[count - 1 - pick]);
+    auto ask_depth = static_cast<int64_t>(supply[pick]);
+    return {book.toPrice(low + pick), best_volume, bid_depth - ask_depth};
+}
@@ -1,69 +1,97 @@
 #pragma once
 
+#include <bit>
 #include <cassert>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 
 #include "domain/Order.h"
+#include "infrastructure/ObjectPool.h"
+
 /**
- * @brief Double Linked list
+ * @brief Intrusive FIFO of the resting orders at one price
+ *
+ * Orders are doubly linked through 32-bit pool indices instead of pointers, and the level itself only holds its
+ * head, tail and aggregate quantity side by side (12 bytes, no dummy nodes, nothing allocated). An instrument with a
+ * static MAX_ORDERS below 2^16 gets 16-bit links. Resting orders are aligned to their power-of-two size, so one never
+ * straddles a cache line: 32 bytes for the default instrument, 16 for a narrow one.
  */
-class Level {
+template <InstrumentTraits Traits> class BasicLevel {
   public:
-    struct RestingOrder {
-        Order order;
-        RestingOrder* prev;
-        RestingOrder* next;
-    };
-
-    Level() {
-        dummy_head = new RestingOrder;
-        dummy_tail = new RestingOrder;
+    using Link = std::conditional_t<Traits::MAX_ORDERS != DYNAMIC_ORDERS && Traits::MAX_ORDERS < UINT16_MAX, uint16_t,
+                                    uint32_t>;
+    static constexpr Link NIL = std::numeric_limits<Link>::max();
 
-        dummy_tail->prev = dummy_head;
-        dummy_tail->next = nullptr;
-
-        dummy_head->next = dummy_tail;
-        dummy_head->prev = nullptr;
-
-        total_quantity = 0;
-    }
+    struct alignas(std::bit_ceil(sizeof(BasicOrder<Traits>) + 2 * sizeof(Link))) RestingOrder {
+        BasicOrder<Traits> order;
+        Link prev;
+        Link next;
+    };
 
-    ~Level() {
-        delete dummy_head;
-        delete dummy_tail;
-    }
+    using Pool = ObjectPool<RestingOrder>;
 
-    void add(RestingOrder* resting_order) {
-        total_quantity += resting_order->order.quantity;
+    void add(Pool& pool, Link index) {
+        RestingOrder& resting_order = pool[index];
+        total_quantity += resting_order.order.quantity;
 
-        dummy_tail->prev->next = resting_order;
-        resting_order->prev = dummy_tail->prev;
-        resting_order->next = dummy_tail;
-        dummy_tail->prev = resting_order;
+        resting_order.prev = tail;
+        resting_order.next = NIL;
+        if (tail == NIL) {
+            head = index;
+        } else {
+            pool[tail].next = index;
+        }
+        tail = index;
     }
 
-    bool empty() { return dummy_head->next == dummy_tail; }
+    bool empty() const { return head == NIL; }
 
-    void erase(RestingOrder* resting_order) {
+    void erase(Pool& pool, RestingOrder* resting_order) {
         total_quantity -= resting_order->order.quantity;
-        resting_order->next->prev = resting_order->prev;
-        resting_order->prev->next = resting_order->next;
+        if (resting_order->prev == NIL) {
+            head = resting_order->next;
+        } else {
+            pool[resting_order->prev].next = resting_order->next;
+        }
+        if (resting_order->next == NIL) {
+            tail = resting_order->prev;
+        } else {
+            pool[resting_order->next].prev = resting_order->prev;
+        }
     }
 
-    void pop() {
+    void pop(Pool& pool) {
         assert(!empty());
-        RestingOrder* head = dummy_head->next;
-        assert(head->order.quantity == 0);
-        dummy_head->next = head->next;
-        head->next->prev = dummy_head;
+        RestingOrder& top = pool[head];
+        assert(top.order.quantity == 0);
+        head = top.next;
+        if (head == NIL) {
+            tail = NIL;
+        } else {
+            pool[head].prev = NIL;
+        }
     }
 
     void reduceQuantity(Quantity delta) { total_quantity -= delta; }
-    Quantity getTotalQuantity() { return total_quantity; }
+    Quantity getTotalQuantity() const { return total_quantity; }
 
-    RestingOrder* top() { return dummy_head->next; }
+    RestingOrder* top(Pool& pool) { return &pool[head]; }
+
+    /**
+     * @brief Visits the orders of the level in time priority
+     */
+    template <typename Visitor> void forEach(Pool& pool, Visitor&& visit) const {
+        for (Link index = head; index != NIL; index = pool[index].next) {
+            visit(pool[index]);
+        }
+    }
 
   private:
-    RestingOrder* dummy_head;
-    RestingOrder* dummy_tail;
-    Quantity total_quantity;
-};
\ No newline at end of file
+    Link head = NIL;
+    Link tail = NIL;
+    Quantity total_quantity = 0;
+};
+
+using Level = BasicLevel<DefaultInstrument>;
+static_assert(sizeof(Level::RestingOrder) == 32, "a resting order must fit in half a cache line");
@@ -1,119 +1,697 @@
 #pragma once
 
 #include "Level.h"
+#include "OrderIndex.h"
+#include "PriceLadder.h"
 #include "src/domain/Order.h"
 #include "src/infrastructure/ObjectPool.h"
+#include "src/infrastructure/Prefault.h"
+#include "src/metrics/Probe.h"
 
 #include <algorithm>
+#include <cassert>
+#include <limits>
+#include <memory>
 #include <queue>
+#include <span>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
-class OrderBook {
+/**
+ * @brief The resting orders of one instrument, on two price ladders, with an id index
+ *
+ * Specialized on an instrument (see InstrumentTraits): resting orders are stored at the instrument's field widths and
+ * the ladders are indexed by tick, so a narrow instrument gets smaller resting orders, levels and ladders, with the
+ * conversions folded at compile time. Orders come in and events go out as full-width Order in price units. Internal
+ * accessors taking or returning a "tick" (bidLevel, askLevel, max_bid, min_ask, max_price, stored resting orders)
+ * use the stored unit, which is the price itself for the default instrument (`OrderBook`).
+ *
+ * Orders with an owner (non-zero) are also kept on an intrusive per-owner list, so that everything a participant has
+ * resting can be removed in one pass (removeOwned). Its links live in a side table parallel to the resting order
+ * pool rather than in the resting orders, which keeps those at their size; unowned orders never touch it.
+ *
+ * Each pool slot also has a generation in another side table, bumped whenever the slot is handed out and whenever it
+ * is released (so it is odd exactly while the slot holds an order): together with the slot index it makes an
+ * OrderHandle, which resolve() turns back into the resting order with two indexed loads (that do not depend on each
+ * other) instead of an id lookup, and which stops resolving once the order is gone.
+ *
+ * During a call auction (beginAuction until endAuction) the engine only accumulates orders, so the book may be
+ * crossed: max_bid >= min_ask is then legal, and the cursors keep their meaning on each side.
+ */
+template <InstrumentTraits Traits> class BasicOrderBook {
   public:
-    OrderBook(size_t capacity, Price max_price)
-        : resting_orders_pool(capacity), bids(max_price + 1), max_bid(0), asks(max_price + 1), min_ask(max_price + 1) {}
+    using Instrument = Traits;
+    using Level = BasicLevel<Traits>;
+    using RestingOrder = typename Level::RestingOrder;
+    using PriceLadder = BasicPriceLadder<Level>;
+
+    // one tick below MIN_PRICE: the lowest valid price is tick 1, tick 0 stays free for "no bid"
+    static constexpr Price PRICE_ORIGIN =
+        Traits::MIN_PRICE >= Traits::TICK_SIZE ? Traits::MIN_PRICE - Traits::TICK_SIZE : 0;
+    // stored orders are plain Orders in price units: no conversion at all
+    static constexpr bool WIRE_LAYOUT =
+        std::is_same_v<BasicOrder<Traits>, Order> ||
+        (std::is_same_v<typename Traits::IdType, OrderId> && std::is_same_v<typename Traits::PriceType, Price> &&
+         std::is_same_v<typename Traits::QuantityType, Quantity> && Traits::TICK_SIZE == 1 && PRICE_ORIGIN == 0);
+
+    static constexpr Price toTick(Price price) { return (price - PRICE_ORIGIN) / Traits::TICK_SIZE; }
+    static constexpr Price toPrice(Price tick) { return PRICE_ORIGIN + tick * Traits::TICK_SIZE; }
+
+    /**
+     * @param capacity maximum number of resting orders, inserts beyond it fail (nullptr); at most the instrument's
+     * MAX_ORDERS when that is static
+     * @param max_price highest price accepted; at most the instrument's MAX_PRICE when that is static
+     * @param window_ticks 0 for a dense ladder over [0, max_price], otherwise the size of the sliding window of
+     * levels kept around the best prices (rounded up to a power of two), starting centred on reference_price
+     * @param pool_options how much of the resting order pool is committed up front and how it is backed
+     */
+    BasicOrderBook(size_t capacity, Price max_price, size_t window_ticks = 0, Price reference_price = 0,
+                   PoolOptions pool_options = {})
+        : resting_orders_pool(capacity, pool_options), resting_orders(capacity),
+          owner_links(std::make_unique_for_overwrite<OwnerLinks[]>(capacity)),
+          generations(std::make_unique_for_overwrite<uint32_t[]>(capacity)), max_price(toTick(max_price)),
+          bids(toTick(max_price), window_ticks, toTick(std::max(reference_price, PRICE_ORIGIN))), max_bid(0),
+          asks(toTick(max_price), window_ticks, toTick(std::max(reference_price, PRICE_ORIGIN))),
+          min_ask(toTick(max_price) + 1) {
+        assert(Traits::MAX_ORDERS == DYNAMIC_ORDERS || capacity <= Traits::MAX_ORDERS);
+        assert(Traits::MAX_PRICE == DYNAMIC_PRICE || max_price <= Traits::MAX_PRICE);
+        assert(capacity < Level::NIL);
+        assert(toTick(max_price) < std::numeric_limits<typename Traits::PriceType>::max());
+    }
+
+    /**
+     * @brief Book sized by the instrument itself
+     */
+    BasicOrderBook()
+        requires(Traits::MAX_ORDERS != DYNAMIC_ORDERS && Traits::MAX_PRICE != DYNAMIC_PRICE)
+        : BasicOrderBook(Traits::MAX_ORDERS, Traits::MAX_PRICE) {}
+
+    void beginAuction() { auction = true; }
+    void endAuction() { auction = false; }
+    bool inAuction() const { return auction; }
 
     bool hasBids() { return max_bid > 0; }
-    Price bestBid() { return max_bid; }
-    Level& bestBidLevel() { return bids[max_bid]; }
-    Level& bidLevel(Price price) { return bids[price]; }
+    Price bestBid() { return toPrice(max_bid); }
+    Level& bestBidLevel() { return bids.level(max_bid); }
+    Level& bidLevel(Price tick) { return bids.level(tick); }
+
+    bool hasAsks() { return min_ask <= maxTick(); }
+    Price bestAsk() { return toPrice(min_ask); }
+    Level& bestAskLevel() { return asks.level(min_ask); }
+    Level& askLevel(Price tick) { return asks.level(tick); }
 
-    bool hasAsks() { return min_ask < asks.size(); }
-    Price bestAsk() { return min_ask; }
-    Level& bestAskLevel() { return asks[min_ask]; }
-    Level& askLevel(Price price) { return asks[price]; }
+    /**
+     * @brief Price of a resting order, in price units
+     */
+    Price priceOf(const RestingOrder& resting_order) const { return toPrice(resting_order.order.price); }
 
-    void decrementBidCursor() {
-        while (max_bid > 0 && bids[max_bid].empty()) {
-            max_bid--;
+    /**
+     * @brief A resting order as a full-width Order (a reference to the stored one for the default instrument)
+     */
+    decltype(auto) toOrder(const RestingOrder& resting_order) const {
+        if constexpr (WIRE_LAYOUT) {
+            return (resting_order.order);
+        } else {
+            const BasicOrder<Traits>& stored = resting_order.order;
+            return Order(stored.id, stored.quantity, toPrice(stored.price), stored.side, stored.owner);
         }
     }
 
-    void incrementAskCursor() {
-        while (min_ask < asks.size() && asks[min_ask].empty()) {
-            min_ask++;
+    /**
+     * @brief Whether an order fits the instrument: on a tick, within the price band, id, quantity and owner
+     * representable
+     */
+    bool accepts(const Order& order) const {
+        return order.price > PRICE_ORIGIN && (order.price - PRICE_ORIGIN) % Traits::TICK_SIZE == 0 &&
+               toTick(order.price) <= maxTick() && order.id <= std::numeric_limits<typename Traits::IdType>::max() &&
+               order.quantity <= std::numeric_limits<typename Traits::QuantityType>::max() &&
+               order.owner <= std::numeric_limits<typename Traits::OwnerType>::max();
+    }
+
+    // The mutating helpers below take an optional probe (see metrics/Probe.h): the default NoProbe compiles away,
+    // an enabled one times their phases and counts cursor walks. MatchingEngine passes its own Probe parameter.
+
+    template <typename Probe = NoProbe> void decrementBidCursor(Probe probe = {}) {
+        ProbeScope scope(probe, ProbePhase::CursorScan);
+        Price next_bid = bids.prevOccupied(max_bid);
+        bids.follow(next_bid);
+        if constexpr (Probe::ENABLED) {
+            probe.count(ProbeCounter::LevelsWalked, next_bid == PriceLadder::npos ? 0 : max_bid - next_bid);
         }
+        max_bid = next_bid == PriceLadder::npos ? 0 : next_bid;
     }
 
-    Level::RestingOrder* find(OrderId order_id) {
-        auto it = resting_orders.find(order_id);
-        if (it != resting_orders.end()) [[likely]] {
-            return it->second;
+    template <typename Probe = NoProbe> void incrementAskCursor(Probe probe = {}) {
+        ProbeScope scope(probe, ProbePhase::CursorScan);
+        Price next_ask = asks.nextOccupied(min_ask);
+        asks.follow(next_ask);
+        if constexpr (Probe::ENABLED) {
+            probe.count(ProbeCounter::LevelsWalked, next_ask == PriceLadder::npos ? 0 : next_ask - min_ask);
         }
-        return nullptr;
+        min_ask = next_ask == PriceLadder::npos ? max_price + 1 : next_ask;
     }
 
-    void clean(Level::RestingOrder* resting_order) {
-        resting_orders.erase(resting_order->order.id);
-        resting_orders_pool.deallocate(resting_order);
+    /**
+     * @brief Whether the asks at or below `tick` hold at least `quantity` (the fill-or-kill check): sums aggregate
+     * level quantities from the best ask outwards, stopping as soon as they cover it, without reading any order
+     */
+    bool asksCover(Price tick, uint64_t quantity) {
+        uint64_t available = 0;
+        for (Price price = min_ask; price <= tick && price <= maxTick(); price = asks.nextOccupied(price + 1)) {
+            available += asks.quantityAt(price);
+            if (available >= quantity) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Whether the bids at or above `tick` hold at least `quantity`, as asksCover
+     */
+    bool bidsCover(Price tick, uint64_t quantity) {
+        uint64_t available = 0;
+        // max_bid is 0 without bids, prevOccupied is npos past the last one
+        for (Price price = max_bid; price != PriceLadder::npos && price > 0 && price >= tick;
+             price = bids.prevOccupied(price - 1)) {
+            available += bids.quantityAt(price);
+            if (available >= quantity) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    RestingOrder* top(Level& level) { return level.top(resting_orders_pool); }
+
+    RestingOrder* find(OrderId order_id) { return resting_orders.find(order_id); }
+
+    /**
+     * @brief The handle of a resting order, valid until the order leaves its slot (filled, canceled, re-matched)
+     */
+    OrderHandle handleOf(const RestingOrder& resting_order) const {
+        auto slot = static_cast<uint32_t>(resting_orders_pool.indexOf(&resting_order));
+        return {slot, generations[slot]};
+    }
+
+    /**
+     * @brief The resting order a handle was issued for, nullptr if it has left the book since (or never was in it)
+     */
+    RestingOrder* resolve(OrderHandle handle) {
+        // slots past the high water mark hold no order (since the construction or the last reset), and their
+        // generation may not even be initialized. A free slot has an even generation: its first bytes are the pool's
+        // free list link, not an order
+        if (handle.slot >= resting_orders_pool.highWaterMark() || generations[handle.slot] != handle.generation ||
+            handle.generation % 2 == 0) {
+            return nullptr;
+        }
+        return &resting_orders_pool[handle.slot];
+    }
+
+    // prefetch hints for the batch path: no side effects, safe for any id or price
+    void prefetchIndex(OrderId order_id) const { resting_orders.prefetch(order_id); }
+    void prefetchLevel(Side side, Price price) const { (side == Side::Buy ? bids : asks).prefetch(toTick(price)); }
+    // what unlinking a resting order touches besides the order itself: its level and its queue neighbours
+    void prefetchUnlink(const RestingOrder& resting_order) {
+        (resting_order.order.side == Side::Buy ? bids : asks).prefetch(resting_order.order.price);
+        if (resting_order.prev != Level::NIL) {
+            __builtin_prefetch(&resting_orders_pool[resting_order.prev], 1);
+        }
+        if (resting_order.next != Level::NIL) {
+            __builtin_prefetch(&resting_orders_pool[resting_order.next], 1);
+        }
+    }
+
+    /**
+     * @brief Visits every resting order: bids then asks, each side from its best level outwards, each level in time
+     * priority (the order snapshots store them in)
+     */
+    template <typename Visitor> void forEachRestingOrder(Visitor&& visit) {
+        for (Price price = hasBids() ? max_bid : PriceLadder::npos; price != PriceLadder::npos;
+             price = price == 0 ? PriceLadder::npos : bids.prevOccupied(price - 1)) {
+            bids.level(price).forEach(resting_orders_pool, [&](const RestingOrder& bid) { visit(toOrder(bid)); });
+        }
+        for (Price price = hasAsks() ? min_ask : PriceLadder::npos; price != PriceLadder::npos;
+             price = asks.nextOccupied(price + 1)) {
+            asks.level(price).forEach(resting_orders_pool, [&](const RestingOrder& ask) { visit(toOrder(ask)); });
+        }
+    }
+
+    /**
+     * @brief Bulk-loads resting orders into a freshly constructed book without going through matching
+     *
+     * Each order is appended to its level, marked in the occupancy bitmap and indexed; there are no cursor walks, the
+     * cursors are set once at the end. `orders` should be in forEachRestingOrder() order (it sets queue priority);
+     * `best_bid`/`best_ask` are the saved book's cursors (max_bid, min_ask, in ticks). The input is not trusted:
+     * returns false, leaving the book empty, if the orders exceed its capacity, if one of them does not fit the
+     * instrument (see accepts()) or has no quantity or side, if two share an id, or if the cursors are not those of
+     * the loaded levels or cross.
+     */
+    bool restore(std::span<const Order> orders, Price best_bid, Price best_ask) {
+        assert(resting_orders_pool.highWaterMark() == 0);
+        if (orders.size() > resting_orders_pool.capacity()) {
+            return false;
+        }
+        // a bad input found part way is undone: the orders loaded so far are unlinked and their slots released
+        auto abandon = [&](size_t loaded, size_t indexed) {
+            for (size_t i = 0; i < indexed; ++i) {
+                resting_orders.erase(resting_orders_pool[i].order.id);
+            }
+            for (size_t i = 0; i < loaded; ++i) {
+                RestingOrder& resting_order = resting_orders_pool[i];
+                PriceLadder& side = resting_order.order.side == Side::Buy ? bids : asks;
+                Level& level = side.level(resting_order.order.price);
+                level.erase(resting_orders_pool, &resting_order);
+                if (level.empty()) {
+                    side.markEmpty(resting_order.order.price);
+                }
+                if (orders[i].owner != 0) {
+                    untrack(static_cast<typename Level::Link>(i), orders[i].owner);
+                }
+                ++generations[i];
+            }
+            resting_orders_pool.reset();
+            return false;
+        };
+
+        // centre the windows first so the orders land in ring slots rather than in the overflow maps
+        if (best_bid > 0 && best_bid <= maxTick()) {
+            bids.recentre(best_bid);
+        }
+        if (best_ask <= maxTick()) {
+            asks.recentre(best_ask);
+        }
+        // an unused pool hands out consecutive slots: the orders fill [0, size) in snapshot order, so each level's
+        // queue is contiguous in memory and the whole range can be indexed at once
+        Price loaded_bid = 0;
+        Price loaded_ask = maxTick() + 1;
+        for (size_t i = 0; i < orders.size(); ++i) {
+            const Order& order = orders[i];
+            if (!accepts(order) || order.quantity == 0 || (order.side != Side::Buy && order.side != Side::Sell))
+                [[unlikely]] {
+                return abandon(i, 0);
+            }
+            RestingOrder* resting_order = resting_orders_pool.allocate();
+            resting_order->order = store(order);
+            auto index = static_cast<typename Level::Link>(i);
+            occupy(index);
+            Price tick = resting_order->order.price;
+            if (order.side == Side::Buy) {
+                bids.level(tick).add(resting_orders_pool, index);
+                bids.markOccupied(tick);
+                loaded_bid = std::max(loaded_bid, tick);
+            } else {
+                asks.level(tick).add(resting_orders_pool, index);
+                asks.markOccupied(tick);
+                loaded_ask = std::min(loaded_ask, tick);
+            }
+            track(index, order.owner);
+        }
+        if (best_bid != loaded_bid || best_ask != loaded_ask || (best_bid > 0 && best_bid >= best_ask)) {
+            return abandon(orders.size(), 0);
+        }
+        if (size_t indexed = resting_orders.insertBulk(&resting_orders_pool[0], orders.size());
+            indexed != orders.size()) [[unlikely]] {
+            return abandon(orders.size(), indexed);
+        }
+        max_bid = best_bid;
+        min_ask = best_ask;
+        return true;
+    }
+
+    /**
+     * @brief Makes all of the book's preallocated memory resident (see prefaultRange) and, with `lock`, pins it with
+     * mlock: the whole resting order pool (committing what initial_capacity left out), the owner and generation side
+     * tables, the id index and both ladders. Returns false if part of it could not be committed or locked. Overflow
+     * levels of windowed ladders are allocated as they appear and are not covered.
+     */
+    bool prefault(bool lock) {
+        size_t capacity = resting_orders_pool.capacity();
+        bool resident = resting_orders_pool.prefault(lock);
+        resident &= prefaultRange(owner_links.get(), capacity * sizeof(OwnerLinks), lock);
+        resident &= prefaultRange(generations.get(), capacity * sizeof(uint32_t), lock);
+        resident &= resting_orders.prefault(lock);
+        resident &= bids.prefault(lock);
+        resident &= asks.prefault(lock);
+        return resident;
+    }
+
+    /**
+     * @brief Puts an empty book back in its freshly constructed state, e.g. after a warm-up: cursors reset and the
+     * pool handing out slots from the first one again, so restore() can follow. The windows stay where they are
+     * (warmUp recentres them itself). Slot generations carry on from where they were, so handles issued before never
+     * resolve to the orders placed after.
+     */
+    void reset() {
+        assert(!auction && !hasBids() && !hasAsks());
+        resting_orders_pool.reset();
+        max_bid = 0;
+        min_ask = max_price + 1;
+    }
+
+    bool hasOwned(OwnerId owner) const { return owner < owner_lists.size() && owner_lists[owner].head != Level::NIL; }
+
+    /**
+     * @brief Removes the resting orders of `owner` that pass `filter`, calling `removed(order)` with each one (a
+     * full-width Order) as it goes
+     *
+     * Walks only the owner's list, oldest order first: each order is unlinked from its level and released as by a
+     * cancel, but the best-price cursors are moved once at the end instead of after every removal, so `removed` must
+     * not look at the book. Owner 0 (no owner) removes nothing. Returns the number of orders removed.
+     */
+    template <typename Visitor> size_t removeOwned(OwnerId owner, const MassCancelFilter& filter, Visitor&& removed) {
+        if (owner == 0 || owner >= owner_lists.size()) {
+            return 0;
+        }
+        size_t count = 0;
+        bool bids_touched = false;
+        bool asks_touched = false;
+        // the list is known ahead of time: a second cursor runs MASS_CANCEL_LOOKAHEAD orders in front fetching slots,
+        // and by the time an order is next its (now cached) level and queue neighbours are fetched as well
+        typename Level::Link ahead = owner_lists[owner].head;
+        for (size_t i = 0; i < MASS_CANCEL_LOOKAHEAD && ahead != Level::NIL; ++i) {
+            __builtin_prefetch(&resting_orders_pool[ahead], 1);
+            ahead = owner_links[ahead].next;
+        }
+        for (typename Level::Link index = owner_lists[owner].head; index != Level::NIL;) {
+            RestingOrder* resting_order = &resting_orders_pool[index];
+            index = owner_links[index].next; // before the slot is released
+            if (ahead != Level::NIL) {
+                __builtin_prefetch(&resting_orders_pool[ahead], 1);
+                ahead = owner_links[ahead].next;
+            }
+            if (index != Level::NIL) {
+                prefetchUnlink(resting_orders_pool[index]);
+            }
+            const Side side = resting_order->order.side;
+            if (!filter.matches(side, priceOf(*resting_order))) {
+                continue;
+            }
+            removed(toOrder(*resting_order));
+            PriceLadder& ladder = side == Side::Buy ? bids : asks;
+            Level& level = ladder.level(resting_order->order.price);
+            level.erase(resting_orders_pool, resting_order);
+            if (level.empty()) {
+                ladder.markEmpty(resting_order->order.price);
+            }
+            clean(resting_order);
+            (side == Side::Buy ? bids_touched : asks_touched) = true;
+            ++count;
+        }
+        if (bids_touched) {
+            decrementBidCursor();
+        }
+        if (asks_touched) {
+            incrementAskCursor();
+        }
+        return count;
+    }
+
+    template <typename Probe = NoProbe> void clean(RestingOrder* resting_order, Probe probe = {}) {
+        if (resting_order->order.owner != 0) {
+            untrack(static_cast<typename Level::Link>(resting_orders_pool.indexOf(resting_order)),
+                    resting_order->order.owner);
+        }
+        {
+            ProbeScope scope(probe, ProbePhase::IndexErase);
+            resting_orders.erase(resting_order->order.id);
+        }
+        ProbeScope scope(probe, ProbePhase::PoolRelease);
+        release(resting_order);
     }
 
-    Level::RestingOrder* insertBid(Order& order) {
-        Level::RestingOrder* resting_order = resting_orders_pool.allocate();
-        resting_order->order = order;
-        Level& level = bidLevel(order.price);
-        level.add(resting_order);
-        resting_orders.emplace(order.id, resting_order);
-        if (order.price > max_bid) {
-            max_bid = order.price;
+    // both return nullptr, leaving the book as it was, when the pool is full or the id is already resting
+    template <typename Probe = NoProbe> RestingOrder* insertBid(const Order& order, Probe probe = {}) {
+        ProbeScope scope(probe, ProbePhase::Insert);
+        RestingOrder* resting_order = allocate(probe);
+        if (resting_order == nullptr) [[unlikely]] {
+            return nullptr;
+        }
+        resting_order->order = store(order);
+        if (!index(order.id, resting_order, probe)) [[unlikely]] {
+            release(resting_order);
+            return nullptr;
+        }
+        Price tick = resting_order->order.price;
+        auto slot = static_cast<typename Level::Link>(resting_orders_pool.indexOf(resting_order));
+        bidLevel(tick).add(resting_orders_pool, slot);
+        bids.markOccupied(tick);
+        track(slot, order.owner);
+        if (tick > max_bid) {
+            max_bid = tick;
+            bids.follow(max_bid);
         }
         return resting_order;
     }
 
-    Level::RestingOrder* insertAsk(Order& order) {
-        Level::RestingOrder* resting_order = resting_orders_pool.allocate();
-        resting_order->order = order;
-        Level& level = askLevel(order.price);
-        level.add(resting_order);
-        resting_orders.emplace(order.id, resting_order);
-        if (order.price < min_ask) {
-            min_ask = order.price;
+    template <typename Probe = NoProbe> RestingOrder* insertAsk(const Order& order, Probe probe = {}) {
+        ProbeScope scope(probe, ProbePhase::Insert);
+        RestingOrder* resting_order = allocate(probe);
+        if (resting_order == nullptr) [[unlikely]] {
+            return nullptr;
+        }
+        resting_order->order = store(order);
+        if (!index(order.id, resting_order, probe)) [[unlikely]] {
+            release(resting_order);
+            return nullptr;
+        }
+        Price tick = resting_order->order.price;
+        auto slot = static_cast<typename Level::Link>(resting_orders_pool.indexOf(resting_order));
+        askLevel(tick).add(resting_orders_pool, slot);
+        asks.markOccupied(tick);
+        track(slot, order.owner);
+        if (tick < min_ask) {
+            min_ask = tick;
+            asks.follow(min_ask);
         }
         return resting_order;
     }
 
-    void fillAskOrder(Level& ask_level, Level::RestingOrder* ask, Quantity trade_quantity) {
+    template <typename Probe = NoProbe>
+    void fillAskOrder(Level& ask_level, RestingOrder* ask, Quantity trade_quantity, Probe probe = {}) {
+        ProbeScope scope(probe, ProbePhase::Fill);
         ask->order.quantity -= trade_quantity;
         ask_level.reduceQuantity(trade_quantity);
         if (ask->order.quantity == 0) {
-            ask_level.pop();
-            clean(ask);
-            incrementAskCursor();
+            ask_level.pop(resting_orders_pool);
+            if (ask_level.empty()) {
+                asks.markEmpty(ask->order.price);
+            }
+            clean(ask, probe);
+            incrementAskCursor(probe);
         }
     }
-    void fillBidOrder(Level& bid_level, Level::RestingOrder* bid, Quantity trade_quantity) {
+    template <typename Probe = NoProbe>
+    void fillBidOrder(Level& bid_level, RestingOrder* bid, Quantity trade_quantity, Probe probe = {}) {
+        ProbeScope scope(probe, ProbePhase::Fill);
         bid->order.quantity -= trade_quantity;
         bid_level.reduceQuantity(trade_quantity);
         if (bid->order.quantity == 0) {
-            bid_level.pop();
-            clean(bid);
-            decrementBidCursor();
+            bid_level.pop(resting_orders_pool);
+            if (bid_level.empty()) {
+                bids.markEmpty(bid->order.price);
+            }
+            clean(bid, probe);
+            decrementBidCursor(probe);
         }
     }
 
-    void removeAsk(Level::RestingOrder* ask) {
+    template <typename Probe = NoProbe> void removeAsk(RestingOrder* ask, Probe probe = {}) {
+        ProbeScope scope(probe, ProbePhase::Remove);
         Level& ask_level = askLevel(ask->order.price);
-        ask_level.erase(ask);
-        clean(ask);
-        incrementAskCursor();
+        ask_level.erase(resting_orders_pool, ask);
+        if (ask_level.empty()) {
+            asks.markEmpty(ask->order.price);
+        }
+        clean(ask, probe);
+        incrementAskCursor(probe);
     }
 
-    void removeBid(Level::RestingOrder* bid) {
+    template <typename Probe = NoProbe> void removeBid(RestingOrder* bid, Probe probe = {}) {
+        ProbeScope scope(probe, ProbePhase::Remove);
         Level& bid_level = bidLevel(bid->order.price);
-        bid_level.erase(bid);
-        clean(bid);
-        decrementBidCursor();
+        bid_level.erase(resting_orders_pool, bid);
+        if (bid_level.empty()) {
+            bids.markEmpty(bid->order.price);
+        }
+        clean(bid, probe);
+        decrementBidCursor(probe);
+    }
+
+    /**
+     * @brief Moves a resting bid to the back of the queue at `tick` with a new quantity, keeping its pool slot and
+     * index entry (the in-place modify path). The new price must not cross the book outside an auction; `tick` may be
+     * its current one.
+     */
+    template <typename Probe = NoProbe>
+    void relinkBid(RestingOrder* bid, Price tick, Quantity quantity, Probe probe = {}) {
+        ProbeScope scope(probe, ProbePhase::Relink);
+        auto slot = static_cast<typename Level::Link>(resting_orders_pool.indexOf(bid));
+        Price old_tick = bid->order.price;
+        Level& old_level = bidLevel(old_tick);
+        old_level.erase(resting_orders_pool, bid);
+        if (old_level.empty()) {
+            bids.markEmpty(old_tick);
+        }
+        bid->order.price = static_cast<typename Traits::PriceType>(tick);
+        bid->order.quantity = static_cast<typename Traits::QuantityType>(quantity);
+        bidLevel(tick).add(resting_orders_pool, slot);
+        bids.markOccupied(tick);
+        if (tick > max_bid) {
+            max_bid = tick;
+            bids.follow(max_bid);
+        } else if (old_tick == max_bid && tick != old_tick) {
+            decrementBidCursor(probe); // lands on `tick` at the latest
+        }
     }
 
-    ObjectPool<Level::RestingOrder> resting_orders_pool;
-    std::unordered_map<OrderId, Level::RestingOrder*> resting_orders; // todo: very expensive
+    template <typename Probe = NoProbe>
+    void relinkAsk(RestingOrder* ask, Price tick, Quantity quantity, Probe probe = {}) {
+        ProbeScope scope(probe, ProbePhase::Relink);
+        auto slot = static_cast<typename Level::Link>(resting_orders_pool.indexOf(ask));
+        Price old_tick = ask->order.price;
+        Level& old_level = askLevel(old_tick);
+        old_level.erase(resting_orders_pool, ask);
+        if (old_level.empty()) {
+            asks.markEmpty(old_tick);
+        }
+        ask->order.price = static_cast<typename Traits::PriceType>(tick);
+        ask->order.quantity = static_cast<typename Traits::QuantityType>(quantity);
+        askLevel(tick).add(resting_orders_pool, slot);
+        asks.markOccupied(tick);
+        if (tick < min_ask) {
+            min_ask = tick;
+            asks.follow(min_ask);
+        } else if (old_tick == min_ask && tick != old_tick) {
+            incrementAskCursor(probe); // lands on `tick` at the latest
+        }
+    }
+
+  private:
+    static constexpr size_t MASS_CANCEL_LOOKAHEAD = 8;
+
+    Price maxTick() const {
+        if constexpr (Traits::MAX_PRICE != DYNAMIC_PRICE) {
+            return toTick(Traits::MAX_PRICE);
+        } else {
+            return max_price;
+        }
+    }
 
-    std::vector<Level> bids;
+    static BasicOrder<Traits> store(const Order& order) {
+        if constexpr (WIRE_LAYOUT) {
+            return order;
+        } else {
+            assert(order.price > PRICE_ORIGIN && (order.price - PRICE_ORIGIN) % Traits::TICK_SIZE == 0);
+            assert(order.id <= std::numeric_limits<typename Traits::IdType>::max());
+            assert(order.quantity <= std::numeric_limits<typename Traits::QuantityType>::max());
+            assert(order.owner <= std::numeric_limits<typename Traits::OwnerType>::max());
+            return BasicOrder<Traits>(static_cast<typename Traits::IdType>(order.id),
+                                      static_cast<typename Traits::QuantityType>(order.quantity),
+                                      static_cast<typename Traits::PriceType>(toTick(order.price)), order.side,
+                                      static_cast<typename Traits::OwnerType>(order.owner));
+        }
+    }
+
+    template <typename Probe> RestingOrder* allocate(Probe probe) {
+        ProbeScope scope(probe, ProbePhase::PoolAllocate);
+        RestingOrder* resting_order = resting_orders_pool.allocate();
+        if (resting_order != nullptr) [[likely]] {
+            occupy(resting_orders_pool.indexOf(resting_order));
+        }
+        if constexpr (Probe::ENABLED) {
+            probe.peak(ProbePeak::PoolHighWater, resting_orders_pool.highWaterMark());
+        }
+        return resting_order;
+    }
+
+    // a slot's generation is 1 the first time it is ever handed out; handed out again (after a release, or after
+    // reset()) it goes on from its count, which every release has moved past the handles issued so far
+    void occupy(size_t slot) {
+        if (slot >= generations_started) {
+            generations[slot] = 0;
+            generations_started = slot + 1;
+        }
+        ++generations[slot];
+    }
+
+    void release(RestingOrder* resting_order) {
+        ++generations[resting_orders_pool.indexOf(resting_order)];
+        resting_orders_pool.deallocate(resting_order);
+    }
+
+    template <typename Probe> bool index(OrderId order_id, RestingOrder* resting_order, Probe probe) {
+        ProbeScope scope(probe, ProbePhase::IndexInsert);
+        return resting_orders.insert(order_id, resting_order);
+    }
+
+    // appends a slot to its owner's list (unowned orders are not listed); the lists grow the first time an owner
+    // shows up. Appending keeps each list in time priority, which a mass cancel then walks in pool allocation order.
+    void track(typename Level::Link slot, OwnerId owner) {
+        if (owner == 0) {
+            return;
+        }
+        if (owner >= owner_lists.size()) [[unlikely]] {
+            owner_lists.resize(owner + 1, OwnerList{Level::NIL, Level::NIL});
+        }
+        OwnerList& list = owner_lists[owner];
+        owner_links[slot] = {list.tail, Level::NIL};
+        if (list.tail == Level::NIL) {
+            list.head = slot;
+        } else {
+            owner_links[list.tail].next = slot;
+        }
+        list.tail = slot;
+    }
+
+    void untrack(typename Level::Link slot, OwnerId owner) {
+        const OwnerLinks& links = owner_links[slot];
+        OwnerList& list = owner_lists[owner];
+        if (links.prev == Level::NIL) {
+            list.head = links.next;
+        } else {
+            owner_links[links.prev].next = links.next;
+        }
+        if (links.next == Level::NIL) {
+            list.tail = links.prev;
+        } else {
+            owner_links[links.next].prev = links.prev;
+        }
+    }
+
+    struct OwnerLinks {
+        typename Level::Link prev;
+        typename Level::Link next;
+    };
+
+    struct OwnerList {
+        typename Level::Link head;
+        typename Level::Link tail;
+    };
+
+  public:
+    typename Level::Pool resting_orders_pool;
+    BasicOrderIndex<RestingOrder> resting_orders;
+
+    // per-owner lists: links indexed like the pool (pages only touched by owned orders), head/tail indexed by owner
+    std::unique_ptr<OwnerLinks[]> owner_links;
+    std::vector<OwnerList> owner_lists;
+
+    // per-slot generation, indexed like the pool: initialized when a slot is first handed out, odd while it holds an
+    // order
+    std::unique_ptr<uint32_t[]> generations;
+    size_t generations_started = 0; // slots below this have a generation; unlike the pool's, not undone by reset()
+
+    Price max_price; // in ticks
+
+    PriceLadder bids;
     Price max_bid;
 
-    std::vector<Level> asks;
+    PriceLadder asks;
     Price min_ask;
-};
\ No newline at end of file
+
+    bool auction = false;
+};
+
+using OrderBook = BasicOrderBook<DefaultInstrument>;
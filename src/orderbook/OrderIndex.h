@@ -0,0 +1,129 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Level.h"
+#include "src/infrastructure/Prefault.h"
+
+/**
+ * @brief Flat OrderId -> RestingOrder* index
+ *
+ * Open addressing with Robin Hood linear probing over a power-of-two table sized at construction (at least twice
+ * the number of orders the book can hold, so the load factor never exceeds 0.5). Deletion uses backward shifting
+ * instead of tombstones, so probe sequences never degrade and nothing is allocated after construction.
+ * Ids are unique among resting orders (insert() refuses a second entry); slots store them at the resting order's id
+ * width.
+ */
+template <typename RestingOrder> class BasicOrderIndex {
+  public:
+    explicit BasicOrderIndex(size_t capacity)
+        : slots(std::bit_ceil(std::max<size_t>(capacity * 2, 16))), mask(slots.size() - 1),
+          shift(std::countr_zero(slots.size())) {}
+
+    RestingOrder* find(OrderId order_id) const {
+        size_t i = home(order_id);
+        for (size_t distance = 0;; ++distance, i = (i + 1) & mask) {
+            const Slot& slot = slots[i];
+            if (slot.resting_order == nullptr || probeDistance(slot, i) < distance) {
+                return nullptr;
+            }
+            if (slot.id == order_id) {
+                return slot.resting_order;
+            }
+        }
+    }
+
+    /**
+     * @brief Indexes `order_id`, unless it is indexed already: then returns false and leaves the table as it was
+     *
+     * An entry for the same id can only sit before the first resident closer to its home than the probe (where
+     * find() stops too), which is also where the probe starts displacing entries: so the check is one compare per
+     * slot the insert walks anyway, and a refused insert has not moved anything yet.
+     */
+    [[nodiscard]] bool insert(OrderId order_id, RestingOrder* resting_order) {
+        Slot entry{static_cast<decltype(Slot::id)>(order_id), resting_order};
+        size_t i = home(order_id);
+        for (size_t distance = 0; slots[i].resting_order != nullptr; ++distance, i = (i + 1) & mask) {
+            if (slots[i].id == entry.id) [[unlikely]] {
+                return false;
+            }
+            // robin hood: the entry furthest from its home keeps the slot
+            size_t resident_distance = probeDistance(slots[i], i);
+            if (resident_distance < distance) {
+                std::swap(entry, slots[i]);
+                distance = resident_distance;
+            }
+        }
+        slots[i] = entry;
+        return true;
+    }
+
+    /**
+     * @brief Indexes `count` contiguous resting orders (a freshly bulk-loaded pool range) in one go, stopping at the
+     * first id already indexed: returns how many were indexed, `count` unless there was a duplicate
+     *
+     * Ids come in book order, not arrival order, so each insert lands on a random slot of the table: the home slots
+     * of the orders a few positions ahead are prefetched to overlap those cache misses.
+     */
+    size_t insertBulk(RestingOrder* first, size_t count) {
+        constexpr size_t LOOKAHEAD = 16;
+        for (size_t i = 0; i < count; ++i) {
+            if (i + LOOKAHEAD < count) {
+                prefetch(first[i + LOOKAHEAD].order.id);
+            }
+            if (!insert(first[i].order.id, &first[i])) [[unlikely]] {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    void prefetch(OrderId order_id) const { __builtin_prefetch(&slots[home(order_id)], 1); }
+
+    void erase(OrderId order_id) {
+        size_t hole = home(order_id);
+        for (size_t distance = 0;; ++distance, hole = (hole + 1) & mask) {
+            const Slot& slot = slots[hole];
+            if (slot.resting_order == nullptr || probeDistance(slot, hole) < distance) [[unlikely]] {
+                return;
+            }
+            if (slot.id == order_id) {
+                break;
+            }
+        }
+
+        // backward shift: stops at the first empty slot or the first entry already sitting in its home slot
+        for (size_t i = (hole + 1) & mask; slots[i].resting_order != nullptr && probeDistance(slots[i], i) > 0;
+             i = (i + 1) & mask) {
+            slots[hole] = slots[i];
+            hole = i;
+        }
+        slots[hole].resting_order = nullptr;
+    }
+
+    size_t tableSize() const { return slots.size(); }
+
+    bool prefault(bool lock) { return prefaultRange(slots.data(), slots.size() * sizeof(Slot), lock); }
+
+  private:
+    struct Slot {
+        decltype(RestingOrder::order.id) id = 0;
+        RestingOrder* resting_order = nullptr; // nullptr marks an empty slot
+    };
+
+    // exchange ids are mostly sequential: keep them in consecutive slots (one cache line serves four lookups) and
+    // fold the high bits in so ids strided by the table size don't pile up in one cluster
+    size_t home(OrderId order_id) const { return (order_id ^ (order_id >> shift)) & mask; }
+    size_t probeDistance(const Slot& slot, size_t position) const { return (position - home(slot.id)) & mask; }
+
+    std::vector<Slot> slots;
+    size_t mask;
+    int shift;
+};
+
+using OrderIndex = BasicOrderIndex<Level::RestingOrder>;
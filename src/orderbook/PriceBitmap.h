@@ -0,0 +1,136 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "src/infrastructure/Prefault.h"
+
+/**
+ * @brief Hierarchical occupancy bitmap over a price ladder
+ *
+ * Level 0 holds one bit per price, every upper level holds one bit per non-zero word of the level below, up to a
+ * single root word. Finding the next occupied price above/below a cursor is one tzcnt/lzcnt per level, whatever
+ * the number of empty ticks in between (3 levels cover 262144 ticks, 4 levels 16M ticks).
+ */
+class PriceBitmap {
+  public:
+    static constexpr size_t npos = SIZE_MAX;
+
+    explicit PriceBitmap(size_t size) : bit_count(size) {
+        size_t total_words = 0;
+        size_t bits = size;
+        do {
+            size_t level_words = (bits + 63) / 64;
+            level_offset[depth] = total_words;
+            word_count[depth] = level_words;
+            total_words += level_words;
+            bits = level_words;
+            ++depth;
+        } while (bits > 1);
+        assert(depth <= MAX_DEPTH);
+        words.resize(total_words, 0);
+    }
+
+    void set(size_t index) {
+        for (size_t level = 0; level < depth; ++level) {
+            uint64_t& word = words[level_offset[level] + (index >> 6)];
+            bool was_empty = word == 0;
+            word |= bit(index);
+            if (!was_empty) {
+                return;
+            }
+            index >>= 6;
+        }
+    }
+
+    void clear(size_t index) {
+        for (size_t level = 0; level < depth; ++level) {
+            uint64_t& word = words[level_offset[level] + (index >> 6)];
+            word &= ~bit(index);
+            if (word != 0) {
+                return;
+            }
+            index >>= 6;
+        }
+    }
+
+    bool test(size_t index) const { return words[index >> 6] & bit(index); }
+
+    /**
+     * @brief Smallest set index >= from, npos if none
+     */
+    size_t findNext(size_t from) const {
+        if (from >= bit_count) {
+            return npos;
+        }
+        size_t level = 0;
+        size_t index = from;
+        while (true) {
+            size_t word_index = index >> 6;
+            uint64_t word = 0;
+            if (word_index < word_count[level]) {
+                word = words[level_offset[level] + word_index] & (~0ull << (index & 63));
+            }
+            if (word != 0) {
+                index = (word_index << 6) + std::countr_zero(word);
+                break;
+            }
+            if (level + 1 == depth) {
+                return npos;
+            }
+            index = word_index + 1;
+            ++level;
+        }
+        while (level > 0) {
+            --level;
+            index = (index << 6) + std::countr_zero(words[level_offset[level] + index]);
+        }
+        return index;
+    }
+
+    /**
+     * @brief Largest set index <= from, npos if none
+     */
+    size_t findPrev(size_t from) const {
+        if (bit_count == 0) {
+            return npos;
+        }
+        size_t level = 0;
+        size_t index = from < bit_count ? from : bit_count - 1;
+        while (true) {
+            size_t word_index = index >> 6;
+            uint64_t word = words[level_offset[level] + word_index] & (~0ull >> (63 - (index & 63)));
+            if (word != 0) {
+                index = (word_index << 6) + 63 - std::countl_zero(word);
+                break;
+            }
+            if (level + 1 == depth || word_index == 0) {
+                return npos;
+            }
+            index = word_index - 1;
+            ++level;
+        }
+        while (level > 0) {
+            --level;
+            index = (index << 6) + 63 - std::countl_zero(words[level_offset[level] + index]);
+        }
+        return index;
+    }
+
+    bool prefault(bool lock) { return prefaultRange(words.data(), words.size() * sizeof(uint64_t), lock); }
+
+  private:
+    static constexpr size_t MAX_DEPTH = 8;
+
+    static uint64_t bit(size_t index) { return 1ull << (index & 63); }
+
+    std::vector<uint64_t> words;
+    std::array<size_t, MAX_DEPTH> level_offset{};
+    std::array<size_t, MAX_DEPTH> word_count{};
+    size_t depth = 0;
+    size_t bit_count;
+};
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "Level.h"
+#include "PriceBitmap.h"
+#include "src/infrastructure/Prefault.h"
+
+/**
+ * @brief One side of the book: price -> Level
+ *
+ * Levels live in a power-of-two ring covering the window [base, base + window). Prices outside the window rest in
+ * an ordered overflow map, which only ever holds non-empty levels. When the best price drifts close to the edge of
+ * the window, recentre() slides the window onto it: levels leaving the window move to the overflow map, levels
+ * entering it move back into their ring slot. Memory is bounded by the window size, not by max_price.
+ *
+ * With window_ticks == 0 (or a window wider than the price range) the ladder is dense: every price in
+ * [0, max_price] has its slot and the window never moves. A book specialized on an instrument indexes its ladders
+ * by tick rather than by price and instantiates them on its own Level type.
+ */
+template <typename Level> class BasicPriceLadder {
+  public:
+    static constexpr Price npos = UINT64_MAX;
+
+    BasicPriceLadder(Price max_price, size_t window_ticks = 0, Price reference_price = 0)
+        : window(std::bit_ceil(static_cast<size_t>(window_ticks == 0 ? max_price + 1 : window_ticks))),
+          mask(window - 1), dense(window >= max_price + 1), max_price(max_price),
+          levels(dense ? max_price + 1 : window), occupancy(levels.size()), scratch(dense ? 0 : levels.size()) {
+        if (!dense) {
+            base = clampBase(reference_price);
+        }
+    }
+
+    Level& level(Price price) {
+        if (inWindow(price)) [[likely]] {
+            return levels[price & mask];
+        }
+        return overflow[price];
+    }
+
+    /**
+     * @brief Aggregate quantity resting at a price, 0 for an empty level (never creates an overflow entry)
+     */
+    Quantity quantityAt(Price price) const {
+        if (inWindow(price)) [[likely]] {
+            return levels[price & mask].getTotalQuantity();
+        }
+        auto it = overflow.find(price);
+        return it == overflow.end() ? 0 : it->second.getTotalQuantity();
+    }
+
+    /**
+     * @brief Aggregate quantities of the prices [from, to] into `out` (to - from + 1 entries): out[price - from], or
+     * out[to - price] when Descending
+     *
+     * The window part is read straight out of the level array, in at most two contiguous runs (the ring may wrap),
+     * and only the overflow map's non-empty levels are looked up: the cost is one strided load per tick, whatever
+     * number of orders rests on them.
+     */
+    template <bool Descending> void copyQuantities(Price from, Price to, uint64_t* out) const {
+        const size_t count = to - from + 1;
+        std::fill(out, out + count, uint64_t{0});
+        auto slot = [&](Price price) -> uint64_t& { return Descending ? out[to - price] : out[price - from]; };
+
+        Price low = std::max(from, base);
+        Price high = std::min(to, std::min(windowEnd() - 1, max_price));
+        while (low <= high) {
+            // up to the end of the ring or of the range, whichever comes first
+            size_t start = low & mask;
+            size_t run = std::min<size_t>(high - low + 1, window - start);
+            const Level* run_levels = levels.data() + start;
+            uint64_t* run_out = &slot(low);
+            for (size_t i = 0; i < run; ++i) {
+                if constexpr (Descending) {
+                    *(run_out - i) = run_levels[i].getTotalQuantity();
+                } else {
+                    run_out[i] = run_levels[i].getTotalQuantity();
+                }
+            }
+            low += run;
+        }
+        for (auto it = overflow.lower_bound(from); it != overflow.end() && it->first <= to; ++it) {
+            slot(it->first) = it->second.getTotalQuantity();
+        }
+    }
+
+    // software prefetch of a level slot, a no-op for prices outside the window (never touches the overflow map)
+    void prefetch(Price price) const {
+        if (inWindow(price) && price <= max_price) {
+            __builtin_prefetch(&levels[price & mask], 1);
+        }
+    }
+
+    void markOccupied(Price price) {
+        if (inWindow(price)) [[likely]] {
+            occupancy.set(price - base);
+        }
+    }
+
+    void markEmpty(Price price) {
+        if (inWindow(price)) [[likely]] {
+            occupancy.clear(price - base);
+        } else {
+            overflow.erase(price);
+        }
+    }
+
+    /**
+     * @brief Smallest non-empty price >= from, npos if none
+     */
+    Price nextOccupied(Price from) const {
+        if (from < base) {
+            auto it = overflow.lower_bound(from);
+            if (it != overflow.end() && it->first < base) {
+                return it->first;
+            }
+            from = base;
+        }
+        if (from < windowEnd()) {
+            size_t offset = occupancy.findNext(from - base);
+            if (offset != PriceBitmap::npos) [[likely]] {
+                return base + offset;
+            }
+            from = windowEnd();
+        }
+        auto it = overflow.lower_bound(from);
+        return it == overflow.end() ? npos : it->first;
+    }
+
+    /**
+     * @brief Largest non-empty price <= from, npos if none
+     */
+    Price prevOccupied(Price from) const {
+        if (from >= windowEnd()) {
+            auto it = overflow.upper_bound(from);
+            if (it != overflow.begin() && std::prev(it)->first >= windowEnd()) {
+                return std::prev(it)->first;
+            }
+            from = windowEnd() - 1;
+        }
+        if (from >= base) {
+            size_t offset = occupancy.findPrev(from - base);
+            if (offset != PriceBitmap::npos) [[likely]] {
+                return base + offset;
+            }
+            if (base == 0) {
+                return npos;
+            }
+            from = base - 1;
+        }
+        auto it = overflow.upper_bound(from);
+        return it == overflow.begin() ? npos : std::prev(it)->first;
+    }
+
+    /**
+     * @brief Keeps the best price in the inner part of the window, recentring on it when it drifts out
+     */
+    void follow(Price best) {
+        if (dense || best == npos) [[likely]] {
+            return;
+        }
+        size_t margin = window / 8;
+        if (best < base + margin || best >= windowEnd() - margin) [[unlikely]] {
+            recentre(best);
+        }
+    }
+
+    void recentre(Price centre) {
+        if (dense) {
+            return;
+        }
+        Price new_base = clampBase(centre);
+        if (new_base == base) {
+            return;
+        }
+        Price new_end = new_base + window;
+
+        // levels staying in the window keep their ring slot, the others are parked in the overflow map
+        for (size_t offset = occupancy.findNext(0); offset != PriceBitmap::npos;
+             offset = occupancy.findNext(offset + 1)) {
+            occupancy.clear(offset);
+            Price price = base + offset;
+            if (price >= new_base && price < new_end) {
+                scratch.set(price - new_base);
+            } else {
+                std::swap(overflow[price], levels[price & mask]);
+            }
+        }
+
+        // parked levels now covered by the window move back into their (empty) ring slot
+        for (auto it = overflow.lower_bound(new_base); it != overflow.end() && it->first < new_end;) {
+            std::swap(levels[it->first & mask], it->second);
+            scratch.set(it->first - new_base);
+            it = overflow.erase(it);
+        }
+
+        std::swap(occupancy, scratch);
+        base = new_base;
+    }
+
+    bool inWindow(Price price) const { return price - base < window; }
+    Price windowBegin() const { return base; }
+    Price windowEnd() const { return base + window; }
+    size_t overflowLevels() const { return overflow.size(); }
+
+    // the ring (or dense array) and its bitmaps; overflow levels are allocated one by one and not covered
+    bool prefault(bool lock) {
+        bool resident = prefaultRange(levels.data(), levels.size() * sizeof(Level), lock);
+        resident &= occupancy.prefault(lock);
+        resident &= scratch.prefault(lock);
+        return resident;
+    }
+
+  private:
+    Price clampBase(Price centre) const {
+        Price half = window / 2;
+        Price highest_base = max_price + 1 - window;
+        return std::min(centre > half ? centre - half : 0, highest_base);
+    }
+
+    size_t window;
+    size_t mask;
+    bool dense;
+    Price max_price;
+    Price base = 0;
+
+    std::vector<Level> levels;
+    PriceBitmap occupancy; // bit (price - base) set for every non-empty level in the window
+    PriceBitmap scratch;   // rebuilt occupancy while recentring
+
+    std::map<Price, Level> overflow;
+};
+
+using PriceLadder = BasicPriceLadder<Level>;
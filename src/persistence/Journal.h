@@ -0,0 +1,267 @@
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "src/domain/Command.h"
+
+/**
+ * @brief One journaled command: fixed 64 bytes, one cache line, never straddles a page
+ *
+ * Sequences start at 1, so an all-zero record marks the end of the written part of a (zero-filled, preallocated)
+ * segment. The checksum covers everything before it and catches records torn by a crash mid-write.
+ */
+struct alignas(64) JournalRecord {
+    uint64_t sequence;
+    Timestamp timestamp;
+    Command command;
+    uint32_t checksum;
+
+    static uint32_t computeChecksum(const JournalRecord& record) {
+        // FNV-1a over the payload
+        const auto* bytes = reinterpret_cast<const unsigned char*>(&record);
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < offsetof(JournalRecord, checksum); ++i) {
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+        return hash;
+    }
+
+    bool valid(uint64_t expected_sequence) const {
+        return sequence == expected_sequence && checksum == computeChecksum(*this);
+    }
+};
+static_assert(sizeof(JournalRecord) == 64);
+
+struct JournalHeader {
+    static constexpr char MAGIC[8] = {'M', 'E', 'J', 'R', 'N', 'L', '0', '2'};
+    static constexpr size_t SIZE = 4096; // records start on the second page
+
+    char magic[8];
+    uint32_t record_size;
+    uint32_t reserved;
+    uint64_t capacity;       // records
+    uint64_t first_sequence; // sequence of record 0
+};
+
+/**
+ * @brief A journal segment file mapped in memory: header page followed by `capacity` fixed-size records
+ */
+class JournalSegment {
+  public:
+    // opens `path`, creating and preallocating it for `capacity` records if it doesn't exist
+    JournalSegment(const std::string& path, uint64_t capacity, uint64_t first_sequence, bool writable) {
+        fd = ::open(path.c_str(), writable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "open " + path);
+        }
+        struct stat file_stat {};
+        ::fstat(fd, &file_stat);
+        bool created = file_stat.st_size == 0;
+        if (created) {
+            if (!writable) {
+                fail("empty journal " + path);
+            }
+            size_t bytes = JournalHeader::SIZE + capacity * sizeof(JournalRecord);
+            int error = ::posix_fallocate(fd, 0, static_cast<off_t>(bytes));
+            if (error != 0 && ::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+                fail("preallocate " + path);
+            }
+            mapped_bytes = bytes;
+        } else {
+            mapped_bytes = static_cast<size_t>(file_stat.st_size);
+        }
+
+        // a writer maps every page up front so appends never take a page fault
+        int protection = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+        int flags = writable ? MAP_SHARED | MAP_POPULATE : MAP_SHARED;
+        void* address = ::mmap(nullptr, mapped_bytes, protection, flags, fd, 0);
+        if (address == MAP_FAILED) {
+            fail("mmap " + path);
+        }
+        base = static_cast<char*>(address);
+        if (!writable) {
+            ::madvise(base, mapped_bytes, MADV_SEQUENTIAL);
+        }
+
+        if (created) {
+            JournalHeader header{};
+            std::memcpy(header.magic, JournalHeader::MAGIC, sizeof(header.magic));
+            header.record_size = sizeof(JournalRecord);
+            header.capacity = capacity;
+            header.first_sequence = first_sequence;
+            std::memcpy(base, &header, sizeof(header));
+        }
+        std::memcpy(&header_copy, base, sizeof(header_copy));
+        if (std::memcmp(header_copy.magic, JournalHeader::MAGIC, sizeof(header_copy.magic)) != 0 ||
+            header_copy.record_size != sizeof(JournalRecord) ||
+            JournalHeader::SIZE + header_copy.capacity * sizeof(JournalRecord) > mapped_bytes) {
+            fail("not a journal segment: " + path);
+        }
+    }
+
+    ~JournalSegment() {
+        if (base != nullptr) {
+            ::munmap(base, mapped_bytes);
+        }
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+
+    JournalSegment(const JournalSegment&) = delete;
+    JournalSegment& operator=(const JournalSegment&) = delete;
+
+    JournalRecord* records() { return reinterpret_cast<JournalRecord*>(base + JournalHeader::SIZE); }
+    const JournalRecord* records() const { return reinterpret_cast<const JournalRecord*>(base + JournalHeader::SIZE); }
+    uint64_t capacity() const { return header_copy.capacity; }
+    uint64_t firstSequence() const { return header_copy.first_sequence; }
+
+    /**
+     * @brief Number of valid records from the start of the segment (stops at the first empty or torn record)
+     */
+    uint64_t countValid() const {
+        uint64_t count = 0;
+        while (count < capacity() && records()[count].valid(firstSequence() + count)) {
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Zeroes whatever follows the first `count` records (a torn record and anything written after it)
+     */
+    void truncate(uint64_t count) {
+        uint64_t end = count;
+        while (end < capacity() && records()[end].sequence != 0) {
+            std::memset(static_cast<void*>(&records()[end]), 0, sizeof(JournalRecord));
+            ++end;
+        }
+        if (end > count) {
+            sync(count, end);
+        }
+    }
+
+    // flushes records [begin, end) of the mapping to the file
+    void sync(uint64_t begin, uint64_t end) {
+        static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        size_t from = (JournalHeader::SIZE + begin * sizeof(JournalRecord)) / page * page;
+        size_t to = JournalHeader::SIZE + end * sizeof(JournalRecord);
+        ::msync(base + from, to - from, MS_SYNC);
+    }
+
+  private:
+    [[noreturn]] void fail(const std::string& what) {
+        int error = errno;
+        if (base != nullptr) {
+            ::munmap(base, mapped_bytes);
+        }
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), what);
+    }
+
+    int fd = -1;
+    char* base = nullptr;
+    size_t mapped_bytes = 0;
+    JournalHeader header_copy{};
+};
+
+/**
+ * @brief Append-only command journal with group commit
+ *
+ * The matching thread appends fixed-size records into a preallocated, memory-mapped segment: a 64-byte store and
+ * a release increment, no system call. A background flusher thread msyncs everything appended since its last
+ * pass, so one sync covers a whole group of commands, and publishes how far the journal is durable.
+ * Reopening an existing segment recovers its valid prefix and continues after it. A full segment rejects appends;
+ * the owner rolls over to a new segment starting at lastSequence() + 1.
+ */
+class CommandJournal {
+  public:
+    CommandJournal(const std::string& path, uint64_t capacity, uint64_t first_sequence = 1,
+                   std::chrono::microseconds flush_interval = std::chrono::microseconds(200))
+        : segment(path, capacity, first_sequence, true), flush_interval(flush_interval) {
+        uint64_t recovered = segment.countValid();
+        segment.truncate(recovered);
+        appended.store(recovered, std::memory_order_relaxed);
+        durable.store(recovered, std::memory_order_relaxed);
+        flusher = std::thread([this] { flushLoop(); });
+    }
+
+    ~CommandJournal() {
+        stopping.store(true, std::memory_order_release);
+        flusher.join();
+    }
+
+    CommandJournal(const CommandJournal&) = delete;
+    CommandJournal& operator=(const CommandJournal&) = delete;
+
+    /**
+     * @brief Appends one command (single writer), false if the segment is full
+     */
+    bool append(const Command& command, Timestamp timestamp = 0) {
+        uint64_t index = appended.load(std::memory_order_relaxed);
+        if (index == segment.capacity()) [[unlikely]] {
+            return false;
+        }
+        JournalRecord record{};
+        record.sequence = segment.firstSequence() + index;
+        record.timestamp = timestamp;
+        record.command = command;
+        record.checksum = JournalRecord::computeChecksum(record);
+        std::memcpy(&segment.records()[index], &record, sizeof(record)); // bytes exactly as checksummed
+        appended.store(index + 1, std::memory_order_release);
+        return true;
+    }
+
+    // sequence of the last appended command (firstSequence() - 1 if none)
+    uint64_t lastSequence() const { return segment.firstSequence() + appended.load(std::memory_order_acquire) - 1; }
+    // every command up to this sequence has reached the file
+    uint64_t durableSequence() const { return segment.firstSequence() + durable.load(std::memory_order_acquire) - 1; }
+
+    /**
+     * @brief Blocks until everything appended so far is durable
+     */
+    void sync() {
+        uint64_t target = appended.load(std::memory_order_acquire);
+        while (durable.load(std::memory_order_acquire) < target) {
+            std::this_thread::sleep_for(flush_interval / 4);
+        }
+    }
+
+  private:
+    void flushLoop() {
+        while (true) {
+            bool stop = stopping.load(std::memory_order_acquire);
+            uint64_t target = appended.load(std::memory_order_acquire);
+            uint64_t synced = durable.load(std::memory_order_relaxed);
+            if (target > synced) {
+                segment.sync(synced, target);
+                durable.store(target, std::memory_order_release);
+            }
+            if (stop) {
+                return;
+            }
+            std::this_thread::sleep_for(flush_interval);
+        }
+    }
+
+    JournalSegment segment;
+    std::chrono::microseconds flush_interval;
+
+    alignas(64) std::atomic<uint64_t> appended{0}; // records written, matching thread
+    alignas(64) std::atomic<uint64_t> durable{0};  // records synced, flusher thread
+    std::atomic<bool> stopping{false};
+    std::thread flusher;
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "Journal.h"
+#include "src/engines/MatchingEngine.h"
+
+/**
+ * @brief Read-only view of a journal segment for recovery
+ *
+ * The segment is mapped, not read: records are handed out in place, and the mapping is advised sequential so the
+ * kernel reads the file ahead. Iteration stops at the first empty or torn record, so a segment cut short by a crash
+ * replays its valid prefix.
+ */
+class JournalReader {
+  public:
+    explicit JournalReader(const std::string& path) : segment(path, 0, 0, false), valid_records(segment.countValid()) {}
+
+    uint64_t firstSequence() const { return segment.firstSequence(); }
+    uint64_t recordCount() const { return valid_records; }
+    // sequence of the last valid record (firstSequence() - 1 if the segment is empty)
+    uint64_t lastSequence() const { return segment.firstSequence() + valid_records - 1; }
+
+    /**
+     * @brief Hands every valid record with a sequence >= `from_sequence` to `handler`, returns how many
+     */
+    template <typename Handler> uint64_t forEach(Handler&& handler, uint64_t from_sequence = 0) const {
+        uint64_t begin = from_sequence > firstSequence() ? from_sequence - firstSequence() : 0;
+        const JournalRecord* records = segment.records();
+        for (uint64_t i = begin; i < valid_records; ++i) {
+            handler(records[i]);
+        }
+        return begin < valid_records ? valid_records - begin : 0;
+    }
+
+  private:
+    JournalSegment segment;
+    uint64_t valid_records;
+};
+
+/**
+ * @brief Rebuilds a book by feeding the journaled commands through the engine, returns the last replayed sequence
+ *
+ * `resolve_book(symbol)` returns the book of a symbol, so one driver serves single- and multi-symbol journals.
+ * Replaying from `from_sequence` on top of a book restored at `from_sequence - 1` resumes recovery from there.
+ */
+template <typename BookResolver, typename Listener>
+uint64_t replayJournal(const JournalReader& reader, BookResolver&& resolve_book, Listener& listener,
+                       uint64_t from_sequence = 0) {
+    uint64_t last_sequence = from_sequence > 0 ? from_sequence - 1 : 0;
+    reader.forEach(
+        [&](const JournalRecord& record) {
+            MatchingEngine::process(record.command, resolve_book(record.command.symbol), listener);
+            last_sequence = record.sequence;
+        },
+        from_sequence);
+    return last_sequence;
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "src/orderbook/OrderBook.h"
+
+/**
+ * @brief Point-in-time image of one book: this header followed by `order_count` packed Orders
+ *
+ * Orders are stored bids first then asks, best level first, each level in time priority, so restoring them in
+ * file order rebuilds every queue exactly. `journal_sequence` is the last journaled command the image includes:
+ * recovery restores the snapshot, then replays the journal from the next sequence. The checksum covers the header
+ * fields before it and every order, and catches a file damaged since it was written.
+ */
+struct SnapshotHeader {
+    static constexpr char MAGIC[8] = {'M', 'E', 'S', 'N', 'A', 'P', '0', '3'};
+
+    char magic[8];
+    uint64_t journal_sequence;
+    uint64_t order_count;
+    Price max_price;
+    Price max_bid;
+    Price min_ask;
+    uint64_t checksum;
+
+    // FNV-1a over 64-bit words, in four interleaved lanes folded at the end: the lanes' multiplies overlap, so
+    // hashing keeps pace with reading a snapshot of millions of orders
+    static uint64_t computeChecksum(const SnapshotHeader& header, std::span<const Order> orders) {
+        constexpr uint64_t BASIS = 14695981039346656037ull;
+        constexpr uint64_t PRIME = 1099511628211ull;
+        uint64_t lanes[4] = {BASIS, BASIS, BASIS, BASIS};
+        auto mix = [&lanes](const void* data, size_t bytes) {
+            const char* words = static_cast<const char*>(data);
+            size_t count = bytes / sizeof(uint64_t);
+            for (size_t i = 0; i < count; ++i) {
+                uint64_t word;
+                std::memcpy(&word, words + i * sizeof(uint64_t), sizeof(word));
+                lanes[i % 4] = (lanes[i % 4] ^ word) * PRIME;
+            }
+        };
+        mix(&header, offsetof(SnapshotHeader, checksum));
+        mix(orders.data(), orders.size_bytes());
+        uint64_t hash = BASIS;
+        for (uint64_t lane : lanes) {
+            hash = (hash ^ lane) * PRIME;
+        }
+        return hash;
+    }
+};
+static_assert(offsetof(SnapshotHeader, checksum) % sizeof(uint64_t) == 0 && sizeof(Order) % sizeof(uint64_t) == 0);
+
+namespace snapshot_detail {
+
+inline void writeAll(int fd, const void* data, size_t bytes, const std::string& path) {
+    const char* cursor = static_cast<const char*>(data);
+    while (bytes > 0) {
+        ssize_t written = ::write(fd, cursor, bytes);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "write " + path);
+        }
+        cursor += written;
+        bytes -= static_cast<size_t>(written);
+    }
+}
+
+} // namespace snapshot_detail
+
+/**
+ * @brief Writes a snapshot of `book` to `path`, atomically: the file is written aside, synced, then renamed
+ */
+inline void writeSnapshot(OrderBook& book, const std::string& path, uint64_t journal_sequence = 0) {
+    std::vector<Order> orders;
+    orders.reserve(book.resting_orders_pool.highWaterMark());
+    book.forEachRestingOrder([&](const Order& order) { orders.push_back(order); });
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, SnapshotHeader::MAGIC, sizeof(header.magic));
+    header.journal_sequence = journal_sequence;
+    header.order_count = orders.size();
+    header.max_price = book.max_price;
+    header.max_bid = book.max_bid;
+    header.min_ask = book.min_ask;
+    header.checksum = SnapshotHeader::computeChecksum(header, orders);
+
+    std::string temporary = path + ".tmp";
+    int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "open " + temporary);
+    }
+    snapshot_detail::writeAll(fd, &header, sizeof(header), temporary);
+    snapshot_detail::writeAll(fd, orders.data(), orders.size() * sizeof(Order), temporary);
+    if (::fsync(fd) != 0) {
+        int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), "fsync " + temporary);
+    }
+    ::close(fd);
+    if (::rename(temporary.c_str(), path.c_str()) != 0) {
+        throw std::system_error(errno, std::generic_category(), "rename " + temporary);
+    }
+}
+
+/**
+ * @brief Loads a snapshot into an empty book, returns the journal sequence it was taken at
+ *
+ * The file is mapped and its orders are bulk-loaded straight from the mapping (OrderBook::restore), without a
+ * copy and without going through matching. Throws, leaving the book empty, if the file is not a snapshot, fails its
+ * checksum, was taken for another price range or capacity, or holds orders or cursors the book rejects.
+ */
+inline uint64_t restoreSnapshot(const std::string& path, OrderBook& book) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "open " + path);
+    }
+    struct stat file_stat {};
+    ::fstat(fd, &file_stat);
+    size_t bytes = static_cast<size_t>(file_stat.st_size);
+    if (bytes < sizeof(SnapshotHeader)) {
+        ::close(fd);
+        throw std::runtime_error("not a snapshot: " + path);
+    }
+    void* address = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+    int error = errno;
+    ::close(fd);
+    if (address == MAP_FAILED) {
+        throw std::system_error(error, std::generic_category(), "mmap " + path);
+    }
+
+    const char* base = static_cast<const char*>(address);
+    SnapshotHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    // the file size gives the order count, compared rather than multiplied out: a damaged count must not wrap
+    size_t payload = bytes - sizeof(SnapshotHeader);
+    const char* problem = nullptr;
+    if (std::memcmp(header.magic, SnapshotHeader::MAGIC, sizeof(header.magic)) != 0 ||
+        payload % sizeof(Order) != 0 || header.order_count != payload / sizeof(Order)) {
+        problem = "not a snapshot: ";
+    } else if (header.max_price != book.max_price) {
+        problem = "snapshot taken for another price range: ";
+    } else if (header.order_count > book.resting_orders_pool.capacity()) {
+        problem = "snapshot exceeds the book capacity: ";
+    } else {
+        std::span<const Order> orders(reinterpret_cast<const Order*>(base + sizeof(SnapshotHeader)),
+                                      header.order_count);
+        if (header.checksum != SnapshotHeader::computeChecksum(header, orders)) {
+            problem = "snapshot checksum mismatch: ";
+        } else if (!book.restore(orders, header.max_bid, header.min_ask)) {
+            problem = "snapshot holds orders or cursors the book cannot restore: ";
+        }
+    }
+    ::munmap(address, bytes);
+    if (problem != nullptr) {
+        throw std::runtime_error(problem + path);
+    }
+    return header.journal_sequence;
+}
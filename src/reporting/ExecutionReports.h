@@ -0,0 +1,236 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <utility>
+
+#include "src/domain/Order.h"
+#include "src/infrastructure/LockFreeQueue.h"
+#include "src/infrastructure/Thread.h"
+
+enum class ReportType : uint8_t { Trade, Added, Canceled, Modified, Rejected, Expired };
+
+/**
+ * @brief One engine event as a fixed-size (40 bytes) binary record
+ *
+ * Sequences start at 1 and are consecutive per listener, so a consumer sees a gap wherever records were dropped.
+ * `id` is the aggressor of a trade or the order of any other event, `resting_id` is only set for trades. A cancel
+ * reported by a single-order cancel carries only the id; one from a mass cancel also carries the order's side, price
+ * and remaining quantity.
+ */
+struct ExecutionReport {
+    uint64_t sequence;
+    OrderId id;
+    OrderId resting_id;
+    Price price;
+    Quantity quantity;
+    ReportType type;
+    Side side;
+    RejectReason reason;
+};
+static_assert(sizeof(ExecutionReport) == 40);
+
+/**
+ * @brief What a report listener does when the ring is full: wait for the consumer, or drop (and count) the records
+ */
+enum class BackPressure : uint8_t { Block, Drop };
+
+/**
+ * @brief Engine listener that turns events into ExecutionReports for another thread instead of handling them inline
+ *
+ * Records are staged in a small local buffer and published to the ring with one pushBatch (one release store) when
+ * the buffer fills or on flush(), which the matching thread calls at the end of each input batch. Under
+ * BackPressure::Block a full ring makes flush() spin until the consumer frees room; under Drop the records that do not
+ * fit are discarded and counted, and the matching thread never waits. Producer side only: every method runs on the
+ * matching thread.
+ */
+class ReportingListener {
+  public:
+    ReportingListener(LockFreeQueue<ExecutionReport>& ring, BackPressure back_pressure)
+        : ring(ring), back_pressure(back_pressure) {}
+
+    void onTrade(OrderId incoming_id, OrderId resting_id, Price price, Quantity quantity) {
+        stage(ReportType::Trade, incoming_id, resting_id, price, quantity, Side::Buy);
+    }
+    void onOrderAdded(const Order& order) {
+        stage(ReportType::Added, order.id, 0, order.price, order.quantity, order.side);
+    }
+    void onOrderCanceled(OrderId id) { stage(ReportType::Canceled, id, 0, 0, 0, Side::Buy); }
+    void onOrdersCanceled(std::span<const Order> orders) {
+        for (const Order& order : orders) {
+            stage(ReportType::Canceled, order.id, 0, order.price, order.quantity, order.side);
+        }
+    }
+    void onOrderModified(const Order& order) {
+        stage(ReportType::Modified, order.id, 0, order.price, order.quantity, order.side);
+    }
+    void onOrderRejected(const Order& order, RejectReason reason) {
+        stage(ReportType::Rejected, order.id, 0, order.price, order.quantity, order.side, reason);
+    }
+    void onOrderExpired(const Order& order) {
+        stage(ReportType::Expired, order.id, 0, order.price, order.quantity, order.side);
+    }
+
+    /**
+     * @brief Publishes the staged records
+     */
+    void flush() {
+        std::span<const ExecutionReport> pending(staged.data(), staged_count);
+        staged_count = 0;
+        while (!pending.empty()) {
+            size_t pushed = ring.pushBatch(pending);
+            published += pushed;
+            pending = pending.subspan(pushed);
+            if (pending.empty()) {
+                break;
+            }
+            if (back_pressure == BackPressure::Drop) {
+                dropped += pending.size();
+                break;
+            }
+            // the consumer may share this core: give it the core now and then rather than spin out a time slice
+            if (++stalls % 64 == 0) {
+                std::this_thread::yield();
+            } else {
+                cpuRelax();
+            }
+        }
+    }
+
+    uint64_t lastSequence() const { return sequence; }
+    uint64_t publishedCount() const { return published; }
+    uint64_t droppedCount() const { return dropped; }
+    uint64_t stallCount() const { return stalls; } // flush() spins that found the ring still full (Block)
+
+  private:
+    static constexpr size_t STAGE = 64;
+
+    void stage(ReportType type, OrderId id, OrderId resting_id, Price price, Quantity quantity, Side side,
+               RejectReason reason = {}) {
+        staged[staged_count++] = {++sequence, id, resting_id, price, quantity, type, side, reason};
+        if (staged_count == STAGE) [[unlikely]] {
+            flush();
+        }
+    }
+
+    LockFreeQueue<ExecutionReport>& ring;
+    BackPressure back_pressure;
+    uint64_t sequence = 0;
+    uint64_t published = 0;
+    uint64_t dropped = 0;
+    uint64_t stalls = 0;
+    size_t staged_count = 0;
+    std::array<ExecutionReport, STAGE> staged;
+};
+
+/**
+ * @brief Execution reports handled off the matching thread: a ring, its producer-side listener and a consumer thread
+ *
+ * The matching thread passes listener() to MatchingEngine and calls flush() after each input batch; the consumer
+ * thread drains the ring in batches of up to MAX_BATCH records, calling `handler(const ExecutionReport&)` on each in
+ * place and releasing the whole batch with one store. Whatever the handler costs (formatting, logging, sending) only
+ * delays the matching thread once the ring is full, and then only under BackPressure::Block.
+ */
+template <typename Handler> class ExecutionReportPipeline {
+  public:
+    /**
+     * @param capacity ring size in records (rounded up to a power of two)
+     * @param core core the consumer thread is pinned to, -1 for none
+     */
+    ExecutionReportPipeline(size_t capacity, Handler handler, BackPressure back_pressure = BackPressure::Block,
+                            int core = -1)
+        : ring(capacity), reporting(ring, back_pressure), handler(std::move(handler)), core(core) {}
+
+    ~ExecutionReportPipeline() { stop(); }
+
+    ExecutionReportPipeline(const ExecutionReportPipeline&) = delete;
+    ExecutionReportPipeline& operator=(const ExecutionReportPipeline&) = delete;
+
+    void start() {
+        running.store(true, std::memory_order_release);
+        consumer = std::thread([this] { run(); });
+    }
+
+    /**
+     * @brief Flushes, lets the consumer drain the ring, then joins it (no-op if it was never started)
+     */
+    void stop() {
+        if (!consumer.joinable()) {
+            return;
+        }
+        reporting.flush();
+        running.store(false, std::memory_order_release);
+        consumer.join();
+    }
+
+    // ---------------------------------------------------------------- matching thread
+
+    ReportingListener& listener() { return reporting; }
+    void flush() { reporting.flush(); }
+
+    /**
+     * @brief Flushes and spins until the consumer has handled every published record
+     */
+    void waitUntilDrained() {
+        reporting.flush();
+        for (uint64_t spins = 1; consumed.load(std::memory_order_acquire) != reporting.publishedCount(); ++spins) {
+            if (spins % 64 == 0) {
+                std::this_thread::yield();
+            } else {
+                cpuRelax();
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------- any thread
+
+    uint64_t consumedCount() const { return consumed.load(std::memory_order_acquire); }
+
+    // only safe once stopped
+    Handler& reportHandler() { return handler; }
+
+  private:
+    static constexpr size_t MAX_BATCH = 256;
+
+    void run() {
+        if (core >= 0) {
+            pinCurrentThread(core);
+        }
+        uint64_t handled = 0;
+        uint64_t idle = 0;
+        bool stopping = false;
+        while (true) {
+            size_t batch = ring.consumeBatch([this](const ExecutionReport& report) { handler(report); }, MAX_BATCH);
+            if (batch > 0) {
+                handled += batch;
+                consumed.store(handled, std::memory_order_release);
+                continue;
+            }
+            if (stopping) {
+                break;
+            }
+            // one more pass after seeing the stop flag: everything flushed before stop() is handled
+            stopping = !running.load(std::memory_order_acquire);
+            if (!stopping) {
+                // as in flush(): the matching thread may share this core
+                if (++idle % 64 == 0) {
+                    std::this_thread::yield();
+                } else {
+                    cpuRelax();
+                }
+            }
+        }
+    }
+
+    LockFreeQueue<ExecutionReport> ring;
+    ReportingListener reporting;
+    Handler handler;
+    int core;
+    std::thread consumer;
+    std::atomic<bool> running{false};
+    alignas(64) std::atomic<uint64_t> consumed{0};
+};
@@ -0,0 +1,315 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "src/domain/Command.h"
+#include "src/engines/MatchingEngine.h"
+
+/**
+ * @brief Shape of a synthetic order flow
+ *
+ * Every generated command is a cancel, a modify, an aggressive (crossing) order or a passive add, in the given
+ * proportions. Passive prices are drawn around a mid that random-walks by one tick; their distance from the mid is
+ * geometric, so most liquidity sits near the touch. Sizes are a geometric number of lots. The generator cancels
+ * instead of adding once `max_depth` orders rest, which keeps the book around that depth; conversely adds must cover
+ * cancels plus fills, otherwise the book drains and cancels of an empty book turn into adds.
+ */
+struct WorkloadProfile {
+    const char* name = "default";
+    uint64_t seed = 1;
+
+    // command mix in percent, passive adds make up the rest
+    unsigned cancel_percent = 40;
+    unsigned modify_percent = 10;
+    unsigned aggress_percent = 5;
+
+    Price max_price = 100'000;
+    Price initial_mid = 50'000;
+    double mid_move_probability = 0.01; // per command, the mid moves one tick up or down
+    double mean_distance_ticks = 5.0;   // mean distance of passive orders from the mid
+    Price max_distance_ticks = 500;
+    Price aggress_ticks = 2; // aggressive orders are priced this far through the mid
+
+    Quantity lot_size = 100;
+    double mean_lots = 3.0;
+    Quantity max_lots = 100;
+
+    size_t initial_depth = 5'000; // passive orders in the setup part of the stream
+    size_t max_depth = 10'000;
+};
+
+/**
+ * @brief A generated (or loaded) stream: setup commands build the initial book, flow commands are the workload
+ */
+struct WorkloadStream {
+    static constexpr char MAGIC[8] = {'M', 'E', 'W', 'K', 'L', 'D', '0', '1'};
+
+    Price max_price = 0;
+    size_t peak_resting_orders = 0; // book capacity needed to replay the stream without rejects
+    std::vector<Command> setup;
+    std::vector<Command> flow;
+
+    /**
+     * @brief Binary format: magic, max_price, peak_resting_orders, setup count, flow count, then the raw commands
+     */
+    void save(const std::string& path) const {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        uint64_t fields[4] = {max_price, peak_resting_orders, setup.size(), flow.size()};
+        file.write(MAGIC, sizeof(MAGIC));
+        file.write(reinterpret_cast<const char*>(fields), sizeof(fields));
+        file.write(reinterpret_cast<const char*>(setup.data()), setup.size() * sizeof(Command));
+        file.write(reinterpret_cast<const char*>(flow.data()), flow.size() * sizeof(Command));
+        if (!file) {
+            throw std::runtime_error("cannot write workload " + path);
+        }
+    }
+
+    static WorkloadStream load(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        char magic[8] = {};
+        uint64_t fields[4] = {};
+        file.read(magic, sizeof(magic));
+        file.read(reinterpret_cast<char*>(fields), sizeof(fields));
+        if (!file || std::memcmp(magic, MAGIC, sizeof(magic)) != 0) {
+            throw std::runtime_error("not a workload: " + path);
+        }
+        WorkloadStream stream;
+        stream.max_price = fields[0];
+        stream.peak_resting_orders = fields[1];
+        stream.setup.resize(fields[2]);
+        stream.flow.resize(fields[3]);
+        file.read(reinterpret_cast<char*>(stream.setup.data()), stream.setup.size() * sizeof(Command));
+        file.read(reinterpret_cast<char*>(stream.flow.data()), stream.flow.size() * sizeof(Command));
+        if (!file) {
+            throw std::runtime_error("truncated workload: " + path);
+        }
+        return stream;
+    }
+};
+
+/**
+ * @brief Deterministic, seedable order flow generator
+ *
+ * The generator runs its own commands through a shadow book, so it knows exactly which orders are still resting
+ * (fills included): every cancel and modify it emits targets a live order. The same profile and seed always give
+ * the same stream on a given build; random draws only use raw mt19937_64 output, not the library's distributions.
+ */
+class WorkloadGenerator {
+  public:
+    explicit WorkloadGenerator(const WorkloadProfile& profile)
+        : profile(profile), rng(profile.seed), mid(profile.initial_mid),
+          shadow(profile.max_depth + 1, profile.max_price) {}
+
+    WorkloadStream generate(size_t flow_commands) {
+        WorkloadStream stream;
+        stream.max_price = profile.max_price;
+        stream.setup.reserve(profile.initial_depth);
+        stream.flow.reserve(flow_commands);
+        for (size_t i = 0; i < profile.initial_depth; ++i) {
+            stream.setup.push_back(emit(passive()));
+        }
+        for (size_t i = 0; i < flow_commands; ++i) {
+            stream.flow.push_back(emit(next()));
+        }
+        stream.peak_resting_orders = peak;
+        return stream;
+    }
+
+  private:
+    Command emit(const Command& command) {
+        filled.clear();
+        auto listener = MatchingEngineListener{
+            [&](OrderId, OrderId resting_id, Price, Quantity) { filled.push_back(resting_id); },
+            [&](const Order& order) { addLive(order.id); }, [&](OrderId id) { removeLive(id); },
+            [](const Order&) {}};
+        MatchingEngine::process(command, shadow, listener);
+        // fully filled resting orders, and a modified order that traded away entirely, are gone
+        for (OrderId id : filled) {
+            if (shadow.find(id) == nullptr) {
+                removeLive(id);
+            }
+        }
+        if (command.type == CommandType::Modify && shadow.find(command.id) == nullptr) {
+            removeLive(command.id);
+        }
+        peak = std::max(peak, live.size());
+        return command;
+    }
+
+    void addLive(OrderId id) {
+        if (position.emplace(id, live.size()).second) {
+            live.push_back(id);
+        }
+    }
+
+    void removeLive(OrderId id) {
+        auto it = position.find(id);
+        if (it == position.end()) {
+            return;
+        }
+        size_t index = it->second;
+        position.erase(it);
+        if (index + 1 != live.size()) {
+            live[index] = live.back();
+            position[live[index]] = index;
+        }
+        live.pop_back();
+    }
+
+    Command next() {
+        if (rng() < static_cast<uint64_t>(profile.mid_move_probability * static_cast<double>(UINT64_MAX))) {
+            bool up = rng() & 1;
+            Price lowest = profile.max_distance_ticks + profile.aggress_ticks + 1;
+            Price highest = profile.max_price - lowest;
+            mid = up ? std::min(mid + 1, highest) : std::max(mid - 1, lowest);
+        }
+
+        unsigned kind = static_cast<unsigned>(rng() % 100);
+        if (kind < profile.cancel_percent + profile.modify_percent && !live.empty()) {
+            OrderId target = live[rng() % live.size()];
+            if (kind < profile.cancel_percent) {
+                return Command::cancel(0, target);
+            }
+            const Order& resting = shadow.find(target)->order;
+            // half of the modifies only change the size, the others reprice on the same side of the mid
+            Price price = rng() & 1 ? resting.price : passivePrice(resting.side);
+            return Command::modify(0, target, price, size());
+        }
+        if (live.size() >= profile.max_depth) {
+            return Command::cancel(0, live[rng() % live.size()]);
+        }
+        if (kind < profile.cancel_percent + profile.modify_percent + profile.aggress_percent) {
+            Side side = rng() & 1 ? Side::Buy : Side::Sell;
+            Price price = side == Side::Buy ? mid + profile.aggress_ticks : mid - profile.aggress_ticks;
+            return Command::submit(0, Order(next_id++, size(), price, side));
+        }
+        return passive();
+    }
+
+    Command passive() {
+        Side side = rng() & 1 ? Side::Buy : Side::Sell;
+        return Command::submit(0, Order(next_id++, size(), passivePrice(side), side));
+    }
+
+    Price passivePrice(Side side) {
+        Price distance = std::min<Price>(1 + geometric(profile.mean_distance_ticks), profile.max_distance_ticks);
+        return side == Side::Buy ? mid - distance : mid + distance;
+    }
+
+    Quantity size() {
+        uint64_t lots = std::min<uint64_t>(1 + geometric(profile.mean_lots), profile.max_lots);
+        return static_cast<Quantity>(lots * profile.lot_size);
+    }
+
+    // geometric number of failures with the given mean, from raw generator bits (portable across standard libraries)
+    uint64_t geometric(double mean) {
+        double uniform = static_cast<double>((rng() >> 11) + 1) * 0x1.0p-53; // (0, 1]
+        double keep = mean / (1.0 + mean);
+        return static_cast<uint64_t>(std::floor(std::log(uniform) / std::log(keep)));
+    }
+
+    WorkloadProfile profile;
+    std::mt19937_64 rng;
+    Price mid;
+    OrderId next_id = 1;
+
+    OrderBook shadow;
+    std::vector<OrderId> live;
+    std::unordered_map<OrderId, size_t> position; // index of each live id in `live`
+    std::vector<OrderId> filled;                  // resting orders traded against by the current command
+    size_t peak = 0;
+};
+
+/**
+ * @brief Named market profiles used by the workload benchmarks
+ */
+namespace profiles {
+
+// liquid, large-tick instrument: deep queues at few levels, mostly passive flow
+inline WorkloadProfile liquidLargeTick() {
+    WorkloadProfile profile;
+    profile.name = "liquid_large_tick";
+    profile.cancel_percent = 40;
+    profile.modify_percent = 10;
+    profile.aggress_percent = 5;
+    profile.mean_distance_ticks = 2.0;
+    profile.mid_move_probability = 0.002;
+    profile.initial_depth = 20'000;
+    profile.max_depth = 40'000;
+    return profile;
+}
+
+// market makers re-quoting near the touch: cancel/modify dominated, very few trades
+inline WorkloadProfile quoteChurn() {
+    WorkloadProfile profile;
+    profile.name = "quote_churn";
+    profile.cancel_percent = 30;
+    profile.modify_percent = 35;
+    profile.aggress_percent = 2;
+    profile.mean_distance_ticks = 3.0;
+    profile.mid_move_probability = 0.02;
+    profile.initial_depth = 2'000;
+    profile.max_depth = 4'000;
+    return profile;
+}
+
+// market makers refreshing resting quotes with modifies instead of cancel/replace: sizes and prices move, queues
+// churn, the book barely trades
+inline WorkloadProfile quoteRefresh() {
+    WorkloadProfile profile;
+    profile.name = "quote_refresh";
+    profile.cancel_percent = 10;
+    profile.modify_percent = 70;
+    profile.aggress_percent = 2;
+    profile.mean_distance_ticks = 3.0;
+    profile.mid_move_probability = 0.02;
+    profile.initial_depth = 2'000;
+    profile.max_depth = 4'000;
+    return profile;
+}
+
+// trending, aggressive market: the mid moves often and a fifth of the flow takes liquidity
+inline WorkloadProfile volatileMomentum() {
+    WorkloadProfile profile;
+    profile.name = "volatile_momentum";
+    profile.cancel_percent = 25;
+    profile.modify_percent = 5;
+    profile.aggress_percent = 20;
+    profile.aggress_ticks = 4;
+    profile.mean_distance_ticks = 8.0;
+    profile.mid_move_probability = 0.1;
+    profile.mean_lots = 5.0;
+    profile.initial_depth = 1'000;
+    profile.max_depth = 5'000;
+    return profile;
+}
+
+// deep book spread over many levels: large index and cold levels, little trading
+inline WorkloadProfile deepBook() {
+    WorkloadProfile profile;
+    profile.name = "deep_book";
+    profile.cancel_percent = 25;
+    profile.modify_percent = 5;
+    profile.aggress_percent = 3;
+    profile.mean_distance_ticks = 200.0;
+    profile.max_distance_ticks = 5'000;
+    profile.mid_move_probability = 0.01;
+    profile.initial_depth = 500'000;
+    profile.max_depth = 1'000'000;
+    return profile;
+}
+
+inline std::vector<WorkloadProfile> all() {
+    return {liquidLargeTick(), quoteChurn(), quoteRefresh(), volatileMomentum(), deepBook()};
+}
+
+} // namespace profiles
@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "src/domain/Instruments.h"
+#include "src/engines/MatchingEngine.h"
+#include "src/orderbook/AuctionDepth.h"
+#include "src/orderbook/OrderBook.h"
+
+namespace {
+
+struct AuctionListener {
+    std::vector<std::tuple<OrderId, OrderId, Price, Quantity>> trades;
+    std::vector<OrderId> added;
+
+    void onTrade(OrderId buy_id, OrderId sell_id, Price price, Quantity quantity) {
+        trades.emplace_back(buy_id, sell_id, price, quantity);
+    }
+    void onOrderAdded(const Order& order) { added.push_back(order.id); }
+    void onOrderCanceled(OrderId) {}
+    void onOrderModified(const Order&) {}
+};
+
+// the auction rules evaluated the slow way, straight from the resting orders at every tick of the crossed range
+template <typename Book> AuctionResult bruteForceAuction(Book& book, Price reference_price, Price tick_size) {
+    std::vector<Order> orders;
+    book.forEachRestingOrder([&](const Order& order) { orders.push_back(order); });
+    if (!book.hasBids() || !book.hasAsks() || book.bestBid() < book.bestAsk()) {
+        return {};
+    }
+    struct Candidate {
+        Price price;
+        uint64_t volume;
+        int64_t surplus;
+    };
+    std::vector<Candidate> candidates;
+    for (Price price = book.bestAsk(); price <= book.bestBid(); price += tick_size) {
+        uint64_t demand = 0;
+        uint64_t supply = 0;
+        for (const Order& order : orders) {
+            if (order.side == Side::Buy && order.price >= price) {
+                demand += order.quantity;
+            } else if (order.side == Side::Sell && order.price <= price) {
+                supply += order.quantity;
+            }
+        }
+        candidates.push_back({price, std::min(demand, supply), static_cast<int64_t>(demand - supply)});
+    }
+    uint64_t volume = 0;
+    for (const Candidate& candidate : candidates) {
+        volume = std::max(volume, candidate.volume);
+    }
+    std::erase_if(candidates, [&](const Candidate& candidate) { return candidate.volume != volume; });
+    int64_t imbalance = INT64_MAX;
+    for (const Candidate& candidate : candidates) {
+        imbalance = std::min(imbalance, std::abs(candidate.surplus));
+    }
+    std::erase_if(candidates, [&](const Candidate& candidate) { return std::abs(candidate.surplus) != imbalance; });
+
+    bool all_positive = std::all_of(candidates.begin(), candidates.end(), [](auto& c) { return c.surplus > 0; });
+    bool all_negative = std::all_of(candidates.begin(), candidates.end(), [](auto& c) { return c.surplus < 0; });
+    if (all_positive) {
+        return {candidates.back().price, volume, candidates.back().surplus};
+    }
+    if (all_negative || candidates.size() == 1) {
+        return {candidates.front().price, volume, candidates.front().surplus};
+    }
+    Price target = reference_price;
+    if (target == 0) {
+        Price ticks = (candidates.back().price - candidates.front().price) / tick_size;
+        target = candidates.front().price + ticks / 2 * tick_size;
+    }
+    target = std::clamp(target, candidates.front().price, candidates.back().price);
+    auto distance = [&](const Candidate& c) { return c.price > target ? c.price - target : target - c.price; };
+    const Candidate& closest = *std::min_element(
+        candidates.begin(), candidates.end(), [&](auto& a, auto& b) { return distance(a) < distance(b); });
+    return {closest.price, volume, closest.surplus};
+}
+
+template <typename Book>
+void checkRandomAuctions(Book& book, Price low_price, Price tick_size, size_t levels, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    OrderId next_id = 1;
+    for (int round = 0; round < 40; ++round) {
+        book.beginAuction();
+        AuctionListener listener;
+        size_t count = 1 + rng() % 300;
+        for (size_t i = 0; i < count; ++i) {
+            Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            Price price = low_price + (rng() % levels) * tick_size;
+            MatchingEngine::submitOrder(Order(next_id++, 1 + rng() % 100, price, side), book, listener);
+        }
+        ASSERT_TRUE(listener.trades.empty());
+        Price reference = round % 3 == 0 ? 0 : low_price + (rng() % levels) * tick_size;
+
+        auto restingBids = [&] {
+            uint64_t quantity = 0;
+            book.forEachRestingOrder([&](const Order& order) {
+                quantity += order.side == Side::Buy ? order.quantity : 0;
+            });
+            return quantity;
+        };
+        uint64_t bid_quantity = restingBids();
+        AuctionResult expected = bruteForceAuction(book, reference, tick_size);
+        AuctionResult indicative = MatchingEngine::auctionPrice(book, reference);
+        ASSERT_EQ(indicative.price, expected.price) << round;
+        ASSERT_EQ(indicative.volume, expected.volume) << round;
+        ASSERT_EQ(indicative.surplus, expected.surplus) << round;
+
+        AuctionResult result = MatchingEngine::uncross(book, listener, reference);
+        ASSERT_EQ(result.price, expected.price);
+        uint64_t traded = 0;
+        for (const auto& [buy_id, sell_id, price, quantity] : listener.trades) {
+            ASSERT_EQ(price, expected.price);
+            traded += quantity;
+        }
+        ASSERT_EQ(traded, expected.volume);
+        ASSERT_EQ(bid_quantity - restingBids(), traded);
+        ASSERT_FALSE(book.inAuction());
+        ASSERT_TRUE(!book.hasBids() || !book.hasAsks() || book.bestBid() < book.bestAsk()) << round;
+    }
+}
+
+} // namespace
+
+TEST(AuctionTest, AccumulatesThenUncrossesInPriority) {
+    OrderBook book(100, 1'000);
+    AuctionListener listener;
+    book.beginAuction();
+    MatchingEngine::submitOrder(Order(1, 100, 102, Side::Buy), book, listener);
+    MatchingEngine::submitOrder(Order(2, 50, 101, Side::Buy), book, listener);
+    MatchingEngine::submitOrder(Order(3, 100, 100, Side::Buy), book, listener);
+    MatchingEngine::submitOrder(Order(4, 80, 99, Side::Sell), book, listener);
+    MatchingEngine::submitOrder(Order(5, 70, 100, Side::Sell), book, listener);
+    MatchingEngine::submitOrder(Order(6, 60, 101, Side::Sell), book, listener);
+    EXPECT_TRUE(listener.trades.empty());
+    EXPECT_EQ(listener.added.size(), 6);
+    EXPECT_EQ(book.bestBid(), 102);
+    EXPECT_EQ(book.bestAsk(), 99);
+
+    // volume 150 at both 100 and 101: 60 left over on the ask side at 101, 100 on the bid side at 100
+    AuctionResult indicative = MatchingEngine::auctionPrice(book);
+    EXPECT_EQ(indicative.price, 101);
+    EXPECT_EQ(indicative.volume, 150);
+    EXPECT_EQ(indicative.surplus, -60);
+
+    AuctionResult result = MatchingEngine::uncross(book, listener);
+    EXPECT_EQ(result.price, 101);
+    using Trade = std::tuple<OrderId, OrderId, Price, Quantity>;
+    EXPECT_EQ(listener.trades, (std::vector<Trade>{{1, 4, 101, 80}, {1, 5, 101, 20}, {2, 5, 101, 50}}));
+    EXPECT_FALSE(book.inAuction());
+    EXPECT_EQ(book.bestBid(), 100);
+    EXPECT_EQ(book.bestAsk(), 101);
+    EXPECT_EQ(book.find(3)->order.quantity, 100);
+    EXPECT_EQ(book.find(6)->order.quantity, 60);
+
+    // back to continuous matching
+    MatchingEngine::submitOrder(Order(7, 10, 101, Side::Buy), book, listener);
+    EXPECT_EQ(listener.trades.back(), (Trade{7, 6, 101, 10}));
+}
+
+TEST(AuctionTest, TieBreaks) {
+    AuctionListener listener;
+    auto auction = [&](Quantity bid, Quantity ask, Price reference) {
+        OrderBook book(10, 1'000);
+        book.beginAuction();
+        MatchingEngine::submitOrder(Order(1, bid, 102, Side::Buy), book, listener);
+        MatchingEngine::submitOrder(Order(2, ask, 100, Side::Sell), book, listener);
+        return MatchingEngine::auctionPrice(book, reference);
+    };
+    // same volume at 100, 101 and 102: buy pressure takes the highest price, sell pressure the lowest
+    EXPECT_EQ(auction(100, 50, 0).price, 102);
+    EXPECT_EQ(auction(100, 50, 0).surplus, 50);
+    EXPECT_EQ(auction(50, 100, 0).price, 100);
+    EXPECT_EQ(auction(50, 100, 0).surplus, -50);
+    // balanced: the reference price, clamped to the candidates, or their middle without one
+    EXPECT_EQ(auction(50, 50, 0).price, 101);
+    EXPECT_EQ(auction(50, 50, 100).price, 100);
+    EXPECT_EQ(auction(50, 50, 500).price, 102);
+}
+
+TEST(AuctionTest, ModifiesAndCancelsDoNotMatchDuringTheAuction) {
+    OrderBook book(10, 1'000);
+    AuctionListener listener;
+    MatchingEngine::submitOrder(Order(1, 10, 100, Side::Sell), book, listener);
+    EXPECT_EQ(MatchingEngine::uncross(book, listener).price, 0); // nothing crosses, nothing trades
+
+    book.beginAuction();
+    MatchingEngine::submitOrder(Order(2, 10, 95, Side::Buy), book, listener);
+    MatchingEngine::modifyOrder(2, 105, 20, book, listener);
+    MatchingEngine::submitOrder(Order(3, 10, 104, Side::Buy), book, listener);
+    MatchingEngine::cancelOrder(3, book, listener);
+    EXPECT_TRUE(listener.trades.empty());
+    EXPECT_EQ(book.bestBid(), 105);
+    EXPECT_EQ(book.find(2)->order.quantity, 20);
+
+    AuctionResult result = MatchingEngine::uncross(book, listener);
+    EXPECT_EQ(result.price, 105);
+    EXPECT_EQ(result.volume, 10);
+    ASSERT_EQ(listener.trades.size(), 1);
+    EXPECT_EQ(book.find(2)->order.quantity, 10);
+    EXPECT_FALSE(book.hasAsks());
+}
+
+TEST(AuctionTest, MatchesBruteForce) {
+    OrderBook dense(20'000, 1'000);
+    checkRandomAuctions(dense, 400, 1, 200, 1);
+
+    // the crossed range straddles the window and the overflow maps
+    OrderBook windowed(20'000, 100'000, 64, 500);
+    checkRandomAuctions(windowed, 400, 1, 300, 2);
+
+    BasicOrderBook<LargeTickFuture> future(20'000, LargeTickFuture::MAX_PRICE);
+    checkRandomAuctions(future, LargeTickFuture::MIN_PRICE + 100 * LargeTickFuture::TICK_SIZE,
+                        LargeTickFuture::TICK_SIZE, 50, 3);
+}
+
+TEST(AuctionTest, PrefixSumMatchesScalar) {
+    std::mt19937_64 rng(5);
+    for (size_t count = 0; count < 70; ++count) {
+        std::vector<uint64_t> values(count);
+        for (uint64_t& value : values) {
+            value = rng() % 1'000'000'000;
+        }
+        std::vector<uint64_t> expected = values;
+        for (size_t i = 1; i < count; ++i) {
+            expected[i] += expected[i - 1];
+        }
+        inclusivePrefixSum(values.data(), count);
+        ASSERT_EQ(values, expected) << count;
+    }
+}
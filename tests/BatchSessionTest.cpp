@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "src/bindings/BatchSession.h"
+
+TEST(BatchSessionTest, RecordsTradesAndEventsPerCommand) {
+    BatchSession session(2, 100, 1000);
+    std::vector<Command> commands = {
+        Command::submit(0, Order(1, 10, 100, Side::Sell)), Command::submit(0, Order(2, 5, 101, Side::Sell)),
+        Command::submit(1, Order(3, 7, 100, Side::Sell)),  Command::submit(0, Order(4, 12, 101, Side::Buy)),
+        Command::modify(0, 2, 101, 2),                     Command::cancel(1, 3),
+    };
+    session.process(commands);
+
+    std::vector<TradeRecord> trades = session.takeTrades();
+    ASSERT_EQ(trades.size(), 2);
+    EXPECT_EQ(trades[0].incoming_id, 4);
+    EXPECT_EQ(trades[0].resting_id, 1);
+    EXPECT_EQ(trades[0].price, 100);
+    EXPECT_EQ(trades[0].quantity, 10);
+    EXPECT_EQ(trades[1].resting_id, 2);
+    EXPECT_EQ(trades[1].quantity, 2);
+    EXPECT_EQ(trades[1].command_index, 3);
+
+    std::vector<BookEventRecord> events = session.takeEvents();
+    ASSERT_EQ(events.size(), 5);
+    EXPECT_EQ(events[2].symbol, 1);
+    EXPECT_EQ(events[2].type, BookEventType::Added);
+    EXPECT_EQ(events[3].command_index, 4);
+    EXPECT_EQ(events[3].type, BookEventType::Modified);
+    EXPECT_EQ(events[3].quantity, 2);
+    EXPECT_EQ(events[4].type, BookEventType::Canceled);
+    EXPECT_EQ(events[4].id, 3);
+
+    EXPECT_EQ(session.bookFor(0).bestAsk(), 101);
+    EXPECT_FALSE(session.bookFor(1).hasAsks());
+
+    // buffers are handed over: the next batch starts empty
+    session.process(std::vector<Command>{Command::submit(0, Order(5, 1, 99, Side::Buy))});
+    EXPECT_TRUE(session.takeTrades().empty());
+    ASSERT_EQ(session.takeEvents().size(), 1);
+}
+
+TEST(BatchSessionTest, UnknownIdsNeverReachTheEngine) {
+    BatchSession session(1, 10, 1000);
+    std::vector<Command> commands = {Command::cancel(0, 42), Command::modify(0, 43, 100, 1),
+                                     Command::submit(0, Order(1, 10, 100, Side::Buy)), Command::cancel(0, 1),
+                                     Command::cancel(0, 1)};
+    session.process(commands);
+
+    std::vector<BookEventRecord> events = session.takeEvents();
+    ASSERT_EQ(events.size(), 5);
+    EXPECT_EQ(events[0].type, BookEventType::UnknownOrder);
+    EXPECT_EQ(events[1].type, BookEventType::UnknownOrder);
+    EXPECT_EQ(events[1].id, 43);
+    EXPECT_EQ(events[3].type, BookEventType::Canceled);
+    EXPECT_EQ(events[4].type, BookEventType::UnknownOrder);
+}
+
+TEST(BatchSessionTest, InvalidBatchIsRejectedWhole) {
+    BatchSession session(1, 10, 1000);
+    std::vector<Command> bad_symbol = {Command::submit(0, Order(1, 10, 100, Side::Buy)),
+                                       Command::submit(1, Order(2, 10, 100, Side::Buy))};
+    EXPECT_THROW(session.process(bad_symbol), std::invalid_argument);
+    std::vector<Command> bad_price = {Command::submit(0, Order(1, 10, 100, Side::Buy)),
+                                      Command::modify(0, 1, 1001, 10)};
+    EXPECT_THROW(session.process(bad_price), std::invalid_argument);
+
+    EXPECT_FALSE(session.bookFor(0).hasBids());
+    EXPECT_TRUE(session.takeEvents().empty());
+}
+
+TEST(BatchSessionTest, DuplicateIdsAreRejectedByTheEngine) {
+    BatchSession session(1, 10, 1000);
+    std::vector<Command> commands = {Command::submit(0, Order(7, 7, 100, Side::Buy)),
+                                     Command::submit(0, Order(7, 7, 101, Side::Buy)),
+                                     Command::submit(0, Order(8, 10, 100, Side::Sell)),
+                                     Command::submit(0, Order(11, 3, 99, Side::Buy)), Command::cancel(0, 7)};
+    session.process(commands);
+
+    std::vector<TradeRecord> trades = session.takeTrades();
+    ASSERT_EQ(trades.size(), 1);
+    EXPECT_EQ(trades[0].resting_id, 7);
+    EXPECT_EQ(trades[0].price, 100);
+    std::vector<BookEventRecord> events = session.takeEvents();
+    ASSERT_EQ(events.size(), 5);
+    EXPECT_EQ(events[1].type, BookEventType::Rejected);
+    EXPECT_EQ(events[1].reason, RejectReason::DuplicateOrder);
+    EXPECT_EQ(events[1].id, 7);
+    EXPECT_EQ(events[1].price, 101);
+    EXPECT_EQ(events[4].type, BookEventType::UnknownOrder);
+
+    // order 11 took the slot order 7 left: the cancel of 7 must not reach it
+    OrderBook& book = session.bookFor(0);
+    EXPECT_EQ(book.find(7), nullptr);
+    ASSERT_NE(book.find(11), nullptr);
+    EXPECT_EQ(book.find(11)->order.quantity, 3);
+    EXPECT_EQ(book.bestBid(), 99);
+
+    // a filled id can be used again
+    session.process(std::vector<Command>{Command::submit(0, Order(7, 1, 98, Side::Buy))});
+    ASSERT_EQ(session.takeEvents()[0].type, BookEventType::Added);
+}
+
+TEST(BatchSessionTest, ModifyToZeroReportsTheOrderItRemoves) {
+    BatchSession session(1, 10, 1000);
+    std::vector<Command> commands = {Command::submit(0, Order(42, 10, 100, Side::Buy)),
+                                     Command::submit(0, Order(43, 10, 100, Side::Buy)), Command::modify(0, 42, 100, 0),
+                                     Command::submit(0, Order(44, 4, 100, Side::Buy)), Command::cancel(0, 42)};
+    session.process(commands);
+
+    std::vector<BookEventRecord> events = session.takeEvents();
+    ASSERT_EQ(events.size(), 5);
+    EXPECT_EQ(events[2].type, BookEventType::Modified);
+    EXPECT_EQ(events[2].id, 42);
+    EXPECT_EQ(events[2].quantity, 0);
+    EXPECT_EQ(events[4].type, BookEventType::UnknownOrder);
+    EXPECT_EQ(session.bookFor(0).bidLevel(100).getTotalQuantity(), 14);
+}
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "src/domain/Instruments.h"
+#include "src/engines/MatchingEngine.h"
+#include "src/engines/ShardedEngine.h"
+#include "src/infrastructure/Seqlock.h"
+#include "src/marketdata/BookView.h"
+#include "tests/TestListeners.h"
+
+namespace {
+
+// every word derived from the first: a torn read mixes two stores and breaks the relation
+struct Pattern {
+    std::array<uint64_t, 24> words;
+};
+
+} // namespace
+
+TEST(BookViewTest, SeqlockReadersNeverSeeATornValue) {
+    Seqlock<Pattern> seqlock;
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> torn{0};
+    std::atomic<uint64_t> reads{0};
+    std::atomic<int> started{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            uint64_t last = 0;
+            ++started;
+            while (!done.load(std::memory_order_acquire)) {
+                Pattern value = seqlock.load();
+                for (size_t i = 0; i < value.words.size(); ++i) {
+                    torn += value.words[i] != value.words[0] * (i + 1);
+                }
+                torn += value.words[0] < last; // versions only move forward
+                last = value.words[0];
+                ++reads;
+                std::this_thread::yield();
+            }
+        });
+    }
+    while (started.load() < 3) {
+        std::this_thread::yield();
+    }
+    for (uint64_t k = 1; k <= 200'000; ++k) {
+        if (k % 1'000 == 0) {
+            std::this_thread::yield(); // lets the readers in between stores even on a single core
+        }
+        Pattern value;
+        for (size_t i = 0; i < value.words.size(); ++i) {
+            value.words[i] = k * (i + 1);
+        }
+        seqlock.store(value);
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_GT(reads.load(), 0);
+    EXPECT_EQ(seqlock.version(), 200'000);
+    EXPECT_EQ(seqlock.load().words[23], 200'000 * 24);
+}
+
+TEST(BookViewTest, PublishesTopAndDepth) {
+    OrderBook book(100, 1'000);
+    auto listener = makeNoopListener();
+    BookView<3> view;
+    view.publish(book);
+    EXPECT_EQ(view.top(), TopOfBook{});
+    EXPECT_EQ(view.depth().bid_count, 0);
+    EXPECT_EQ(view.topVersion(), 0); // nothing changed: nothing stored
+
+    MatchingEngine::submitOrder(Order(1, 10, 100, Side::Buy), book, listener);
+    MatchingEngine::submitOrder(Order(2, 5, 100, Side::Buy), book, listener);
+    MatchingEngine::submitOrder(Order(3, 7, 98, Side::Buy), book, listener);
+    MatchingEngine::submitOrder(Order(4, 1, 97, Side::Buy), book, listener);
+    MatchingEngine::submitOrder(Order(5, 2, 90, Side::Buy), book, listener);
+    MatchingEngine::submitOrder(Order(6, 4, 105, Side::Sell), book, listener);
+    // not visible until published
+    EXPECT_EQ(view.top(), TopOfBook{});
+    view.publish(book);
+
+    EXPECT_EQ(view.top(), (TopOfBook{100, 15, 105, 4}));
+    BookDepth<3> depth = view.depth();
+    ASSERT_EQ(depth.bid_count, 3);
+    EXPECT_EQ(depth.bids[0], (DepthLevel{100, 15}));
+    EXPECT_EQ(depth.bids[1], (DepthLevel{98, 7}));
+    EXPECT_EQ(depth.bids[2], (DepthLevel{97, 1}));
+    ASSERT_EQ(depth.ask_count, 1);
+    EXPECT_EQ(depth.asks[0], (DepthLevel{105, 4}));
+
+    // a change below the top moves the depth version only
+    uint64_t top_version = view.topVersion();
+    uint64_t depth_version = view.depthVersion();
+    MatchingEngine::cancelOrder(OrderId{3}, book, listener);
+    view.publish(book);
+    EXPECT_EQ(view.topVersion(), top_version);
+    EXPECT_EQ(view.depthVersion(), depth_version + 1);
+    EXPECT_EQ(view.depth().bids[2], (DepthLevel{90, 2}));
+
+    // sweeps the 18 bid, the rest becomes the best ask
+    MatchingEngine::submitOrder(Order(7, 20, 90, Side::Sell), book, listener);
+    view.publish(book);
+    EXPECT_EQ(view.top(), (TopOfBook{0, 0, 90, 2}));
+    EXPECT_EQ(view.depth().bid_count, 0);
+    EXPECT_EQ(view.depth().ask_count, 2);
+    EXPECT_EQ(view.depth().asks[1], (DepthLevel{105, 4}));
+}
+
+TEST(BookViewTest, DepthMatchesTheBookOnWindowedAndLargeTickBooks) {
+    std::mt19937_64 rng(8);
+    auto check = [&](auto& book, Price low, Price tick) {
+        auto listener = makeNoopListener();
+        BookView<5> view;
+        for (OrderId id = 1; id <= 2'000; ++id) {
+            Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            MatchingEngine::submitOrder(Order(id, 1 + rng() % 20, low + (rng() % 300) * tick, side), book, listener);
+            view.publish(book);
+            BookDepth<5> depth = view.depth();
+
+            BookDepth<5> expected;
+            book.forEachRestingOrder([&](const Order& order) {
+                bool bid = order.side == Side::Buy;
+                auto& levels = bid ? expected.bids : expected.asks;
+                uint32_t& count = bid ? expected.bid_count : expected.ask_count;
+                if (count > 0 && levels[count - 1].price == order.price) {
+                    levels[count - 1].quantity += order.quantity;
+                } else if (count < 5) {
+                    levels[count++] = {order.price, order.quantity};
+                }
+            });
+            ASSERT_EQ(depth, expected) << id;
+            ASSERT_EQ(view.top().bid_price, book.hasBids() ? book.bestBid() : 0);
+        }
+    };
+    OrderBook windowed(10'000, 100'000, 64, 1'000);
+    check(windowed, 900, 1);
+    BasicOrderBook<LargeTickFuture> future(10'000, LargeTickFuture::MAX_PRICE);
+    check(future, LargeTickFuture::MIN_PRICE + 100 * LargeTickFuture::TICK_SIZE, LargeTickFuture::TICK_SIZE);
+}
+
+TEST(BookViewTest, ShardedEngineViewsFollowTheBooks) {
+    ShardedEngine<decltype(makeNoopListener())> engine(
+        2, 4, [](SymbolId) { return std::make_unique<OrderBook>(1024, 1000); },
+        [](size_t) { return makeNoopListener(); }, {}, 1 << 10, true);
+    engine.start();
+
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> crossed{0};
+    std::thread reader([&] {
+        // a view is always one consistent publication: never crossed, since the books never are between batches
+        while (!done.load(std::memory_order_acquire)) {
+            for (SymbolId symbol = 0; symbol < 4; ++symbol) {
+                TopOfBook top = engine.view(symbol).top();
+                crossed += top.bid_price != 0 && top.ask_price != 0 && top.bid_price >= top.ask_price;
+            }
+            std::this_thread::yield();
+        }
+    });
+    OrderId id = 1;
+    for (int round = 0; round < 2'000; ++round) {
+        for (SymbolId symbol = 0; symbol < 4; ++symbol) {
+            engine.submit(Command::submit(symbol, Order{id++, 10, 500 + static_cast<Price>(round % 50), Side::Sell}));
+            engine.submit(Command::submit(symbol, Order{id++, 5, 520, Side::Buy}));
+        }
+    }
+    engine.waitUntilDrained();
+    done = true;
+    reader.join();
+    EXPECT_EQ(crossed.load(), 0);
+
+    for (SymbolId symbol = 0; symbol < 4; ++symbol) {
+        OrderBook& book = engine.book(symbol);
+        EXPECT_EQ(engine.view(symbol).top(),
+                  (TopOfBook{book.hasBids() ? book.bestBid() : 0,
+                             book.hasBids() ? book.bestBidLevel().getTotalQuantity() : 0,
+                             book.hasAsks() ? book.bestAsk() : 0,
+                             book.hasAsks() ? book.bestAskLevel().getTotalQuantity() : 0}));
+    }
+    engine.stop();
+}
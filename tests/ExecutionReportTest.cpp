@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "src/engines/MatchingEngine.h"
+#include "src/reporting/ExecutionReports.h"
+
+namespace {
+
+struct Collect {
+    std::vector<ExecutionReport>* reports;
+    void operator()(const ExecutionReport& report) const { reports->push_back(report); }
+};
+
+} // namespace
+
+TEST(ExecutionReportTest, ConsumerSeesEveryEventInSequence) {
+    std::vector<ExecutionReport> reports;
+    ExecutionReportPipeline pipeline(16, Collect{&reports});
+    pipeline.start();
+
+    OrderBook book(1'000, 1'000);
+    auto& listener = pipeline.listener();
+    for (OrderId id = 1; id <= 200; ++id) {
+        MatchingEngine::submitOrder(Order(id, 10, 100 + id % 5, Side::Sell, 1), book, listener);
+        pipeline.flush();
+    }
+    MatchingEngine::submitOrder(Order(1'000, 25, 100, Side::Buy), book, listener); // fills 5, 10 and half of 15
+    MatchingEngine::modifyOrder(15, 100, 4, book, listener);
+    MatchingEngine::cancelOrder(16, book, listener);
+    MatchingEngine::massCancel(1, book, listener);
+    pipeline.waitUntilDrained();
+    pipeline.stop();
+
+    const uint64_t expected = 200 + 3 + 1 + 1 + 197;
+    ASSERT_EQ(reports.size(), expected);
+    EXPECT_EQ(pipeline.listener().droppedCount(), 0);
+    for (size_t i = 0; i < reports.size(); ++i) {
+        ASSERT_EQ(reports[i].sequence, i + 1);
+    }
+    EXPECT_EQ(reports[0].type, ReportType::Added);
+    EXPECT_EQ(reports[200].type, ReportType::Trade);
+    EXPECT_EQ(reports[200].id, 1'000);
+    EXPECT_EQ(reports[200].resting_id, 5);
+    EXPECT_EQ(reports[200].price, 100);
+    EXPECT_EQ(reports[202].resting_id, 15);
+    EXPECT_EQ(reports[202].quantity, 5);
+    EXPECT_EQ(reports[203].type, ReportType::Modified);
+    EXPECT_EQ(reports[203].quantity, 4);
+    EXPECT_EQ(reports[204].type, ReportType::Canceled);
+    EXPECT_EQ(reports[204].id, 16);
+    EXPECT_EQ(reports.back().type, ReportType::Canceled);
+    EXPECT_EQ(reports.back().side, Side::Sell);
+}
+
+TEST(ExecutionReportTest, DropPolicyNeverWaitsAndLeavesSequenceGaps) {
+    std::vector<ExecutionReport> reports;
+    // consumer not started: the ring fills up and stays full
+    ExecutionReportPipeline pipeline(8, Collect{&reports}, BackPressure::Drop);
+    OrderBook book(100, 1'000);
+    auto& listener = pipeline.listener();
+    for (OrderId id = 1; id <= 20; ++id) {
+        MatchingEngine::submitOrder(Order(id, 10, 100, Side::Sell), book, listener);
+    }
+    pipeline.flush();
+    EXPECT_EQ(listener.publishedCount(), 8);
+    EXPECT_EQ(listener.droppedCount(), 12);
+    EXPECT_EQ(listener.lastSequence(), 20);
+
+    pipeline.start();
+    pipeline.waitUntilDrained();
+    MatchingEngine::cancelOrder(20, book, listener);
+    pipeline.stop();
+    ASSERT_EQ(reports.size(), 9);
+    EXPECT_EQ(reports[7].sequence, 8);
+    EXPECT_EQ(reports[8].sequence, 21); // 9..20 were dropped
+    EXPECT_EQ(reports[8].type, ReportType::Canceled);
+}
+
+TEST(ExecutionReportTest, BlockPolicyWaitsForTheConsumer) {
+    std::vector<ExecutionReport> reports;
+    ExecutionReportPipeline pipeline(4, Collect{&reports}, BackPressure::Block);
+    pipeline.start();
+    OrderBook book(10'000, 1'000);
+    auto& listener = pipeline.listener();
+    for (OrderId id = 1; id <= 5'000; ++id) {
+        MatchingEngine::submitOrder(Order(id, 10, 100 + id % 2, id % 2 ? Side::Sell : Side::Buy), book, listener);
+    }
+    pipeline.stop();
+    EXPECT_EQ(listener.droppedCount(), 0);
+    ASSERT_EQ(reports.size(), listener.lastSequence());
+    EXPECT_EQ(reports.back().sequence, listener.lastSequence());
+}
@@ -0,0 +1,293 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "src/gateway/FixClient.h"
+#include "src/gateway/FixGateway.h"
+#include "src/workload/WorkloadGenerator.h"
+
+namespace {
+
+struct Trader {
+    FixClient client;
+    std::vector<FixExecution> received;
+
+    Trader(const std::string& comp_id, uint16_t port) : client(comp_id) {
+        client.connect("127.0.0.1", port);
+        client.logon();
+        client.flush();
+    }
+
+    void drain() {
+        client.poll([&](const FixExecution& execution) { received.push_back(execution); });
+    }
+
+    size_t count(char msg_type) const {
+        return std::count_if(received.begin(), received.end(),
+                             [&](const FixExecution& execution) { return execution.msg_type == msg_type; });
+    }
+};
+
+// polls the gateway and the traders (all on this thread) until `done` holds
+template <typename Done> bool pumpUntil(FixGateway<>& gateway, std::vector<Trader*> traders, Done&& done) {
+    for (int i = 0; i < 1'000'000; ++i) {
+        gateway.poll();
+        for (Trader* trader : traders) {
+            trader->drain();
+        }
+        if (done()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+using RestingKey = std::tuple<OrderId, Price, Quantity, Side>;
+
+std::vector<RestingKey> resting(OrderBook& book) {
+    std::vector<RestingKey> orders;
+    book.forEachRestingOrder([&](const Order& order) {
+        orders.emplace_back(order.id & FIX_MAX_CL_ORD_ID, order.price, order.quantity, order.side);
+    });
+    std::sort(orders.begin(), orders.end());
+    return orders;
+}
+
+} // namespace
+
+TEST(FixGatewayTest, CrossingOrderReportsToBothSessions) {
+    OrderBook book(1'000, 10'000);
+    FixGateway gateway(book);
+    Trader buyer("BUYER", gateway.port());
+    Trader seller("SELLER", gateway.port());
+    ASSERT_TRUE(pumpUntil(gateway, {&buyer, &seller}, [&] { return buyer.count('A') + seller.count('A') == 2; }));
+    EXPECT_EQ(gateway.connectedSessions(), 2);
+
+    buyer.client.newOrder(1, Side::Buy, 10, 100);
+    buyer.client.flush();
+    ASSERT_TRUE(pumpUntil(gateway, {&buyer, &seller}, [&] { return buyer.count('8') == 1; }));
+    const FixExecution& added = buyer.received.back();
+    EXPECT_EQ(added.exec_type, '0');
+    EXPECT_EQ(added.ord_status, '0');
+    EXPECT_EQ(added.cl_ord_id, 1);
+    EXPECT_EQ(added.leaves, 10);
+    EXPECT_EQ(added.seq_num, 2); // after the Logon reply
+    EXPECT_EQ(book.bestBid(), 100);
+
+    // same ClOrdID from another session is a different order
+    seller.client.newOrder(1, Side::Sell, 15, 100);
+    seller.client.flush();
+    ASSERT_TRUE(pumpUntil(gateway, {&buyer, &seller}, [&] { return seller.count('8') == 2 && buyer.count('8') == 2; }));
+    const FixExecution& aggressor_fill = seller.received[1];
+    EXPECT_EQ(aggressor_fill.exec_type, 'F');
+    EXPECT_EQ(aggressor_fill.ord_status, '1');
+    EXPECT_EQ(aggressor_fill.last_quantity, 10);
+    EXPECT_EQ(aggressor_fill.last_price, 100);
+    EXPECT_EQ(aggressor_fill.leaves, 5);
+    const FixExecution& remainder = seller.received[2];
+    EXPECT_EQ(remainder.exec_type, '0');
+    EXPECT_EQ(remainder.ord_status, '1');
+    EXPECT_EQ(remainder.leaves, 5);
+    const FixExecution& resting_fill = buyer.received.back();
+    EXPECT_EQ(resting_fill.exec_type, 'F');
+    EXPECT_EQ(resting_fill.ord_status, '2');
+    EXPECT_EQ(resting_fill.cl_ord_id, 1);
+    EXPECT_EQ(resting_fill.side, Side::Buy);
+    EXPECT_EQ(resting_fill.leaves, 0);
+
+    EXPECT_FALSE(book.hasBids());
+    EXPECT_EQ(book.bestAsk(), 100);
+}
+
+TEST(FixGatewayTest, CancelReplaceAndRejects) {
+    OrderBook book(1'000, 10'000);
+    FixGateway gateway(book);
+    Trader trader("TRADER", gateway.port());
+    Trader other("OTHER", gateway.port());
+    auto reports = [&](size_t count) {
+        return pumpUntil(gateway, {&trader, &other}, [&] { return trader.received.size() == count; });
+    };
+    ASSERT_TRUE(reports(1));
+
+    trader.client.newOrder(1, Side::Buy, 10, 100);
+    trader.client.replace(1, 101, 12);                // re-queue at a better price, no cross
+    trader.client.cancel(99);                         // unknown
+    trader.client.newOrder(1, Side::Sell, 5, 200);    // duplicate ClOrdID
+    trader.client.newOrder(2, Side::Sell, 5, 20'000); // beyond the book
+    trader.client.flush();
+    ASSERT_TRUE(reports(6));
+    EXPECT_EQ(trader.received[2].exec_type, '5');
+    EXPECT_EQ(trader.received[2].leaves, 12);
+    EXPECT_EQ(trader.received[2].price, 101);
+    EXPECT_EQ(trader.received[3].msg_type, '9');
+    EXPECT_EQ(trader.received[3].orig_cl_ord_id, 99);
+    EXPECT_EQ(trader.received[3].reject_reason, 1);
+    EXPECT_EQ(trader.received[4].exec_type, '8');
+    EXPECT_EQ(trader.received[4].reject_reason, 6);
+    EXPECT_EQ(trader.received[5].exec_type, '8');
+    EXPECT_EQ(book.bestBid(), 101);
+    EXPECT_FALSE(book.hasAsks());
+
+    // a replace that crosses: reported as replaced, then filled against the other session
+    other.client.newOrder(7, Side::Sell, 5, 105);
+    other.client.flush();
+    ASSERT_TRUE(pumpUntil(gateway, {&trader, &other}, [&] { return other.count('8') == 1; }));
+    trader.client.replace(1, 105, 12);
+    trader.client.flush();
+    ASSERT_TRUE(reports(8));
+    EXPECT_EQ(trader.received[6].exec_type, '5');
+    EXPECT_EQ(trader.received[7].exec_type, 'F');
+    EXPECT_EQ(trader.received[7].leaves, 7);
+    EXPECT_EQ(book.bestBid(), 105);
+    EXPECT_FALSE(book.hasAsks());
+
+    trader.client.cancel(1);
+    trader.client.flush();
+    ASSERT_TRUE(reports(9));
+    EXPECT_EQ(trader.received[8].exec_type, '4');
+    EXPECT_EQ(trader.received[8].cl_ord_id, 1);
+    EXPECT_FALSE(book.hasBids());
+}
+
+TEST(FixGatewayTest, TimeInForceAndOrderTypes) {
+    OrderBook book(1'000, 10'000);
+    FixGateway gateway(book);
+    Trader maker("MAKER", gateway.port());
+    Trader taker("TAKER", gateway.port());
+    maker.client.newOrder(1, Side::Sell, 10, 100);
+    maker.client.newOrder(2, Side::Sell, 10, 102);
+    maker.client.flush();
+    ASSERT_TRUE(pumpUntil(gateway, {&maker, &taker}, [&] { return maker.count('8') == 2; }));
+
+    taker.client.newOrder(1, Side::Buy, 25, 102, OrderType::FillOrKill);        // 20 available: killed
+    taker.client.newOrder(2, Side::Buy, 15, 101, OrderType::ImmediateOrCancel); // 10 fill, 5 canceled
+    taker.client.newOrder(3, Side::Buy, 5, 102, OrderType::PostOnly);           // would trade: rejected
+    taker.client.newOrder(4, Side::Buy, 20, 0, OrderType::Market);              // 10 fill, 10 canceled
+    taker.client.flush();
+    ASSERT_TRUE(pumpUntil(gateway, {&maker, &taker}, [&] { return taker.count('8') == 6; }));
+    std::vector<std::pair<uint64_t, char>> reports;
+    for (const FixExecution& execution : taker.received) {
+        if (execution.msg_type == '8') {
+            reports.emplace_back(execution.cl_ord_id, execution.exec_type);
+        }
+    }
+    EXPECT_EQ(reports, (std::vector<std::pair<uint64_t, char>>{
+                           {1, '4'}, {2, 'F'}, {2, '4'}, {3, '8'}, {4, 'F'}, {4, '4'}}));
+    EXPECT_EQ(taker.received.back().leaves, 0);
+    EXPECT_FALSE(book.hasAsks());
+    EXPECT_FALSE(book.hasBids());
+}
+
+TEST(FixGatewayTest, LogoutCancelsTheSessionsOrders) {
+    OrderBook book(1'000, 10'000);
+    FixGateway gateway(book);
+    Trader leaving("LEAVING", gateway.port());
+    Trader staying("STAYING", gateway.port());
+    for (uint64_t id = 1; id <= 3; ++id) {
+        leaving.client.newOrder(id, Side::Buy, 10, 100 + id);
+    }
+    leaving.client.flush();
+    staying.client.newOrder(1, Side::Buy, 10, 90);
+    staying.client.flush();
+    ASSERT_TRUE(pumpUntil(gateway, {&leaving, &staying},
+                          [&] { return leaving.count('8') == 3 && staying.count('8') == 1; }));
+
+    leaving.client.logout();
+    leaving.client.flush();
+    ASSERT_TRUE(pumpUntil(gateway, {&leaving, &staying}, [&] { return !leaving.client.connected(); }));
+    EXPECT_EQ(leaving.count('5'), 1);
+    EXPECT_EQ(gateway.connectedSessions(), 1);
+    EXPECT_EQ(book.bestBid(), 90);
+    EXPECT_EQ(resting(book), (std::vector<RestingKey>{{1, 90, 10, Side::Buy}}));
+    EXPECT_EQ(staying.count('8'), 1);
+}
+
+TEST(FixGatewayTest, OrdersLeftRestingStayWithTheirCompId) {
+    OrderBook book(1'000, 10'000);
+    FixGatewayConfig config;
+    config.cancel_on_disconnect = false;
+    FixGateway gateway(book, config);
+    auto first = std::make_unique<Trader>("FIRST", gateway.port());
+    Trader seller("SELLER", gateway.port());
+    first->client.newOrder(1, Side::Buy, 10, 100);
+    first->client.flush();
+    ASSERT_TRUE(pumpUntil(gateway, {first.get(), &seller}, [&] { return first->count('8') == 1; }));
+    first->client.logout();
+    first->client.flush();
+    ASSERT_TRUE(pumpUntil(gateway, {first.get(), &seller}, [&] { return !first->client.connected(); }));
+    EXPECT_EQ(book.bestBid(), 100);
+
+    // takes the slot FIRST left: the order is not its own to cancel or replace, and ClOrdID 1 is free to use
+    Trader second("SECOND", gateway.port());
+    second.client.cancel(1);
+    second.client.replace(1, 101, 20);
+    second.client.newOrder(1, Side::Buy, 5, 90);
+    second.client.flush();
+    ASSERT_TRUE(pumpUntil(gateway, {&second, &seller}, [&] { return second.received.size() == 4; }));
+    EXPECT_EQ(second.received[1].msg_type, '9');
+    EXPECT_EQ(second.received[1].reject_reason, 1);
+    EXPECT_EQ(second.received[2].msg_type, '9');
+    EXPECT_EQ(second.received[3].exec_type, '0');
+    EXPECT_EQ(book.bidLevel(100).getTotalQuantity(), 10);
+    EXPECT_EQ(book.bidLevel(90).getTotalQuantity(), 5);
+
+    // nor does it hear about the order's fills
+    seller.client.newOrder(1, Side::Sell, 4, 100);
+    seller.client.flush();
+    ASSERT_TRUE(pumpUntil(gateway, {&second, &seller}, [&] { return seller.count('8') == 1; }));
+    for (int i = 0; i < 1'000; ++i) {
+        gateway.poll();
+        second.drain();
+    }
+    EXPECT_EQ(second.received.size(), 4);
+
+    // FIRST, back on another slot, still owns it
+    Trader again("FIRST", gateway.port());
+    again.client.cancel(1);
+    again.client.flush();
+    ASSERT_TRUE(pumpUntil(gateway, {&again, &second, &seller}, [&] { return again.count('8') == 1; }));
+    EXPECT_EQ(again.received.back().exec_type, '4');
+    EXPECT_EQ(again.received.back().cl_ord_id, 1);
+    EXPECT_EQ(resting(book), (std::vector<RestingKey>{{1, 90, 5, Side::Buy}}));
+}
+
+TEST(FixGatewayTest, ReplayedWorkloadMatchesTheEngine) {
+    WorkloadStream stream = WorkloadGenerator(profiles::quoteChurn()).generate(5'000);
+    OrderBook direct(stream.peak_resting_orders + 1, stream.max_price);
+    size_t trades = 0;
+    auto listener = MatchingEngineListener{[&](OrderId, OrderId, Price, Quantity) { ++trades; }, [](const Order&) {},
+                                           [](OrderId) {}, [](const Order&) {}};
+    std::vector<Command> commands = stream.setup;
+    commands.insert(commands.end(), stream.flow.begin(), stream.flow.end());
+    for (const Command& command : commands) {
+        MatchingEngine::process(command, direct, listener);
+    }
+
+    OrderBook book(stream.peak_resting_orders + 1, stream.max_price);
+    FixGateway gateway(book);
+    Trader trader("LOAD", gateway.port());
+    for (size_t sent = 0; sent < commands.size();) {
+        size_t window = std::min<size_t>(64, commands.size() - sent);
+        for (size_t i = 0; i < window; ++i) {
+            trader.client.send(commands[sent + i]);
+        }
+        trader.client.flush();
+        sent += window;
+        ASSERT_TRUE(pumpUntil(gateway, {&trader}, [&] { return gateway.messagesReceived() == 1 + sent; }));
+    }
+    // reports go out in order: once the reject of this unknown cancel is in, every earlier report is
+    trader.client.cancel(FIX_MAX_CL_ORD_ID);
+    trader.client.flush();
+    ASSERT_TRUE(pumpUntil(gateway, {&trader}, [&] { return trader.count('9') == 1; }));
+
+    EXPECT_EQ(trader.received.back().seq_num, trader.received.size());
+    size_t fills = std::count_if(trader.received.begin(), trader.received.end(),
+                                 [](const FixExecution& execution) { return execution.exec_type == 'F'; });
+    EXPECT_EQ(fills, 2 * trades); // aggressor and resting side, both this session
+    EXPECT_EQ(resting(book), resting(direct));
+}
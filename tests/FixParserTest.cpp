@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/gateway/FixEncoder.h"
+#include "src/gateway/FixParser.h"
+
+namespace {
+
+std::string frame(const FixEncoder& encoder) {
+    std::string out(FixEncoder::MAX_MESSAGE, '\0');
+    out.resize(encoder.finish(out.data(), out.size()));
+    return out;
+}
+
+template <FixScan Scan> std::vector<std::pair<uint32_t, std::string>> fields(std::string_view message, bool& ok) {
+    std::vector<std::pair<uint32_t, std::string>> result;
+    ok = forEachFixField<Scan>(message, [&](uint32_t tag, std::string_view value) {
+        result.emplace_back(tag, std::string(value));
+    });
+    return result;
+}
+
+} // namespace
+
+TEST(FixParserTest, EncodedMessageFramesAndParses) {
+    FixEncoder encoder;
+    encoder.begin("D", "CLIENT", "ENGINE", 7)
+        .uintField(FixTag::CL_ORD_ID, 42)
+        .textField(FixTag::SYMBOL, "ABC")
+        .charField(FixTag::SIDE, '2')
+        .uintField(FixTag::ORDER_QTY, 300)
+        .charField(FixTag::ORD_TYPE, '2')
+        .uintField(FixTag::PRICE, 10'125);
+    std::string message = frame(encoder);
+    ASSERT_EQ(message.rfind("8=FIX.4.4\x01" "9=", 0), 0);
+
+    // split across reads: incomplete until the last byte is there
+    for (size_t size = 0; size < message.size(); ++size) {
+        ASSERT_EQ(fixFrameLength(std::string_view(message).substr(0, size)), 0) << size;
+    }
+    ASSERT_EQ(fixFrameLength(message + "8=FIX"), message.size());
+
+    FixMessage parsed;
+    ASSERT_EQ(parseFixMessage(message, parsed), FixParseError::None);
+    EXPECT_TRUE(parsed.is("D"));
+    EXPECT_EQ(parsed.sender_comp_id, "CLIENT");
+    EXPECT_EQ(parsed.seq_num, 7);
+    EXPECT_EQ(parsed.cl_ord_id, 42);
+    EXPECT_EQ(parsed.symbol, "ABC");
+    EXPECT_EQ(parsed.side, '2');
+    EXPECT_EQ(parsed.quantity, 300);
+    EXPECT_EQ(parsed.ord_type, '2');
+    EXPECT_EQ(parsed.price, 10'125);
+    EXPECT_FALSE(parsed.has_orig_cl_ord_id);
+
+    std::string corrupted = message;
+    corrupted[20] ^= 0x20;
+    EXPECT_EQ(parseFixMessage(corrupted, parsed), FixParseError::BadChecksum);
+    EXPECT_EQ(fixFrameLength("8=FIX.4.2\x01"), FIX_MALFORMED);
+    EXPECT_EQ(fixFrameLength("8=FIX.4.4\x01" "9=x\x01"), FIX_MALFORMED);
+}
+
+TEST(FixParserTest, BadValuesAndMalformedFields) {
+    FixEncoder encoder;
+    encoder.begin("D", "CLIENT", "ENGINE", 1).textField(FixTag::PRICE, "10.5").uintField(FixTag::ORDER_QTY, 1);
+    FixMessage parsed;
+    EXPECT_EQ(parseFixMessage(frame(encoder), parsed), FixParseError::BadValue);
+    EXPECT_EQ(parsed.bad_tag, FixTag::PRICE);
+
+    bool ok = true;
+    fields<FixScan::Vector>("35=D\x01" "=5\x01", ok);
+    EXPECT_FALSE(ok);
+    fields<FixScan::Vector>("35=D\x01" "4x=5\x01", ok);
+    EXPECT_FALSE(ok);
+    fields<FixScan::Vector>("35=D\x01" "44=5", ok);
+    EXPECT_FALSE(ok);
+    auto parsed_fields = fields<FixScan::Vector>("58=a=b\x01", ok);
+    EXPECT_TRUE(ok);
+    ASSERT_EQ(parsed_fields.size(), 1);
+    EXPECT_EQ(parsed_fields[0].second, "a=b");
+}
+
+TEST(FixParserTest, VectorScanMatchesScalarScan) {
+    std::mt19937_64 rng(11);
+    const std::string alphabet = "0123456789=ABC\x01";
+    for (int round = 0; round < 2'000; ++round) {
+        // well-formed runs of fields with random lengths, and now and then random bytes
+        std::string message;
+        size_t count = 1 + rng() % 12;
+        for (size_t i = 0; i < count; ++i) {
+            message += std::to_string(1 + rng() % 999) + "=";
+            size_t length = rng() % 40;
+            for (size_t j = 0; j < length; ++j) {
+                message += static_cast<char>('A' + rng() % 26);
+            }
+            message += '\x01';
+        }
+        if (round % 4 == 0) {
+            message[rng() % message.size()] = alphabet[rng() % alphabet.size()];
+        }
+
+        bool scalar_ok = false;
+        bool vector_ok = false;
+        auto scalar = fields<FixScan::Scalar>(message, scalar_ok);
+        auto vector = fields<FixScan::Vector>(message, vector_ok);
+        ASSERT_EQ(scalar_ok, vector_ok) << round;
+        ASSERT_EQ(scalar, vector) << round;
+        if (round % 4 != 0) {
+            ASSERT_TRUE(vector_ok);
+            ASSERT_EQ(vector.size(), count);
+        }
+
+        uint32_t sum = 0;
+        for (char c : message) {
+            sum += static_cast<unsigned char>(c);
+        }
+        ASSERT_EQ(fixChecksum(message.data(), message.size()), static_cast<uint8_t>(sum));
+    }
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "src/domain/Instruments.h"
+#include "src/engines/MatchingEngine.h"
+
+namespace {
+
+using FutureBook = BasicOrderBook<LargeTickFuture>;
+using EquityBook = BasicOrderBook<CompactEquity>;
+
+static_assert(sizeof(OrderBook::RestingOrder) == 32);
+static_assert(sizeof(FutureBook::RestingOrder) == 16);
+static_assert(sizeof(EquityBook::RestingOrder) == 16);
+static_assert(sizeof(FutureBook::Level) < sizeof(OrderBook::Level));
+
+using Trade = std::tuple<OrderId, OrderId, Price, Quantity>;
+
+struct Recorder {
+    std::vector<Trade> trades;
+    std::vector<Order> added;
+    std::vector<Order> modified;
+    std::vector<std::pair<OrderId, RejectReason>> rejected;
+
+    auto listener() {
+        return MatchingEngineListener{
+            [this](OrderId in, OrderId rest, Price price, Quantity qty) { trades.emplace_back(in, rest, price, qty); },
+            [this](const Order& order) { added.push_back(order); }, [](OrderId) {},
+            [this](const Order& order) { modified.push_back(order); },
+            [this](const Order& order, RejectReason reason) { rejected.emplace_back(order.id, reason); }};
+    }
+};
+
+constexpr Price tick(Price ticks_above_min) {
+    return LargeTickFuture::MIN_PRICE + ticks_above_min * LargeTickFuture::TICK_SIZE;
+}
+
+} // namespace
+
+TEST(InstrumentTest, TickedBookSpeaksPricesOutside) {
+    FutureBook book;
+    Recorder recorder;
+    auto listener = recorder.listener();
+
+    MatchingEngine::submitOrder(Order(1, 10, tick(100), Side::Sell), book, listener);
+    MatchingEngine::submitOrder(Order(2, 10, tick(101), Side::Sell), book, listener);
+    MatchingEngine::submitOrder(Order(3, 5, tick(98), Side::Buy), book, listener);
+    EXPECT_EQ(book.bestAsk(), tick(100));
+    EXPECT_EQ(book.bestBid(), tick(98));
+    ASSERT_EQ(recorder.added.size(), 3);
+    EXPECT_EQ(recorder.added[0].price, tick(100));
+
+    MatchingEngine::submitOrder(Order(4, 15, tick(101), Side::Buy), book, listener);
+    EXPECT_EQ(recorder.trades, (std::vector<Trade>{{4, 1, tick(100), 10}, {4, 2, tick(101), 5}}));
+    EXPECT_EQ(book.bestAsk(), tick(101));
+
+    // same-price size reduction, then a reprice that crosses
+    MatchingEngine::modifyOrder(3, tick(98), 2, book, listener);
+    ASSERT_EQ(recorder.modified.size(), 1);
+    EXPECT_EQ(recorder.modified[0].price, tick(98));
+    EXPECT_EQ(recorder.modified[0].quantity, 2);
+    MatchingEngine::modifyOrder(3, tick(101), 2, book, listener);
+    EXPECT_EQ(recorder.trades.back(), (Trade{3, 2, tick(101), 2}));
+    EXPECT_FALSE(book.hasBids());
+
+    std::vector<Order> resting;
+    book.forEachRestingOrder([&](const Order& order) { resting.push_back(order); });
+    ASSERT_EQ(resting.size(), 1);
+    EXPECT_EQ(resting[0].id, 2);
+    EXPECT_EQ(resting[0].price, tick(101));
+    EXPECT_EQ(resting[0].quantity, 3);
+}
+
+TEST(InstrumentTest, AcceptsOnlyWhatTheInstrumentCanStore) {
+    FutureBook book;
+    EXPECT_TRUE(book.accepts(Order(1, 10, LargeTickFuture::MIN_PRICE, Side::Buy)));
+    EXPECT_TRUE(book.accepts(Order(1, 10, LargeTickFuture::MAX_PRICE, Side::Buy)));
+    EXPECT_FALSE(book.accepts(Order(1, 10, LargeTickFuture::MIN_PRICE - LargeTickFuture::TICK_SIZE, Side::Buy)));
+    EXPECT_FALSE(book.accepts(Order(1, 10, LargeTickFuture::MAX_PRICE + LargeTickFuture::TICK_SIZE, Side::Buy)));
+    EXPECT_FALSE(book.accepts(Order(1, 10, tick(3) + 1, Side::Buy))); // off tick
+    EXPECT_FALSE(book.accepts(Order(1, 70'000, tick(3), Side::Buy))); // quantity beyond 16 bits
+    EXPECT_FALSE(book.accepts(Order(OrderId{1} << 32, 10, tick(3), Side::Buy)));
+
+    OrderBook wide(10, 1000);
+    EXPECT_TRUE(wide.accepts(Order(OrderId{1} << 40, 70'000, 1000, Side::Sell)));
+    EXPECT_FALSE(wide.accepts(Order(1, 10, 1001, Side::Sell)));
+}
+
+// nothing below relies on the asserts in the book: the engine turns these away in Release builds too
+TEST(InstrumentTest, EngineRejectsWhatANarrowBookCannotHold) {
+    EquityBook book(16, 2'000);
+    Recorder recorder;
+    auto listener = recorder.listener();
+
+    MatchingEngine::submitOrder(Order(5, 10, 100, Side::Sell), book, listener);
+    MatchingEngine::submitOrder(Order(6, 70'000, 100, Side::Sell), book, listener);              // 16-bit quantity
+    MatchingEngine::submitOrder(Order((OrderId{1} << 32) + 5, 10, 100, Side::Buy), book, listener); // 32-bit id
+    MatchingEngine::submitOrder(Order(7, 10, 2'001, Side::Sell), book, listener);                // above the band
+    MatchingEngine::submitOrder(Order(8, 10, 99, Side::Buy, 256), book, listener);               // 8-bit owner
+    ASSERT_EQ(recorder.rejected.size(), 4);
+    for (const auto& [id, reason] : recorder.rejected) {
+        EXPECT_EQ(reason, RejectReason::OutsideInstrument) << "order " << id;
+    }
+    EXPECT_EQ(recorder.rejected[1].first, (OrderId{1} << 32) + 5);
+    // only order 5 rests, untouched by the id that would have narrowed onto it
+    ASSERT_EQ(recorder.added.size(), 1);
+    EXPECT_TRUE(recorder.trades.empty());
+    EXPECT_FALSE(book.hasBids());
+    EXPECT_EQ(book.askLevel(100).getTotalQuantity(), 10);
+
+    // a market order's price is not the instrument's concern
+    MatchingEngine::submitOrder<OrderType::Market>(Order(9, 4, 0, Side::Buy), book, listener);
+    EXPECT_EQ(recorder.trades, (std::vector<Trade>{{9, 5, 100, 4}}));
+
+    // nor can a modify take the order outside it: refused, with no event and the order as it was
+    EXPECT_FALSE(MatchingEngine::modifyOrder(5, 100, 70'000, book, listener));
+    EXPECT_FALSE(MatchingEngine::modifyOrder(5, 2'001, 6, book, listener));
+    EXPECT_TRUE(recorder.modified.empty());
+    EXPECT_EQ(recorder.added.size(), 1);
+    ASSERT_NE(book.find(5), nullptr);
+    EXPECT_EQ(book.toOrder(*book.find(5)).quantity, 6);
+    EXPECT_EQ(book.bestAsk(), 100);
+    EXPECT_TRUE(MatchingEngine::modifyOrder(5, 101, 60'000, book, listener));
+    EXPECT_EQ(book.askLevel(101).getTotalQuantity(), 60'000);
+}
+
+TEST(InstrumentTest, EngineRejectsPricesOffTheTick) {
+    FutureBook book;
+    Recorder recorder;
+    auto listener = recorder.listener();
+
+    MatchingEngine::submitOrder(Order(1, 10, tick(3) + 1, Side::Buy), book, listener);
+    MatchingEngine::submitOrder(Order(2, 10, LargeTickFuture::MIN_PRICE - LargeTickFuture::TICK_SIZE, Side::Buy),
+                                book, listener);
+    ASSERT_EQ(recorder.rejected.size(), 2);
+    EXPECT_EQ(recorder.rejected[0].second, RejectReason::OutsideInstrument);
+    EXPECT_FALSE(book.hasBids());
+
+    MatchingEngine::submitOrder(Order(3, 10, tick(3), Side::Buy), book, listener);
+    EXPECT_FALSE(MatchingEngine::modifyOrder(3, tick(4) + 1, 10, book, listener));
+    EXPECT_EQ(book.bestBid(), tick(3));
+}
+
+TEST(InstrumentTest, NarrowBookMatchesTheDefaultBookEventForEvent) {
+    OrderBook wide(5'000, 2'000);
+    EquityBook narrow(5'000, 2'000);
+    Recorder wide_events, narrow_events;
+    auto wide_listener = wide_events.listener();
+    auto narrow_listener = narrow_events.listener();
+
+    std::mt19937_64 rng(11);
+    OrderId next_id = 1;
+    for (int i = 0; i < 20'000; ++i) {
+        OrderId target = 1 + rng() % next_id;
+        unsigned kind = rng() % 10;
+        if (kind < 3 && wide.find(target) != nullptr) {
+            MatchingEngine::cancelOrder(target, wide, wide_listener);
+            MatchingEngine::cancelOrder(target, narrow, narrow_listener);
+        } else if (kind < 5 && wide.find(target) != nullptr) {
+            Price price = 950 + rng() % 100;
+            auto quantity = static_cast<Quantity>(1 + rng() % 500);
+            MatchingEngine::modifyOrder(target, price, quantity, wide, wide_listener);
+            MatchingEngine::modifyOrder(target, price, quantity, narrow, narrow_listener);
+        } else {
+            Order order(next_id++, static_cast<Quantity>(1 + rng() % 500), 950 + rng() % 100,
+                        rng() % 2 ? Side::Buy : Side::Sell);
+            MatchingEngine::submitOrder(order, wide, wide_listener);
+            MatchingEngine::submitOrder(order, narrow, narrow_listener);
+        }
+    }
+    EXPECT_EQ(wide_events.trades, narrow_events.trades);
+    EXPECT_EQ(wide_events.added.size(), narrow_events.added.size());
+    EXPECT_EQ(wide.bestBid(), narrow.bestBid());
+    EXPECT_EQ(wide.bestAsk(), narrow.bestAsk());
+
+    std::vector<std::tuple<OrderId, Price, Quantity>> wide_orders, narrow_orders;
+    wide.forEachRestingOrder([&](const Order& o) { wide_orders.emplace_back(o.id, o.price, o.quantity); });
+    narrow.forEachRestingOrder([&](const Order& o) { narrow_orders.emplace_back(o.id, o.price, o.quantity); });
+    EXPECT_EQ(wide_orders, narrow_orders);
+}
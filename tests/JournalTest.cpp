@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <unistd.h>
+
+#include "src/engines/MatchingEngine.h"
+#include "src/persistence/JournalReplay.h"
+
+namespace {
+
+using Trade = std::tuple<OrderId, OrderId, Price, Quantity>;
+
+class JournalTest : public ::testing::Test {
+  protected:
+    std::string path = (std::filesystem::temp_directory_path() /
+                        ("journal_test_" + std::to_string(::getpid()) + "_" +
+                         ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".log"))
+                           .string();
+
+    void TearDown() override { std::filesystem::remove(path); }
+
+    // random flow over one book: submits around a mid, cancels and modifies of orders still resting
+    static std::vector<Command> makeFlow(size_t count) {
+        OrderBook book(count, 1000);
+        auto listener = MatchingEngineListener{[](OrderId, OrderId, Price, Quantity) {}, [](const Order&) {},
+                                               [](OrderId) {}, [](const Order&) {}};
+        std::mt19937_64 rng(7);
+        std::vector<Command> commands;
+        OrderId next_id = 1;
+        for (size_t i = 0; i < count; ++i) {
+            OrderId target = 1 + rng() % next_id;
+            uint64_t kind = rng() % 10;
+            Command command;
+            if (kind < 2 && book.find(target) != nullptr) {
+                command = Command::cancel(0, target);
+            } else if (kind < 3 && book.find(target) != nullptr) {
+                command = Command::modify(0, target, 490 + rng() % 20, static_cast<Quantity>(1 + rng() % 10));
+            } else {
+                Side side = rng() % 2 ? Side::Buy : Side::Sell;
+                Order order(next_id++, static_cast<Quantity>(1 + rng() % 10), 490 + rng() % 20, side);
+                command = Command::submit(0, order);
+            }
+            MatchingEngine::process(command, book, listener);
+            commands.push_back(command);
+        }
+        return commands;
+    }
+};
+
+} // namespace
+
+TEST_F(JournalTest, AppendsSyncsAndRecoversOnReopen) {
+    {
+        CommandJournal journal(path, 16);
+        EXPECT_EQ(journal.lastSequence(), 0);
+        ASSERT_TRUE(journal.append(Command::submit(0, Order{1, 10, 100, Side::Buy}), 11));
+        ASSERT_TRUE(journal.append(Command::cancel(0, 1), 12));
+        journal.sync();
+        EXPECT_EQ(journal.lastSequence(), 2);
+        EXPECT_EQ(journal.durableSequence(), 2);
+    }
+    {
+        CommandJournal journal(path, 16);
+        EXPECT_EQ(journal.lastSequence(), 2);
+        ASSERT_TRUE(journal.append(Command::submit(0, Order{2, 5, 101, Side::Sell}), 13));
+    }
+
+    JournalReader reader(path);
+    ASSERT_EQ(reader.recordCount(), 3);
+    std::vector<uint64_t> sequences;
+    std::vector<Timestamp> timestamps;
+    reader.forEach([&](const JournalRecord& record) {
+        sequences.push_back(record.sequence);
+        timestamps.push_back(record.timestamp);
+    });
+    EXPECT_EQ(sequences, (std::vector<uint64_t>{1, 2, 3}));
+    EXPECT_EQ(timestamps, (std::vector<Timestamp>{11, 12, 13}));
+
+    size_t from_two = reader.forEach([](const JournalRecord&) {}, 2);
+    EXPECT_EQ(from_two, 2);
+}
+
+TEST_F(JournalTest, FullSegmentRejectsAppends) {
+    CommandJournal journal(path, 2, 100);
+    ASSERT_TRUE(journal.append(Command::cancel(0, 1)));
+    ASSERT_TRUE(journal.append(Command::cancel(0, 2)));
+    EXPECT_FALSE(journal.append(Command::cancel(0, 3)));
+    EXPECT_EQ(journal.lastSequence(), 101);
+}
+
+TEST_F(JournalTest, ReplayReproducesLiveProcessing) {
+    std::vector<Command> commands = makeFlow(5000);
+
+    OrderBook live(commands.size(), 1000);
+    std::vector<Trade> live_trades;
+    auto live_listener = MatchingEngineListener{
+        [&](OrderId in, OrderId rest, Price p, Quantity q) { live_trades.emplace_back(in, rest, p, q); },
+        [](const Order&) {}, [](OrderId) {}, [](const Order&) {}};
+    {
+        CommandJournal journal(path, commands.size());
+        for (const Command& command : commands) {
+            ASSERT_TRUE(journal.append(command));
+            MatchingEngine::process(command, live, live_listener);
+        }
+    }
+
+    OrderBook replayed(commands.size(), 1000);
+    std::vector<Trade> replayed_trades;
+    auto replay_listener = MatchingEngineListener{
+        [&](OrderId in, OrderId rest, Price p, Quantity q) { replayed_trades.emplace_back(in, rest, p, q); },
+        [](const Order&) {}, [](OrderId) {}, [](const Order&) {}};
+    JournalReader reader(path);
+    uint64_t last = replayJournal(reader, [&](SymbolId) -> OrderBook& { return replayed; }, replay_listener);
+
+    EXPECT_EQ(last, commands.size());
+    EXPECT_EQ(replayed_trades, live_trades);
+    EXPECT_EQ(replayed.bestBid(), live.bestBid());
+    EXPECT_EQ(replayed.bestAsk(), live.bestAsk());
+    for (OrderId id = 1; id <= commands.size(); ++id) {
+        Level::RestingOrder* expected = live.find(id);
+        Level::RestingOrder* actual = replayed.find(id);
+        ASSERT_EQ(actual == nullptr, expected == nullptr) << id;
+        if (expected != nullptr) {
+            EXPECT_EQ(actual->order.quantity, expected->order.quantity);
+            EXPECT_EQ(actual->order.price, expected->order.price);
+        }
+    }
+}
+
+TEST_F(JournalTest, TornRecordEndsTheValidPrefix) {
+    {
+        CommandJournal journal(path, 8);
+        for (OrderId id = 1; id <= 5; ++id) {
+            ASSERT_TRUE(journal.append(Command::cancel(0, id)));
+        }
+    }
+    {
+        // flip one byte of the third record's command, as a crash in the middle of its write would
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(JournalHeader::SIZE + 2 * sizeof(JournalRecord) + offsetof(JournalRecord, command));
+        file.put('\x7f');
+    }
+
+    JournalReader reader(path);
+    EXPECT_EQ(reader.recordCount(), 2);
+    EXPECT_EQ(reader.lastSequence(), 2);
+
+    {
+        // recovery discards the torn record and everything after it
+        CommandJournal journal(path, 8);
+        EXPECT_EQ(journal.lastSequence(), 2);
+        ASSERT_TRUE(journal.append(Command::cancel(0, 42)));
+    }
+    JournalReader recovered(path);
+    EXPECT_EQ(recovered.recordCount(), 3);
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <sstream>
+
+#include "src/metrics/LatencyRecorder.h"
+
+TEST(LatencyHistogramTest, BucketsCoverTheRangeWithBoundedRelativeError) {
+    EXPECT_EQ(LatencyHistogram::bucket(0), 0);
+    EXPECT_EQ(LatencyHistogram::bucket(LatencyHistogram::SUB_BUCKETS - 1), LatencyHistogram::SUB_BUCKETS - 1);
+    EXPECT_EQ(LatencyHistogram::bucket(UINT64_MAX), LatencyHistogram::BUCKETS - 1);
+    EXPECT_EQ(LatencyHistogram::upperBound(LatencyHistogram::BUCKETS - 1), UINT64_MAX);
+
+    std::mt19937_64 rng(3);
+    for (int i = 0; i < 100'000; ++i) {
+        uint64_t value = rng() >> (rng() % 64);
+        size_t index = LatencyHistogram::bucket(value);
+        uint64_t low = LatencyHistogram::lowerBound(index);
+        uint64_t high = LatencyHistogram::upperBound(index);
+        ASSERT_LE(low, value);
+        ASSERT_GE(high, value);
+        ASSERT_LE(static_cast<double>(high - low), static_cast<double>(value) / LatencyHistogram::HALF_BUCKETS);
+    }
+    // buckets tile the range: each one starts right after the previous one ends
+    for (size_t index = 1; index < LatencyHistogram::BUCKETS; ++index) {
+        ASSERT_EQ(LatencyHistogram::lowerBound(index), LatencyHistogram::upperBound(index - 1) + 1);
+    }
+}
+
+TEST(LatencyHistogramTest, PercentilesOfAUniformDistribution) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.percentile(99), 0);
+    for (uint64_t value = 1; value <= 10'000; ++value) {
+        histogram.record(value);
+    }
+    EXPECT_EQ(histogram.count(), 10'000);
+    EXPECT_EQ(histogram.min(), 1);
+    EXPECT_EQ(histogram.max(), 10'000);
+    EXPECT_DOUBLE_EQ(histogram.mean(), 5'000.5);
+    for (double percent : {50.0, 90.0, 99.0, 99.9}) {
+        double exact = percent * 100;
+        EXPECT_GE(histogram.percentile(percent), exact);
+        EXPECT_LE(histogram.percentile(percent), exact * 1.016);
+    }
+    EXPECT_EQ(histogram.percentile(100), 10'000);
+}
+
+TEST(LatencyHistogramTest, MergingEqualsRecordingEverythingInOne) {
+    LatencyHistogram first, second, both;
+    std::mt19937_64 rng(9);
+    for (int i = 0; i < 50'000; ++i) {
+        uint64_t value = 20 + rng() % 5'000;
+        (i % 3 == 0 ? first : second).record(value);
+        both.record(value);
+    }
+    first.merge(second);
+    EXPECT_EQ(first.count(), both.count());
+    EXPECT_EQ(first.min(), both.min());
+    EXPECT_EQ(first.max(), both.max());
+    for (double percent : {1.0, 50.0, 99.0, 99.99}) {
+        EXPECT_EQ(first.percentile(percent), both.percentile(percent));
+    }
+}
+
+TEST(LatencyHistogramTest, RecorderSamplesEachOperationOnce) {
+    OrderBook book(100, 1000);
+    auto listener = MatchingEngineListener{[](OrderId, OrderId, Price, Quantity) {}, [](const Order&) {},
+                                           [](OrderId) {}, [](const Order&) {}};
+    LatencyRecorder recorder;
+    recorder.submitOrder(Order(1, 10, 100, Side::Buy), book, listener);
+    recorder.process(Command::submit(0, Order(2, 10, 101, Side::Buy)), book, listener);
+    recorder.modifyOrder(1, 99, 5, book, listener);
+    recorder.process(Command::cancel(0, 2), book, listener);
+    recorder.cancelOrder(1, book, listener);
+
+    EXPECT_EQ(recorder.histogram(CommandType::Submit).count(), 2);
+    EXPECT_EQ(recorder.histogram(CommandType::Modify).count(), 1);
+    EXPECT_EQ(recorder.histogram(CommandType::Cancel).count(), 2);
+    EXPECT_EQ(book.find(1), nullptr);
+
+    LatencyRecorder other;
+    other.submitOrder(Order(3, 10, 100, Side::Sell), book, listener);
+    recorder.merge(other);
+    EXPECT_EQ(recorder.histogram(CommandType::Submit).count(), 3);
+    EXPECT_EQ(recorder.combined().count(), 6);
+
+    std::ostringstream report;
+    recorder.print(report, TscClock(1.0));
+    EXPECT_NE(report.str().find("p99.9"), std::string::npos);
+    EXPECT_NE(report.str().find("cancel"), std::string::npos);
+}
@@ -0,0 +1,110 @@
+#include "infrastructure/LockFreeQueue.h"
+#include "infrastructure/MpscQueue.h"
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST(LockFreeQueueTest, UsesWholePowerOfTwoCapacityAndWraps) {
+    LockFreeQueue<int> queue(6);
+    ASSERT_EQ(queue.maxSize(), 8);
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 8; ++i) {
+            ASSERT_TRUE(queue.push(round * 10 + i));
+        }
+        ASSERT_FALSE(queue.push(-1));
+        for (int i = 0; i < 8; ++i) {
+            int item = -1;
+            ASSERT_TRUE(queue.pop(item));
+            ASSERT_EQ(item, round * 10 + i);
+        }
+        int item;
+        ASSERT_FALSE(queue.pop(item));
+    }
+}
+
+TEST(LockFreeQueueTest, BatchesArePartialWhenFull) {
+    LockFreeQueue<int> queue(4);
+    std::vector<int> input{1, 2, 3, 4, 5, 6};
+    ASSERT_EQ(queue.pushBatch(input), 4);
+
+    std::vector<int> output(3);
+    ASSERT_EQ(queue.popBatch(output), 3);
+    EXPECT_EQ(output, (std::vector<int>{1, 2, 3}));
+
+    ASSERT_EQ(queue.pushBatch(std::span<const int>(input).subspan(4)), 2);
+    std::vector<int> rest;
+    ASSERT_EQ(queue.consumeBatch([&](int& item) { rest.push_back(item); }), 3);
+    EXPECT_EQ(rest, (std::vector<int>{4, 5, 6}));
+}
+
+TEST(LockFreeQueueTest, EmplaceAndConsumeMoveOnlyInPlace) {
+    LockFreeQueue<std::unique_ptr<int>> queue(2);
+    ASSERT_TRUE(queue.emplace(std::make_unique<int>(42)));
+    ASSERT_TRUE(queue.emplace(std::make_unique<int>(43)));
+
+    int seen = 0;
+    ASSERT_TRUE(queue.consume([&](std::unique_ptr<int>& item) { seen = *item; }));
+    EXPECT_EQ(seen, 42);
+    // the remaining item is destroyed with the queue
+}
+
+TEST(LockFreeQueueTest, TwoThreadsPreserveOrder) {
+    LockFreeQueue<uint64_t> queue(64);
+    const uint64_t count = 200000;
+
+    std::thread producer([&] {
+        for (uint64_t i = 0; i < count; ++i) {
+            while (!queue.push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint64_t expected = 0;
+    while (expected < count) {
+        uint64_t item;
+        if (queue.pop(item)) {
+            ASSERT_EQ(item, expected++);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+}
+
+TEST(MpscQueueTest, ProducersKeepTheirOwnOrder) {
+    MpscQueue<uint64_t> queue(128);
+    const uint64_t producers = 4;
+    const uint64_t per_producer = 50000;
+
+    std::vector<std::thread> threads;
+    for (uint64_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (uint64_t i = 0; i < per_producer; ++i) {
+                while (!queue.push(p << 32 | i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<uint64_t> next(producers, 0);
+    for (uint64_t received = 0; received < producers * per_producer;) {
+        uint64_t item;
+        if (queue.pop(item)) {
+            uint64_t producer = item >> 32;
+            ASSERT_EQ(item & 0xffffffff, next[producer]++);
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    uint64_t item;
+    EXPECT_FALSE(queue.pop(item));
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "src/engines/MatchingEngine.h"
+#include "src/marketdata/MarketDataBuilder.h"
+#include "tests/TestListeners.h"
+
+namespace {
+
+using NoopListener = decltype(makeNoopListener());
+
+class MarketDataTest : public ::testing::Test {
+  protected:
+    OrderBook book{1000, 1000};
+    MarketDataBuilder market_data;
+    NoopListener inner = makeNoopListener();
+    MarketDataListener<NoopListener> listener{inner, market_data};
+
+    void submit(OrderId id, Side side, Price price, Quantity quantity) {
+        MatchingEngine::submitOrder(Order(id, quantity, price, side), book, listener);
+    }
+
+    std::vector<std::pair<Price, Quantity>> publishLevels(Side side) {
+        std::vector<std::pair<Price, Quantity>> levels;
+        for (const LevelUpdate& update : market_data.publish(book).levels) {
+            if (update.side == side) {
+                levels.emplace_back(update.price, update.quantity);
+            }
+        }
+        return levels;
+    }
+};
+
+} // namespace
+
+TEST_F(MarketDataTest, ConflatesEveryChangeOfALevelWithinABatch) {
+    submit(1, Side::Buy, 100, 10);
+    submit(2, Side::Buy, 100, 5);
+    submit(3, Side::Buy, 99, 7);
+    MatchingEngine::cancelOrder(2, book, listener);
+    submit(4, Side::Buy, 98, 1);
+    MatchingEngine::cancelOrder(4, book, listener);
+    EXPECT_EQ(market_data.dirtyLevels(), 3);
+
+    MarketDataBatch batch = market_data.publish(book);
+    ASSERT_EQ(batch.levels.size(), 3);
+    EXPECT_EQ(batch.levels[0].price, 100);
+    EXPECT_EQ(batch.levels[0].quantity, 10);
+    EXPECT_EQ(batch.levels[1].price, 99);
+    EXPECT_EQ(batch.levels[1].quantity, 7);
+    EXPECT_EQ(batch.levels[2].price, 98);
+    EXPECT_EQ(batch.levels[2].quantity, 0); // added and gone within the batch: still reported, as removed
+    EXPECT_TRUE(batch.top_changed);
+    EXPECT_EQ(batch.top, (TopOfBook{100, 10, 0, 0}));
+
+    MarketDataBatch quiet = market_data.publish(book);
+    EXPECT_TRUE(quiet.levels.empty());
+    EXPECT_FALSE(quiet.top_changed);
+}
+
+TEST_F(MarketDataTest, TradesUpdateBothTheSweptLevelsAndTheRestingRemainder) {
+    submit(1, Side::Sell, 101, 5);
+    submit(2, Side::Sell, 102, 5);
+    market_data.publish(book);
+
+    submit(3, Side::Buy, 102, 8); // takes 101 entirely and 3 of 102
+    EXPECT_EQ(publishLevels(Side::Sell), (std::vector<std::pair<Price, Quantity>>{{101, 0}, {102, 2}}));
+
+    submit(4, Side::Buy, 103, 4); // takes the last 2 at 102, rests 2 at 103
+    MarketDataBatch batch = market_data.publish(book);
+    ASSERT_EQ(batch.levels.size(), 2);
+    EXPECT_EQ(batch.levels[0].side, Side::Sell);
+    EXPECT_EQ(batch.levels[0].quantity, 0);
+    EXPECT_EQ(batch.levels[1].side, Side::Buy);
+    EXPECT_EQ(batch.levels[1].price, 103);
+    EXPECT_EQ(batch.levels[1].quantity, 2);
+    EXPECT_EQ(batch.top, (TopOfBook{103, 2, 0, 0}));
+}
+
+TEST_F(MarketDataTest, ModifiesReportOldAndNewLevels) {
+    submit(1, Side::Buy, 100, 10);
+    market_data.publish(book);
+
+    MatchingEngine::modifyOrder(1, 100, 4, book, listener);
+    EXPECT_EQ(publishLevels(Side::Buy), (std::vector<std::pair<Price, Quantity>>{{100, 4}}));
+
+    MatchingEngine::modifyOrder(1, 97, 4, book, listener);
+    EXPECT_EQ(publishLevels(Side::Buy), (std::vector<std::pair<Price, Quantity>>{{100, 0}, {97, 4}}));
+}
+
+TEST_F(MarketDataTest, UpdatesRebuildTheDepthUnderRandomChurn) {
+    // a downstream consumer applying the published updates must end up with the book's exact depth
+    std::map<std::pair<Side, Price>, Quantity> depth;
+    std::mt19937_64 rng(5);
+    OrderId next_id = 1;
+    for (int batch = 0; batch < 200; ++batch) {
+        for (int i = 0; i < 50; ++i) {
+            OrderId target = 1 + rng() % next_id;
+            if (rng() % 3 == 0 && book.find(target) != nullptr) {
+                MatchingEngine::cancelOrder(target, book, listener);
+            } else if (rng() % 4 == 0 && book.find(target) != nullptr) {
+                MatchingEngine::modifyOrder(target, 490 + rng() % 20, static_cast<Quantity>(1 + rng() % 10), book,
+                                            listener);
+            } else {
+                Side side = rng() % 2 ? Side::Buy : Side::Sell;
+                submit(next_id++, side, 490 + rng() % 20, static_cast<Quantity>(1 + rng() % 10));
+            }
+        }
+        for (const LevelUpdate& update : market_data.publish(book).levels) {
+            if (update.quantity == 0) {
+                depth.erase({update.side, update.price});
+            } else {
+                depth[{update.side, update.price}] = update.quantity;
+            }
+        }
+    }
+
+    std::map<std::pair<Side, Price>, Quantity> expected;
+    book.forEachRestingOrder([&](const Order& order) { expected[{order.side, order.price}] += order.quantity; });
+    EXPECT_EQ(depth, expected);
+}
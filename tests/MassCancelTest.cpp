@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "src/domain/Instruments.h"
+#include "src/engines/MatchingEngine.h"
+#include "src/orderbook/OrderBook.h"
+
+namespace {
+
+struct BulkListener {
+    std::vector<std::vector<OrderId>> batches;
+    size_t single_cancels = 0;
+
+    void onTrade(OrderId, OrderId, Price, Quantity) {}
+    void onOrderAdded(const Order&) {}
+    void onOrderCanceled(OrderId) { ++single_cancels; }
+    void onOrderModified(const Order&) {}
+    void onOrdersCanceled(std::span<const Order> orders) {
+        std::vector<OrderId> ids;
+        for (const Order& order : orders) {
+            ids.push_back(order.id);
+        }
+        batches.push_back(std::move(ids));
+    }
+};
+
+std::vector<OrderId> restingIds(OrderBook& book) {
+    std::vector<OrderId> ids;
+    book.forEachRestingOrder([&](const Order& order) { ids.push_back(order.id); });
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+} // namespace
+
+TEST(MassCancelTest, RemovesOnlyTheOwnersOrdersAndMovesCursorsOnce) {
+    OrderBook book(100, 1000);
+    BulkListener listener;
+    MatchingEngine::submitOrder(Order(1, 10, 100, Side::Buy, 7), book, listener);
+    MatchingEngine::submitOrder(Order(2, 10, 99, Side::Buy, 8), book, listener);
+    MatchingEngine::submitOrder(Order(3, 10, 98, Side::Buy, 7), book, listener);
+    MatchingEngine::submitOrder(Order(4, 10, 105, Side::Sell, 7), book, listener);
+    MatchingEngine::submitOrder(Order(5, 10, 106, Side::Sell), book, listener);
+    MatchingEngine::submitOrder(Order(6, 10, 105, Side::Sell, 7), book, listener);
+
+    EXPECT_EQ(MatchingEngine::massCancel(7, book, listener), 4);
+    EXPECT_EQ(listener.single_cancels, 0);
+    ASSERT_EQ(listener.batches.size(), 1);
+    std::vector<OrderId> canceled = listener.batches[0];
+    std::sort(canceled.begin(), canceled.end());
+    EXPECT_EQ(canceled, (std::vector<OrderId>{1, 3, 4, 6}));
+
+    EXPECT_EQ(book.bestBid(), 99);
+    EXPECT_EQ(book.bestAsk(), 106);
+    EXPECT_EQ(book.find(1), nullptr);
+    EXPECT_EQ(restingIds(book), (std::vector<OrderId>{2, 5}));
+    EXPECT_EQ(book.bidLevel(100).getTotalQuantity(), 0);
+
+    // nothing left for owner 7, and owner 0 (no owner) is never mass cancelled
+    EXPECT_EQ(MatchingEngine::massCancel(7, book, listener), 0);
+    EXPECT_EQ(MatchingEngine::massCancel(0, book, listener), 0);
+    EXPECT_EQ(listener.batches.size(), 1);
+}
+
+TEST(MassCancelTest, FilterBySideAndPriceRange) {
+    OrderBook book(100, 1000);
+    std::vector<OrderId> canceled;
+    auto listener = MatchingEngineListener{[](OrderId, OrderId, Price, Quantity) {}, [](const Order&) {},
+                                           [&](OrderId id) { canceled.push_back(id); }, [](const Order&) {}};
+    for (OrderId id = 1; id <= 10; ++id) {
+        MatchingEngine::submitOrder(Order(id, 5, 90 + id, Side::Buy, 3), book, listener);
+        MatchingEngine::submitOrder(Order(100 + id, 5, 200 + id, Side::Sell, 3), book, listener);
+    }
+
+    MassCancelFilter bids_above_95{Side::Buy, 96, 1000};
+    EXPECT_EQ(MatchingEngine::massCancel(3, book, listener, bids_above_95), 5);
+    std::sort(canceled.begin(), canceled.end());
+    EXPECT_EQ(canceled, (std::vector<OrderId>{6, 7, 8, 9, 10}));
+    EXPECT_EQ(book.bestBid(), 95);
+    EXPECT_EQ(book.bestAsk(), 201);
+
+    MassCancelFilter asks_band{std::nullopt, 201, 203};
+    EXPECT_EQ(MatchingEngine::massCancel(3, book, listener, asks_band), 3);
+    EXPECT_EQ(book.bestAsk(), 204);
+
+    EXPECT_EQ(MatchingEngine::massCancel(3, book, listener), 12);
+    EXPECT_FALSE(book.hasBids());
+    EXPECT_FALSE(book.hasAsks());
+}
+
+TEST(MassCancelTest, OwnerListsFollowFillsCancelsAndReprices) {
+    OrderBook book(2'000, 1'000);
+    BulkListener listener;
+    std::mt19937_64 rng(5);
+    std::vector<OrderId> live;
+    OrderId next_id = 1;
+    for (int i = 0; i < 20'000; ++i) {
+        unsigned kind = rng() % 10;
+        if (kind < 2 && !live.empty()) {
+            size_t at = rng() % live.size();
+            if (book.find(live[at]) != nullptr) {
+                MatchingEngine::cancelOrder(live[at], book, listener);
+            }
+            live[at] = live.back();
+            live.pop_back();
+        } else if (kind < 4 && !live.empty()) {
+            OrderId target = live[rng() % live.size()];
+            if (book.find(target) != nullptr) {
+                MatchingEngine::modifyOrder(target, 480 + rng() % 40, static_cast<Quantity>(1 + rng() % 50), book,
+                                            listener);
+            }
+        } else {
+            Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            auto owner = static_cast<OwnerId>(rng() % 4); // 0: unowned
+            MatchingEngine::submitOrder(
+                Order(next_id, static_cast<Quantity>(1 + rng() % 50), 480 + rng() % 40, side, owner), book, listener);
+            live.push_back(next_id++);
+        }
+    }
+
+    std::vector<OrderId> expected_survivors;
+    size_t owner_two = 0;
+    book.forEachRestingOrder([&](const Order& order) {
+        if (order.owner == 2) {
+            ++owner_two;
+        } else {
+            expected_survivors.push_back(order.id);
+        }
+    });
+    std::sort(expected_survivors.begin(), expected_survivors.end());
+    ASSERT_GT(owner_two, 0);
+
+    EXPECT_EQ(MatchingEngine::massCancel(2, book, listener), owner_two);
+    EXPECT_EQ(restingIds(book), expected_survivors);
+    Price best_bid = 0;
+    Price best_ask = 1'001;
+    book.forEachRestingOrder([&](const Order& order) {
+        if (order.side == Side::Buy) {
+            best_bid = std::max(best_bid, order.price);
+        } else {
+            best_ask = std::min(best_ask, order.price);
+        }
+    });
+    EXPECT_EQ(book.hasBids() ? book.bestBid() : 0, best_bid);
+    EXPECT_EQ(book.hasAsks() ? book.bestAsk() : 1'001, best_ask);
+}
+
+TEST(MassCancelTest, NarrowInstrumentCarriesItsOwner) {
+    BasicOrderBook<CompactEquity> book(100, 1000);
+    BulkListener listener;
+    EXPECT_FALSE(book.accepts(Order(1, 10, 100, Side::Buy, 256)));
+    MatchingEngine::submitOrder(Order(1, 10, 100, Side::Buy, 255), book, listener);
+    MatchingEngine::submitOrder(Order(2, 10, 101, Side::Sell, 254), book, listener);
+    EXPECT_EQ(MatchingEngine::massCancel(255, book, listener), 1);
+    EXPECT_FALSE(book.hasBids());
+    EXPECT_EQ(book.bestAsk(), 101);
+}
+
+TEST(MassCancelTest, RestoredBookKeepsOwnerLists) {
+    OrderBook book(100, 1000);
+    BulkListener listener;
+    MatchingEngine::submitOrder(Order(1, 10, 100, Side::Buy, 4), book, listener);
+    MatchingEngine::submitOrder(Order(2, 10, 99, Side::Buy, 5), book, listener);
+    MatchingEngine::submitOrder(Order(3, 10, 101, Side::Sell, 4), book, listener);
+
+    std::vector<Order> orders;
+    book.forEachRestingOrder([&](const Order& order) { orders.push_back(order); });
+    OrderBook restored(100, 1000);
+    ASSERT_TRUE(restored.restore(orders, book.max_bid, book.min_ask));
+
+    EXPECT_EQ(MatchingEngine::massCancel(4, restored, listener), 2);
+    EXPECT_EQ(restingIds(restored), (std::vector<OrderId>{2}));
+    EXPECT_EQ(restored.bestBid(), 99);
+    EXPECT_FALSE(restored.hasAsks());
+}
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <iostream>
+#include <random>
+#include <span>
+#include <tuple>
 #include <vector>
 
 #include "src/engines/MatchingEngine.h"
@@ -31,7 +35,8 @@ class MatchingEngineTest : public ::testing::Test {
         return MatchingEngineListener{
             [&](OrderId in, OrderId rest, Price p, Quantity q) { history.push_back({Event::TRADE, in, rest, q}); },
             [&](const Order& o) { history.push_back({Event::ADDED, o.id, 0, o.quantity}); },
-            [&](OrderId id) { history.push_back({Event::CANCELED, id, 0, 0}); }};
+            [&](OrderId id) { history.push_back({Event::CANCELED, id, 0, 0}); },
+            [&](const Order& o) { history.push_back({Event::ADDED, o.id, 0, o.quantity}); }};
     }
 
     void SetUp() override { history.clear(); }
@@ -95,6 +100,25 @@ TEST_F(MatchingEngineTest, ModifyInPlace_UpdatesWithoutLosingPriority) {
     EXPECT_EQ(history[0].qty, 80);
 }
 
+TEST_F(MatchingEngineTest, ModifyToZero_ReportsTheOrderAndFreesIt) {
+    auto listener = make_listener();
+
+    MatchingEngine::submitOrder(Order{42, 10, 100, Side::Buy}, book, listener);
+    MatchingEngine::submitOrder(Order{43, 10, 100, Side::Buy}, book, listener);
+    history.clear();
+
+    // the slot is released by the resize: the report must not read it afterwards
+    MatchingEngine::modifyOrder(42, 100, 0, book, listener);
+    ASSERT_EQ(history.size(), 1);
+    EXPECT_EQ(history[0], (Event{Event::ADDED, 42, 0, 0}));
+    EXPECT_EQ(book.find(42), nullptr);
+    EXPECT_EQ(book.bidLevel(100).getTotalQuantity(), 10);
+
+    MatchingEngine::submitOrder(Order{44, 5, 100, Side::Sell}, book, listener);
+    ASSERT_EQ(history.size(), 2);
+    EXPECT_EQ(history[1], (Event{Event::TRADE, 44, 43, 5}));
+}
+
 TEST_F(MatchingEngineTest, ModifyAggressive_GhostTradeCheck) {
     auto listener = make_listener();
 
@@ -110,4 +134,223 @@ TEST_F(MatchingEngineTest, ModifyAggressive_GhostTradeCheck) {
     ASSERT_EQ(history.size(), 1);
     EXPECT_EQ(history[0].type, Event::TRADE);
     EXPECT_EQ(history[0].incoming_id, 2);
-}
\ No newline at end of file
+}
+
+TEST_F(MatchingEngineTest, ModifyReprice_RelinksWithoutReallocating) {
+    auto listener = make_listener();
+
+    MatchingEngine::submitOrder(Order{1, 10, 100, Side::Buy}, book, listener);
+    MatchingEngine::submitOrder(Order{2, 10, 100, Side::Buy}, book, listener);
+    MatchingEngine::submitOrder(Order{3, 10, 99, Side::Buy}, book, listener);
+    MatchingEngine::submitOrder(Order{4, 10, 105, Side::Sell}, book, listener);
+    history.clear();
+    auto* slot = book.find(1);
+
+    // away from the touch: same slot, new level, reported as a re-add
+    MatchingEngine::modifyOrder(1, 98, 7, book, listener);
+    EXPECT_EQ(book.find(1), slot);
+    EXPECT_EQ(slot->order.price, 98);
+    EXPECT_EQ(book.bidLevel(98).getTotalQuantity(), 7);
+    EXPECT_EQ(book.bidLevel(100).getTotalQuantity(), 10);
+    ASSERT_EQ(history.size(), 1);
+    EXPECT_EQ(history[0], (Event{Event::ADDED, 1, 0, 7}));
+
+    // emptying the best level moves the cursor down, improving moves it up
+    MatchingEngine::modifyOrder(2, 97, 10, book, listener);
+    EXPECT_EQ(book.bestBid(), 99);
+    MatchingEngine::modifyOrder(1, 104, 7, book, listener);
+    EXPECT_EQ(book.find(1), slot);
+    EXPECT_EQ(book.bestBid(), 104);
+
+    // an ask moving up behind the best one
+    MatchingEngine::modifyOrder(4, 110, 10, book, listener);
+    EXPECT_EQ(book.bestAsk(), 110);
+    EXPECT_EQ(book.askLevel(105).getTotalQuantity(), 0);
+}
+
+TEST_F(MatchingEngineTest, ModifySizeUp_LosesPriorityInPlace) {
+    auto listener = make_listener();
+
+    MatchingEngine::submitOrder(Order{1, 10, 100, Side::Sell}, book, listener);
+    MatchingEngine::submitOrder(Order{2, 10, 100, Side::Sell}, book, listener);
+    auto* slot = book.find(1);
+    MatchingEngine::modifyOrder(1, 100, 15, book, listener);
+    EXPECT_EQ(book.find(1), slot);
+    EXPECT_EQ(book.askLevel(100).getTotalQuantity(), 25);
+    history.clear();
+
+    MatchingEngine::submitOrder(Order{3, 12, 100, Side::Buy}, book, listener);
+    ASSERT_EQ(history.size(), 2);
+    EXPECT_EQ(history[0], (Event{Event::TRADE, 3, 2, 10}));
+    EXPECT_EQ(history[1], (Event{Event::TRADE, 3, 1, 2}));
+}
+
+TEST(MatchingEngineRejectTest, FullBookRejectsInsteadOfThrowing) {
+    OrderBook book{1, 1000};
+    std::vector<std::pair<OrderId, RejectReason>> rejects;
+    auto listener = MatchingEngineListener{[](OrderId, OrderId, Price, Quantity) {}, [](const Order&) {},
+                                           [](OrderId) {}, [](const Order&) {},
+                                           [&](const Order& o, RejectReason r) { rejects.emplace_back(o.id, r); }};
+
+    MatchingEngine::submitOrder(Order{1, 10, 100, Side::Sell}, book, listener);
+    MatchingEngine::submitOrder(Order{2, 10, 101, Side::Sell}, book, listener);
+
+    ASSERT_EQ(rejects.size(), 1);
+    EXPECT_EQ(rejects[0].first, 2);
+    EXPECT_EQ(rejects[0].second, RejectReason::BookFull);
+    EXPECT_EQ(book.bestAsk(), 100);
+    EXPECT_EQ(book.find(2), nullptr);
+
+    // the slot freed by a fill is usable again
+    MatchingEngine::submitOrder(Order{3, 10, 100, Side::Buy}, book, listener);
+    MatchingEngine::submitOrder(Order{4, 10, 101, Side::Sell}, book, listener);
+    EXPECT_EQ(rejects.size(), 1);
+    EXPECT_EQ(book.bestAsk(), 101);
+}
+TEST(MatchingEngineRejectTest, DuplicateIdIsRejectedBeforeMatching) {
+    OrderBook book{8, 1000};
+    std::vector<OrderId> trades;
+    std::vector<std::pair<OrderId, RejectReason>> rejects;
+    auto listener = MatchingEngineListener{[&](OrderId incoming, OrderId, Price, Quantity) { trades.push_back(incoming); },
+                                           [](const Order&) {}, [](OrderId) {}, [](const Order&) {},
+                                           [&](const Order& o, RejectReason r) { rejects.emplace_back(o.id, r); }};
+
+    MatchingEngine::submitOrder(Order{1, 10, 100, Side::Buy}, book, listener);
+    MatchingEngine::submitOrder(Order{2, 5, 101, Side::Sell}, book, listener);
+    // would rest, and would trade against order 2: neither happens
+    MatchingEngine::submitOrder(Order{1, 10, 99, Side::Buy}, book, listener);
+    MatchingEngine::submitOrder(Order{1, 3, 101, Side::Buy}, book, listener);
+
+    ASSERT_EQ(rejects.size(), 2);
+    EXPECT_EQ(rejects[0], std::make_pair(OrderId{1}, RejectReason::DuplicateOrder));
+    EXPECT_EQ(rejects[1], std::make_pair(OrderId{1}, RejectReason::DuplicateOrder));
+    EXPECT_TRUE(trades.empty());
+    EXPECT_EQ(book.bidLevel(99).getTotalQuantity(), 0);
+    EXPECT_EQ(book.askLevel(101).getTotalQuantity(), 5);
+
+    // the original keeps the only index entry: filling it leaves the id free, and nothing points at its slot
+    MatchingEngine::submitOrder(Order{3, 10, 100, Side::Sell}, book, listener);
+    EXPECT_EQ(book.find(1), nullptr);
+    EXPECT_FALSE(book.hasBids());
+    MatchingEngine::submitOrder(Order{4, 7, 100, Side::Buy}, book, listener);
+    EXPECT_FALSE(MatchingEngine::cancelOrder(1, book, listener));
+    ASSERT_NE(book.find(4), nullptr);
+    EXPECT_EQ(book.bestBid(), 100);
+
+    // and can be used again
+    MatchingEngine::submitOrder(Order{1, 2, 98, Side::Buy}, book, listener);
+    EXPECT_EQ(rejects.size(), 2);
+    ASSERT_NE(book.find(1), nullptr);
+}
+
+// processBatch only looks ahead on books that have outgrown the caches: rests and cancels enough orders for that
+void deepen(OrderBook& book) {
+    auto listener = MatchingEngineListener{[](OrderId, OrderId, Price, Quantity) {}, [](const Order&) {},
+                                           [](OrderId) {}, [](const Order&) {}};
+    constexpr OwnerId FILLER = 7;
+    for (OrderId id = 1; id <= MatchingEngine::PREFETCH_MIN_SLOTS; ++id) {
+        MatchingEngine::submitOrder(Order{id, 1, 1, Side::Buy, FILLER}, book, listener);
+    }
+    MatchingEngine::massCancel(FILLER, book, listener);
+}
+
+TEST(MatchingEngineBatchTest, BatchProcessingMatchesSequentialProcessing) {
+    using Record = std::tuple<int, OrderId, OrderId, Price, Quantity>;
+    auto make_recorder = [](std::vector<Record>& records) {
+        return MatchingEngineListener{
+            [&](OrderId in, OrderId rest, Price p, Quantity q) { records.emplace_back(0, in, rest, p, q); },
+            [&](const Order& o) { records.emplace_back(1, o.id, 0, o.price, o.quantity); },
+            [&](OrderId id) { records.emplace_back(2, id, 0, 0, 0); },
+            [&](const Order& o) { records.emplace_back(3, o.id, 0, o.price, o.quantity); }};
+    };
+
+    // crossing flow with cancels and modifies of live orders, some of them cancelled again a few commands later
+    std::vector<Command> commands;
+    {
+        OrderBook shadow(20000, 1000);
+        std::vector<Record> ignored;
+        auto listener = make_recorder(ignored);
+        std::mt19937_64 rng(9);
+        OrderId next_id = 1;
+        for (int i = 0; i < 20000; ++i) {
+            OrderId target = next_id > 8 && rng() % 2 ? next_id - 1 - rng() % 8 : 1 + rng() % next_id;
+            uint64_t kind = rng() % 10;
+            Command command;
+            if (kind < 3 && shadow.find(target) != nullptr) {
+                command = Command::cancel(0, target);
+            } else if (kind < 5 && shadow.find(target) != nullptr) {
+                command = Command::modify(0, target, 480 + rng() % 40, static_cast<Quantity>(1 + rng() % 20));
+            } else {
+                Side side = rng() % 2 ? Side::Buy : Side::Sell;
+                command = Command::submit(
+                    0, Order(next_id++, static_cast<Quantity>(1 + rng() % 20), 480 + rng() % 40, side));
+            }
+            MatchingEngine::process(command, shadow, listener);
+            commands.push_back(command);
+        }
+    }
+
+    OrderBook sequential_book(20000, 1000);
+    std::vector<Record> sequential;
+    auto sequential_listener = make_recorder(sequential);
+    for (const Command& command : commands) {
+        MatchingEngine::process(command, sequential_book, sequential_listener);
+    }
+
+    for (size_t batch_size : {1, 7, 32, 128}) {
+        OrderBook batched_book(MatchingEngine::PREFETCH_MIN_SLOTS, 1000);
+        deepen(batched_book);
+        std::vector<Record> batched;
+        auto batched_listener = make_recorder(batched);
+        std::span<const Command> all(commands);
+        for (size_t offset = 0; offset < all.size(); offset += batch_size) {
+            MatchingEngine::processBatch(all.subspan(offset, std::min(batch_size, all.size() - offset)), batched_book,
+                                         batched_listener);
+        }
+        ASSERT_EQ(batched, sequential) << "batch size " << batch_size;
+        EXPECT_EQ(batched_book.bestBid(), sequential_book.bestBid());
+        EXPECT_EQ(batched_book.bestAsk(), sequential_book.bestAsk());
+    }
+}
+
+TEST(MatchingEngineBatchTest, TargetsChangedAfterLookupAreLookedUpAgain) {
+    using Record = std::tuple<int, OrderId, Price, Quantity>;
+    auto make_recorder = [](std::vector<Record>& records) {
+        return MatchingEngineListener{
+            [&](OrderId in, OrderId, Price p, Quantity q) { records.emplace_back(0, in, p, q); },
+            [&](const Order& o) { records.emplace_back(1, o.id, o.price, o.quantity); },
+            [&](OrderId id) { records.emplace_back(2, id, 0, 0); },
+            [&](const Order& o) { records.emplace_back(3, o.id, o.price, o.quantity); }};
+    };
+    // the batch looks up each cancel/modify target a few commands ahead: here the earlier commands cancel order 1
+    // and resubmit its id into the same slot, and submit order 20 only after its modify was looked up
+    std::vector<Command> commands = {
+        Command::cancel(0, 1),
+        Command::submit(0, Order(1, 4, 98, Side::Buy)),
+        Command::submit(0, Order(20, 5, 105, Side::Sell)),
+        Command::submit(0, Order(21, 5, 106, Side::Sell)),
+        Command::cancel(0, 1),
+        Command::modify(0, 20, 104, 3),
+        Command::submit(0, Order(22, 1, 97, Side::Buy)),
+        Command::submit(0, Order(23, 1, 96, Side::Buy)),
+        Command::cancel(0, 1),
+    };
+    std::vector<Record> expected;
+    std::vector<Record> batched;
+    OrderBook sequential_book(16, 1000);
+    OrderBook batched_book(MatchingEngine::PREFETCH_MIN_SLOTS, 1000);
+    deepen(batched_book);
+    auto sequential_listener = make_recorder(expected);
+    auto batched_listener = make_recorder(batched);
+    MatchingEngine::submitOrder(Order{1, 10, 100, Side::Buy}, sequential_book, sequential_listener);
+    MatchingEngine::submitOrder(Order{1, 10, 100, Side::Buy}, batched_book, batched_listener);
+    for (const Command& command : commands) {
+        MatchingEngine::process(command, sequential_book, sequential_listener);
+    }
+    MatchingEngine::processBatch(std::span<const Command>(commands), batched_book, batched_listener);
+
+    ASSERT_EQ(batched, expected);
+    EXPECT_EQ(batched_book.find(1), nullptr);
+    EXPECT_EQ(batched_book.bestBid(), 97);
+    EXPECT_EQ(batched_book.bestAsk(), 104);
+}
@@ -19,12 +19,47 @@ TEST(ObjectPoolTest, AllocationAndReuse) {
 
     ASSERT_NE(dummy1, dummy2);
     ASSERT_EQ(dummy3, dummy1);
-    ASSERT_EQ(dummy3->id, 1);
+    // the free list lives inside freed slots: a reused slot doesn't keep its old contents
 }
 
 TEST(ObjectPoolTest, PoolExhaustion) {
     ObjectPool<Dummy> pool(1);
     Dummy* dummy1 = pool.allocate();
     ASSERT_NE(dummy1, nullptr);
-    ASSERT_THROW(pool.allocate(), std::runtime_error);
+    ASSERT_EQ(pool.allocate(), nullptr);
+}
+
+TEST(ObjectPoolTest, GrowsByChunksWithoutMovingObjects) {
+    const size_t capacity = 3 * ObjectPool<Dummy>::CHUNK_BYTES / sizeof(Dummy);
+    ObjectPool<Dummy> pool(capacity, PoolOptions{.initial_capacity = 1});
+    ASSERT_EQ(pool.committedCapacity(), ObjectPool<Dummy>::CHUNK_BYTES / sizeof(Dummy));
+
+    Dummy* first = pool.allocate();
+    first->id = 7;
+    for (size_t i = 1; i < capacity; ++i) {
+        Dummy* dummy = pool.allocate();
+        ASSERT_NE(dummy, nullptr);
+        ASSERT_EQ(pool.indexOf(dummy), i);
+        dummy->id = static_cast<int>(i);
+    }
+    ASSERT_EQ(pool.allocate(), nullptr);
+    ASSERT_EQ(pool.committedCapacity(), capacity);
+    ASSERT_EQ(first->id, 7);
+    ASSERT_EQ(&pool[0], first);
+}
+
+TEST(ObjectPoolTest, FreeListIsLifo) {
+    ObjectPool<Dummy> pool(4);
+    Dummy* a = pool.allocate();
+    Dummy* b = pool.allocate();
+    Dummy* c = pool.allocate();
+
+    pool.deallocate(a);
+    pool.deallocate(c);
+    pool.deallocate(b);
+
+    ASSERT_EQ(pool.allocate(), b);
+    ASSERT_EQ(pool.allocate(), c);
+    ASSERT_EQ(pool.allocate(), a);
+    ASSERT_EQ(pool.highWaterMark(), 3);
 }
\ No newline at end of file
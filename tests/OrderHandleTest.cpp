@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "src/domain/Instruments.h"
+#include "src/engines/MatchingEngine.h"
+#include "src/marketdata/MarketDataBuilder.h"
+#include "src/orderbook/OrderBook.h"
+#include "tests/TestListeners.h"
+
+TEST(OrderHandleTest, CancelsByHandle) {
+    OrderBook book(100, 1'000);
+    RecordingListener listener;
+    MatchingEngine::submitOrder(Order(1, 10, 100, Side::Buy), book, listener);
+    MatchingEngine::submitOrder(Order(2, 10, 101, Side::Buy), book, listener);
+    MatchingEngine::submitOrder(Order(3, 10, 105, Side::Sell), book, listener);
+    ASSERT_EQ(listener.handles.size(), 3);
+    EXPECT_EQ(book.resolve(listener.handles[2]), book.find(2));
+    EXPECT_EQ(book.handleOf(*book.find(3)), listener.handles[3]);
+
+    EXPECT_TRUE(MatchingEngine::cancelOrder(listener.handles[2], book, listener));
+    EXPECT_EQ(listener.canceled, (std::vector<OrderId>{2}));
+    EXPECT_EQ(book.find(2), nullptr);
+    EXPECT_EQ(book.bestBid(), 100);
+    EXPECT_TRUE(MatchingEngine::cancelOrder(listener.handles[3], book, listener));
+    EXPECT_FALSE(book.hasAsks());
+}
+
+TEST(OrderHandleTest, StaleHandlesAreRejected) {
+    OrderBook book(4, 1'000);
+    RecordingListener listener;
+    MatchingEngine::submitOrder(Order(1, 10, 100, Side::Buy), book, listener);
+    OrderHandle first = listener.handles[1];
+    ASSERT_TRUE(MatchingEngine::cancelOrder(first, book, listener));
+
+    // the release moved the slot's generation to first.generation + 1: a handle guessing it still names a free slot
+    OrderHandle guessed{first.slot, first.generation + 1};
+    EXPECT_EQ(book.resolve(guessed), nullptr);
+    EXPECT_FALSE(MatchingEngine::cancelOrder(guessed, book, listener));
+    EXPECT_FALSE(MatchingEngine::modifyOrder(guessed, 99, 5, book, listener));
+
+    // the freed slot is handed to the next order: the old handle names the slot but not the order
+    MatchingEngine::submitOrder(Order(2, 10, 100, Side::Buy), book, listener);
+    OrderHandle second = listener.handles[2];
+    EXPECT_EQ(second.slot, first.slot);
+    EXPECT_NE(second.generation, first.generation);
+    EXPECT_FALSE(MatchingEngine::cancelOrder(first, book, listener));
+    EXPECT_FALSE(MatchingEngine::modifyOrder(first, 99, 5, book, listener));
+    EXPECT_EQ(listener.canceled.size(), 1);
+    EXPECT_EQ(book.find(2)->order.quantity, 10);
+
+    // slots never handed out, and the default handle, resolve to nothing
+    EXPECT_EQ(book.resolve(OrderHandle{3, 0}), nullptr);
+    EXPECT_EQ(book.resolve(OrderHandle{}), nullptr);
+
+    // a filled order's handle goes stale too
+    MatchingEngine::submitOrder(Order(3, 10, 100, Side::Sell), book, listener);
+    EXPECT_EQ(book.resolve(second), nullptr);
+    EXPECT_FALSE(MatchingEngine::cancelOrder(second, book, listener));
+}
+
+TEST(OrderHandleTest, HandlesStayStaleAcrossReset) {
+    OrderBook book(4, 1'000);
+    RecordingListener listener;
+    MatchingEngine::submitOrder(Order(1, 10, 100, Side::Buy), book, listener);
+    MatchingEngine::submitOrder(Order(2, 10, 101, Side::Sell), book, listener);
+    OrderHandle first = listener.handles[1];
+    ASSERT_TRUE(MatchingEngine::cancelOrder(first, book, listener));
+    ASSERT_TRUE(MatchingEngine::cancelOrder(listener.handles[2], book, listener));
+
+    // the pool hands out its first slot again, under a generation no handle has seen
+    book.reset();
+    MatchingEngine::submitOrder(Order(3, 10, 100, Side::Buy), book, listener);
+    OrderHandle third = listener.handles[3];
+    EXPECT_EQ(third.slot, first.slot);
+    EXPECT_NE(third.generation, first.generation);
+    EXPECT_EQ(book.resolve(first), nullptr);
+    EXPECT_FALSE(MatchingEngine::cancelOrder(first, book, listener));
+    EXPECT_EQ(book.resolve(third), book.find(3));
+
+    // same for orders bulk-loaded by restore()
+    ASSERT_TRUE(MatchingEngine::cancelOrder(third, book, listener));
+    book.reset();
+    std::vector<Order> saved = {Order(4, 5, 99, Side::Buy)};
+    ASSERT_TRUE(book.restore(saved, 99, book.max_price + 1));
+    EXPECT_EQ(book.resolve(first), nullptr);
+    EXPECT_EQ(book.resolve(third), nullptr);
+    EXPECT_NE(book.handleOf(*book.find(4)), third);
+    EXPECT_EQ(listener.canceled, (std::vector<OrderId>{1, 2, 3}));
+}
+
+TEST(OrderHandleTest, UnknownIdsAreNotDereferenced) {
+    OrderBook book(4, 1'000);
+    RecordingListener listener;
+    EXPECT_FALSE(MatchingEngine::cancelOrder(OrderId{7}, book, listener));
+    EXPECT_FALSE(MatchingEngine::modifyOrder(OrderId{7}, 100, 10, book, listener));
+    MatchingEngine::process(Command::cancel(0, 7), book, listener);
+    EXPECT_TRUE(listener.canceled.empty());
+    EXPECT_TRUE(listener.handles.empty());
+}
+
+TEST(OrderHandleTest, ModifiesKeepOrRenewTheHandle) {
+    OrderBook book(100, 1'000);
+    RecordingListener listener;
+    MatchingEngine::submitOrder(Order(1, 10, 100, Side::Buy), book, listener);
+    MatchingEngine::submitOrder(Order(2, 10, 110, Side::Sell), book, listener);
+    OrderHandle handle = listener.handles[1];
+
+    // size-down and partial fill: same slot, same handle
+    ASSERT_TRUE(MatchingEngine::modifyOrder(handle, 100, 8, book, listener));
+    EXPECT_EQ(listener.modified.back().quantity, 8);
+    MatchingEngine::submitOrder(Order(3, 3, 100, Side::Sell), book, listener);
+    EXPECT_EQ(book.resolve(handle)->order.quantity, 5);
+
+    // in-place reprice: reported through onOrderAdded with the handle unchanged
+    ASSERT_TRUE(MatchingEngine::modifyOrder(handle, 102, 5, book, listener));
+    EXPECT_EQ(listener.handles[1], handle);
+    EXPECT_EQ(book.bestBid(), 102);
+
+    // a crossing reprice re-matches through a new slot: the remainder rests under a new handle
+    ASSERT_TRUE(MatchingEngine::modifyOrder(handle, 110, 15, book, listener));
+    EXPECT_EQ(std::get<1>(listener.trades.back()), 2);
+    EXPECT_NE(listener.handles[1], handle);
+    EXPECT_EQ(book.resolve(handle), nullptr);
+    EXPECT_EQ(book.resolve(listener.handles[1])->order.quantity, 5);
+}
+
+TEST(OrderHandleTest, LambdaAndMarketDataListenersGetHandles) {
+    OrderBook book(100, 1'000);
+    OrderHandle reported;
+    auto listener = MatchingEngineListener{[](OrderId, OrderId, Price, Quantity) {},
+                                           [&](const Order&, OrderHandle handle) { reported = handle; },
+                                           [](OrderId) {}, [](const Order&) {}};
+    MatchingEngine::submitOrder(Order(1, 10, 100, Side::Buy), book, listener);
+    EXPECT_EQ(book.resolve(reported), book.find(1));
+
+    RecordingListener inner;
+    MarketDataBuilder market_data;
+    MarketDataListener<RecordingListener> forwarding{inner, market_data};
+    MatchingEngine::submitOrder(Order(2, 10, 99, Side::Buy), book, forwarding);
+    EXPECT_EQ(book.resolve(inner.handles[2]), book.find(2));
+}
+
+TEST(OrderHandleTest, HandlesAgreeWithIdsUnderChurn) {
+    // narrow instrument: 16-bit queue links, handles still carry 32-bit slots
+    std::mt19937_64 rng(3);
+    BasicOrderBook<CompactEquity> by_handle(2'000, 10'000);
+    BasicOrderBook<CompactEquity> by_id(2'000, 10'000);
+    RecordingListener handle_listener;
+    RecordingListener id_listener;
+    std::vector<OrderId> ids;
+    for (OrderId id = 1; id <= 20'000; ++id) {
+        unsigned action = rng() % 3;
+        if (action == 0 || ids.empty()) {
+            Order order(id, 1 + rng() % 50, 1'000 + rng() % 100, rng() % 2 ? Side::Buy : Side::Sell);
+            MatchingEngine::submitOrder(order, by_handle, handle_listener);
+            MatchingEngine::submitOrder(order, by_id, id_listener);
+            ids.push_back(id);
+            continue;
+        }
+        // ids that may have been filled since: both paths must agree on whether they still rest
+        OrderId target = ids[rng() % ids.size()];
+        auto it = handle_listener.handles.find(target);
+        OrderHandle handle = it == handle_listener.handles.end() ? OrderHandle{} : it->second;
+        if (action == 1) {
+            ASSERT_EQ(MatchingEngine::cancelOrder(handle, by_handle, handle_listener),
+                      MatchingEngine::cancelOrder(target, by_id, id_listener))
+                << id;
+        } else {
+            Price price = 1'000 + rng() % 100;
+            Quantity quantity = 1 + rng() % 50;
+            ASSERT_EQ(MatchingEngine::modifyOrder(handle, price, quantity, by_handle, handle_listener),
+                      MatchingEngine::modifyOrder(target, price, quantity, by_id, id_listener))
+                << id;
+        }
+    }
+    EXPECT_EQ(handle_listener.trades, id_listener.trades);
+    EXPECT_EQ(handle_listener.canceled, id_listener.canceled);
+    EXPECT_EQ(by_handle.bestBid(), by_id.bestBid());
+    EXPECT_EQ(by_handle.bestAsk(), by_id.bestAsk());
+}
@@ -0,0 +1,70 @@
+#include "orderbook/OrderIndex.h"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+TEST(OrderIndexTest, InsertFindErase) {
+    OrderIndex index(8);
+    std::vector<Level::RestingOrder> orders(8);
+
+    for (OrderId id = 1; id <= 8; ++id) {
+        ASSERT_TRUE(index.insert(id, &orders[id - 1]));
+    }
+    for (OrderId id = 1; id <= 8; ++id) {
+        ASSERT_EQ(index.find(id), &orders[id - 1]);
+    }
+
+    index.erase(3);
+    ASSERT_EQ(index.find(3), nullptr);
+    ASSERT_EQ(index.find(4), &orders[3]);
+    ASSERT_EQ(index.find(42), nullptr);
+}
+
+TEST(OrderIndexTest, BackwardShiftKeepsClustersReachable) {
+    // small table, many ids: forces long clusters and wrap-around
+    OrderIndex index(64);
+    std::vector<Level::RestingOrder> orders(64);
+
+    for (OrderId id = 0; id < 64; ++id) {
+        ASSERT_TRUE(index.insert(id * 128, &orders[id]));
+    }
+    for (OrderId id = 0; id < 64; id += 2) {
+        index.erase(id * 128);
+    }
+    for (OrderId id = 0; id < 64; ++id) {
+        Level::RestingOrder* expected = (id % 2 == 0) ? nullptr : &orders[id];
+        ASSERT_EQ(index.find(id * 128), expected) << "id " << id * 128;
+    }
+
+    // freed slots are reusable
+    for (OrderId id = 0; id < 64; id += 2) {
+        ASSERT_TRUE(index.insert(id * 128 + 1, &orders[id]));
+    }
+    for (OrderId id = 0; id < 64; id += 2) {
+        ASSERT_EQ(index.find(id * 128 + 1), &orders[id]);
+    }
+}
+
+TEST(OrderIndexTest, DuplicateInsertIsRefused) {
+    // in a 32-slot table the multiples of 33 all hash to slot 0: the duplicates sit inside one cluster, and id 1 is
+    // displaced to its end
+    OrderIndex index(16);
+    std::vector<Level::RestingOrder> orders(6);
+    for (OrderId id = 0; id < 5; ++id) {
+        ASSERT_TRUE(index.insert(id * 33, &orders[id]));
+    }
+    ASSERT_TRUE(index.insert(1, &orders[5]));
+
+    EXPECT_FALSE(index.insert(66, &orders[5]));
+    EXPECT_FALSE(index.insert(1, &orders[0]));
+    for (OrderId id = 0; id < 5; ++id) {
+        ASSERT_EQ(index.find(id * 33), &orders[id]);
+    }
+    EXPECT_EQ(index.find(1), &orders[5]);
+
+    // one entry per id: a single erase leaves nothing behind
+    index.erase(66);
+    EXPECT_EQ(index.find(66), nullptr);
+    EXPECT_TRUE(index.insert(66, &orders[2]));
+    EXPECT_EQ(index.find(66), &orders[2]);
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "src/domain/Command.h"
+#include "src/domain/Instruments.h"
+#include "src/engines/MatchingEngine.h"
+#include "src/orderbook/OrderBook.h"
+#include "tests/TestListeners.h"
+
+namespace {
+
+// asks 10@100, 20@101, 30@103
+template <typename Book> void seedAsks(Book& book, RecordingListener& listener) {
+    MatchingEngine::submitOrder(Order(1, 10, 100, Side::Sell), book, listener);
+    MatchingEngine::submitOrder(Order(2, 20, 101, Side::Sell), book, listener);
+    MatchingEngine::submitOrder(Order(3, 30, 103, Side::Sell), book, listener);
+    listener.added.clear();
+}
+
+} // namespace
+
+TEST(OrderTypeTest, ImmediateOrCancelExpiresTheRemainder) {
+    OrderBook book(100, 1'000);
+    RecordingListener listener;
+    seedAsks(book, listener);
+
+    MatchingEngine::submitOrder<OrderType::ImmediateOrCancel>(Order(10, 50, 101, Side::Buy), book, listener);
+    EXPECT_EQ(listener.trades, (std::vector<Trade>{{10, 1, 100, 10}, {10, 2, 101, 20}}));
+    ASSERT_EQ(listener.expired.size(), 1);
+    EXPECT_EQ(listener.expired[0].id, 10);
+    EXPECT_EQ(listener.expired[0].quantity, 20);
+    EXPECT_EQ(listener.expired[0].price, 101);
+    EXPECT_TRUE(listener.added.empty());
+    EXPECT_FALSE(book.hasBids());
+    EXPECT_EQ(book.find(10), nullptr);
+    EXPECT_EQ(book.bestAsk(), 103);
+
+    // nothing to match: expires whole, never rests
+    MatchingEngine::submitOrder<OrderType::ImmediateOrCancel>(Order(11, 5, 99, Side::Buy), book, listener);
+    EXPECT_EQ(listener.expired.back().quantity, 5);
+    EXPECT_FALSE(book.hasBids());
+}
+
+TEST(OrderTypeTest, FillOrKillChecksDepthBeforeTouchingOrders) {
+    OrderBook book(100, 1'000);
+    RecordingListener listener;
+    seedAsks(book, listener);
+    size_t high_water = book.resting_orders_pool.highWaterMark();
+
+    // 30 available up to 101: 31 is killed with the book untouched, no slot or index entry used
+    MatchingEngine::submitOrder<OrderType::FillOrKill>(Order(10, 31, 101, Side::Buy), book, listener);
+    EXPECT_TRUE(listener.trades.empty());
+    ASSERT_EQ(listener.expired.size(), 1);
+    EXPECT_EQ(listener.expired[0].quantity, 31);
+    EXPECT_EQ(book.find(1)->order.quantity, 10);
+    EXPECT_EQ(book.resting_orders_pool.highWaterMark(), high_water);
+
+    MatchingEngine::submitOrder<OrderType::FillOrKill>(Order(11, 30, 101, Side::Buy), book, listener);
+    EXPECT_EQ(listener.trades, (std::vector<Trade>{{11, 1, 100, 10}, {11, 2, 101, 20}}));
+    EXPECT_EQ(listener.expired.size(), 1);
+    EXPECT_EQ(book.bestAsk(), 103);
+
+    // sell side, levels with gaps
+    MatchingEngine::submitOrder(Order(20, 5, 90, Side::Buy), book, listener);
+    MatchingEngine::submitOrder(Order(21, 5, 80, Side::Buy), book, listener);
+    MatchingEngine::submitOrder<OrderType::FillOrKill>(Order(22, 11, 80, Side::Sell), book, listener);
+    EXPECT_EQ(listener.expired.back().id, 22);
+    MatchingEngine::submitOrder<OrderType::FillOrKill>(Order(23, 10, 80, Side::Sell), book, listener);
+    EXPECT_FALSE(book.hasBids());
+}
+
+TEST(OrderTypeTest, MarketOrdersIgnoreTheirPrice) {
+    OrderBook book(100, 1'000);
+    RecordingListener listener;
+    seedAsks(book, listener);
+
+    MatchingEngine::submitOrder<OrderType::Market>(Order(10, 100, 0, Side::Buy), book, listener);
+    EXPECT_EQ(listener.trades, (std::vector<Trade>{{10, 1, 100, 10}, {10, 2, 101, 20}, {10, 3, 103, 30}}));
+    ASSERT_EQ(listener.expired.size(), 1);
+    EXPECT_EQ(listener.expired[0].quantity, 40);
+    EXPECT_EQ(listener.expired[0].price, 0);
+    EXPECT_FALSE(book.hasAsks());
+    EXPECT_FALSE(book.hasBids());
+
+    MatchingEngine::submitOrder(Order(20, 5, 1, Side::Buy), book, listener);
+    MatchingEngine::submitOrder<OrderType::Market>(Order(21, 5, 999, Side::Sell), book, listener);
+    EXPECT_EQ(listener.trades.back(), (Trade{21, 20, 1, 5}));
+    EXPECT_EQ(listener.expired.size(), 1);
+}
+
+TEST(OrderTypeTest, PostOnlyRestsOrIsRejected) {
+    OrderBook book(100, 1'000);
+    RecordingListener listener;
+    seedAsks(book, listener);
+
+    MatchingEngine::submitOrder<OrderType::PostOnly>(Order(10, 5, 100, Side::Buy), book, listener);
+    ASSERT_EQ(listener.rejected.size(), 1);
+    EXPECT_EQ(listener.rejected[0], std::make_pair(OrderId{10}, RejectReason::WouldCross));
+    EXPECT_TRUE(listener.trades.empty());
+    EXPECT_FALSE(book.hasBids());
+
+    MatchingEngine::submitOrder<OrderType::PostOnly>(Order(11, 5, 99, Side::Buy), book, listener);
+    EXPECT_EQ(ids(listener.added), (std::vector<OrderId>{11}));
+    EXPECT_EQ(book.bestBid(), 99);
+}
+
+TEST(OrderTypeTest, CommandsCarryTheOrderType) {
+    OrderBook book(100, 1'000);
+    RecordingListener listener;
+    seedAsks(book, listener);
+    std::vector<Command> commands = {
+        Command::submit(0, Order(10, 15, 101, Side::Buy), OrderType::FillOrKill),
+        Command::submit(0, Order(11, 50, 0, Side::Buy), OrderType::Market),
+        Command::submit(0, Order(12, 5, 200, Side::Sell), OrderType::PostOnly),
+        Command::submit(0, Order(13, 5, 150, Side::Buy), OrderType::ImmediateOrCancel),
+        Command::submit(0, Order(14, 5, 150, Side::Buy)),
+    };
+    MatchingEngine::processBatch(commands, book, listener);
+
+    EXPECT_EQ(listener.trades,
+              (std::vector<Trade>{{10, 1, 100, 10}, {10, 2, 101, 5}, {11, 2, 101, 15}, {11, 3, 103, 30}}));
+    ASSERT_EQ(listener.expired.size(), 2);
+    EXPECT_EQ(listener.expired[0].id, 11);
+    EXPECT_EQ(listener.expired[0].quantity, 5);
+    EXPECT_EQ(listener.expired[1].id, 13);
+    EXPECT_EQ(ids(listener.added), (std::vector<OrderId>{12, 14}));
+    EXPECT_EQ(book.bestBid(), 150);
+    EXPECT_EQ(book.bestAsk(), 200);
+}
+
+TEST(OrderTypeTest, FillOrKillAgreesWithImmediateOrCancel) {
+    // on windowed and large-tick books: the depth check walks the overflow maps and ticks
+    std::mt19937_64 rng(9);
+    OrderBook windowed(10'000, 100'000, 64, 1'000);
+    BasicOrderBook<LargeTickFuture> future(10'000, LargeTickFuture::MAX_PRICE);
+    auto run = [&](auto& book, Price low, Price tick) {
+        RecordingListener listener;
+        for (OrderId id = 1; id <= 3'000; ++id) {
+            Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            Order order(id, 1 + rng() % 50, low + (rng() % 400) * tick, side);
+            if (rng() % 4 != 0) {
+                MatchingEngine::submitOrder(order, book, listener);
+                continue;
+            }
+            size_t trades = listener.trades.size();
+            size_t expired = listener.expired.size();
+            MatchingEngine::submitOrder<OrderType::FillOrKill>(order, book, listener);
+            if (listener.expired.size() == expired) {
+                Quantity filled = 0;
+                for (size_t i = trades; i < listener.trades.size(); ++i) {
+                    filled += std::get<3>(listener.trades[i]);
+                }
+                ASSERT_EQ(filled, order.quantity) << id;
+                continue;
+            }
+            // killed whole, untouched book: the same order as an IOC cannot fill completely either
+            ASSERT_EQ(listener.trades.size(), trades) << id;
+            ASSERT_EQ(listener.expired.back().quantity, order.quantity) << id;
+            MatchingEngine::submitOrder<OrderType::ImmediateOrCancel>(order, book, listener);
+            ASSERT_EQ(listener.expired.size(), expired + 2) << id;
+        }
+    };
+    run(windowed, 800, 1);
+    run(future, LargeTickFuture::MIN_PRICE + 100 * LargeTickFuture::TICK_SIZE, LargeTickFuture::TICK_SIZE);
+}
@@ -0,0 +1,50 @@
+#include "orderbook/PriceBitmap.h"
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+
+TEST(PriceBitmapTest, FindAcrossWordsAndLevels) {
+    PriceBitmap bitmap(300000);
+
+    ASSERT_EQ(bitmap.findNext(0), PriceBitmap::npos);
+    ASSERT_EQ(bitmap.findPrev(299999), PriceBitmap::npos);
+
+    bitmap.set(5);
+    bitmap.set(250000);
+
+    EXPECT_EQ(bitmap.findNext(0), 5);
+    EXPECT_EQ(bitmap.findNext(6), 250000);
+    EXPECT_EQ(bitmap.findNext(250001), PriceBitmap::npos);
+    EXPECT_EQ(bitmap.findPrev(249999), 5);
+    EXPECT_EQ(bitmap.findPrev(4), PriceBitmap::npos);
+
+    bitmap.clear(250000);
+    EXPECT_EQ(bitmap.findNext(6), PriceBitmap::npos);
+    EXPECT_EQ(bitmap.findPrev(299999), 5);
+}
+
+TEST(PriceBitmapTest, MatchesOrderedSet) {
+    const size_t size = 100000;
+    PriceBitmap bitmap(size);
+    std::set<size_t> reference;
+    std::mt19937_64 rng(42);
+
+    for (int i = 0; i < 20000; ++i) {
+        size_t index = rng() % size;
+        if (rng() % 3 == 0) {
+            bitmap.clear(index);
+            reference.erase(index);
+        } else {
+            bitmap.set(index);
+            reference.insert(index);
+        }
+
+        size_t from = rng() % size;
+        auto next = reference.lower_bound(from);
+        ASSERT_EQ(bitmap.findNext(from), next == reference.end() ? PriceBitmap::npos : *next);
+
+        auto prev = reference.upper_bound(from);
+        ASSERT_EQ(bitmap.findPrev(from), prev == reference.begin() ? PriceBitmap::npos : *std::prev(prev));
+    }
+}
@@ -0,0 +1,97 @@
+#include "engines/MatchingEngine.h"
+#include "orderbook/PriceLadder.h"
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+TEST(PriceLadderTest, DenseLadderNeverMoves) {
+    PriceLadder ladder(10000);
+    ASSERT_TRUE(ladder.inWindow(0));
+    ASSERT_TRUE(ladder.inWindow(10000));
+
+    ladder.markOccupied(42);
+    ladder.recentre(9000);
+    EXPECT_EQ(ladder.windowBegin(), 0);
+    EXPECT_EQ(ladder.nextOccupied(0), 42);
+    EXPECT_EQ(ladder.prevOccupied(10000), 42);
+}
+
+TEST(PriceLadderTest, RecentreMovesLevelsBetweenRingAndOverflow) {
+    PriceLadder ladder(1'000'000, 1024, 500'000);
+    Level::Pool pool(4);
+    const Price prices[] = {499'700, 500'100, 600'000, 100};
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        pool[i].order = Order{i + 1, 10, prices[i], Side::Buy};
+        ladder.level(prices[i]).add(pool, i);
+        ladder.markOccupied(prices[i]);
+    }
+    EXPECT_EQ(ladder.overflowLevels(), 2);
+    EXPECT_EQ(ladder.prevOccupied(1'000'000), 600'000);
+    EXPECT_EQ(ladder.nextOccupied(0), 100);
+
+    ladder.recentre(600'000);
+    EXPECT_TRUE(ladder.inWindow(600'000));
+    EXPECT_EQ(ladder.overflowLevels(), 3);
+    EXPECT_EQ(ladder.level(600'000).top(pool), &pool[2]);
+    EXPECT_EQ(ladder.level(500'100).top(pool), &pool[1]);
+    EXPECT_EQ(ladder.level(500'100).getTotalQuantity(), 10);
+
+    ladder.recentre(500'000);
+    EXPECT_EQ(ladder.overflowLevels(), 2);
+    EXPECT_EQ(ladder.level(499'700).top(pool), &pool[0]);
+    EXPECT_EQ(ladder.prevOccupied(500'099), 499'700);
+    EXPECT_EQ(ladder.nextOccupied(499'701), 500'100);
+}
+
+TEST(PriceLadderTest, WindowedBookMatchesDenseBook) {
+    const Price max_price = 1 << 20;
+    OrderBook dense(20000, max_price);
+    OrderBook windowed(20000, max_price, 256, max_price / 2);
+
+    std::vector<std::tuple<OrderId, OrderId, Price, Quantity>> dense_trades, windowed_trades;
+    auto dense_listener = MatchingEngineListener{
+        [&](OrderId in, OrderId rest, Price p, Quantity q) { dense_trades.emplace_back(in, rest, p, q); },
+        [](const Order&) {}, [](OrderId) {}, [](const Order&) {}};
+    auto windowed_listener = MatchingEngineListener{
+        [&](OrderId in, OrderId rest, Price p, Quantity q) { windowed_trades.emplace_back(in, rest, p, q); },
+        [](const Order&) {}, [](OrderId) {}, [](const Order&) {}};
+
+    // random walk mid far wider than the window, plus far-away orders that land in the overflow map
+    std::mt19937_64 rng(7);
+    std::set<OrderId> live;
+    Price mid = max_price / 2;
+    for (OrderId id = 1; id <= 20000; ++id) {
+        mid += static_cast<int64_t>(rng() % 21) - 10;
+        if (!live.empty() && rng() % 4 == 0) {
+            auto it = live.lower_bound(rng() % id);
+            if (it == live.end()) {
+                it = live.begin();
+            }
+            OrderId victim = *it;
+            live.erase(it);
+            if (dense.find(victim) != nullptr) {
+                MatchingEngine::cancelOrder(victim, dense, dense_listener);
+                MatchingEngine::cancelOrder(victim, windowed, windowed_listener);
+            }
+            continue;
+        }
+        Side side = rng() % 2 ? Side::Buy : Side::Sell;
+        int64_t offset = static_cast<int64_t>(rng() % 64) - 16;
+        if (rng() % 50 == 0) {
+            offset *= 1000;
+        }
+        Price price = side == Side::Buy ? mid - offset : mid + offset;
+        Order order{id, static_cast<Quantity>(1 + rng() % 100), price, side};
+        MatchingEngine::submitOrder(order, dense, dense_listener);
+        MatchingEngine::submitOrder(order, windowed, windowed_listener);
+        live.insert(id);
+
+        ASSERT_EQ(dense.bestBid(), windowed.bestBid());
+        ASSERT_EQ(dense.bestAsk(), windowed.bestAsk());
+    }
+    EXPECT_EQ(dense_trades, windowed_trades);
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "src/engines/MatchingEngine.h"
+#include "src/metrics/Probe.h"
+#include "tests/TestListeners.h"
+
+namespace {
+
+using ProbedEngine = BasicMatchingEngine<CycleProbe>;
+
+// difference between two snapshots of the same thread's buffer (peaks are absolute)
+ProbeSnapshot since(const ProbeSnapshot& before) {
+    ProbeSnapshot now = CycleProbe::buffer().snapshot();
+    for (size_t i = 0; i < PROBE_PHASES; ++i) {
+        now.cycles[i] -= before.cycles[i];
+        now.calls[i] -= before.calls[i];
+    }
+    for (size_t i = 0; i < PROBE_COUNTERS; ++i) {
+        now.counters[i] -= before.counters[i];
+    }
+    return now;
+}
+
+} // namespace
+
+TEST(ProbeTest, CountsPhasesFillsAndCursorWalks) {
+    OrderBook book(100, 1000);
+    auto listener = makeNoopListener();
+    ProbeSnapshot before = CycleProbe::buffer().snapshot();
+
+    ProbedEngine::submitOrder(Order(1, 10, 100, Side::Sell), book, listener);
+    ProbedEngine::submitOrder(Order(2, 10, 104, Side::Sell), book, listener);
+    ProbedEngine::submitOrder(Order(3, 10, 110, Side::Sell), book, listener);
+    ProbedEngine::submitOrder(Order(4, 25, 110, Side::Buy), book, listener); // 100 and 104 fully, 5 of 110
+    ProbedEngine::cancelOrder(3, book, listener);
+
+    ProbeSnapshot delta = since(before);
+    EXPECT_EQ(delta.phaseCalls(ProbePhase::Match), 4);
+    EXPECT_EQ(delta.phaseCalls(ProbePhase::Insert), 3);
+    EXPECT_EQ(delta.phaseCalls(ProbePhase::PoolAllocate), 3);
+    EXPECT_EQ(delta.phaseCalls(ProbePhase::IndexInsert), 3);
+    EXPECT_EQ(delta.phaseCalls(ProbePhase::Fill), 3);
+    EXPECT_EQ(delta.phaseCalls(ProbePhase::Remove), 1);
+    EXPECT_EQ(delta.phaseCalls(ProbePhase::PoolRelease), 3);
+    EXPECT_EQ(delta.phaseCalls(ProbePhase::IndexErase), 3);
+    EXPECT_EQ(delta.phaseCalls(ProbePhase::CursorScan), 3); // two full fills and the cancel
+    EXPECT_GT(delta.phaseCycles(ProbePhase::Match), delta.phaseCycles(ProbePhase::Fill));
+
+    EXPECT_EQ(delta.counter(ProbeCounter::Fills), 3);
+    EXPECT_EQ(delta.counter(ProbeCounter::Aggressors), 1);
+    EXPECT_EQ(delta.counter(ProbeCounter::LevelsWalked), 4 + 6); // 100 -> 104 -> 110, the last cancel empties
+    EXPECT_GE(delta.peak(ProbePeak::FillsPerAggressor), 3);
+    EXPECT_GE(delta.peak(ProbePeak::PoolHighWater), 3);
+}
+
+TEST(ProbeTest, InstrumentationDoesNotChangeResults) {
+    OrderBook plain(100, 1000), probed(100, 1000);
+    auto listener = makeNoopListener();
+    for (OrderId id = 1; id <= 40; ++id) {
+        Order order(id, static_cast<Quantity>(1 + id % 7), 495 + id % 11, id % 2 ? Side::Buy : Side::Sell);
+        MatchingEngine::submitOrder(order, plain, listener);
+        ProbedEngine::submitOrder(order, probed, listener);
+    }
+    EXPECT_EQ(plain.bestBid(), probed.bestBid());
+    EXPECT_EQ(plain.bestAsk(), probed.bestAsk());
+    std::vector<Order> plain_orders, probed_orders;
+    plain.forEachRestingOrder([&](const Order& order) { plain_orders.push_back(order); });
+    probed.forEachRestingOrder([&](const Order& order) { probed_orders.push_back(order); });
+    ASSERT_EQ(plain_orders.size(), probed_orders.size());
+    for (size_t i = 0; i < plain_orders.size(); ++i) {
+        EXPECT_EQ(plain_orders[i].id, probed_orders[i].id);
+        EXPECT_EQ(plain_orders[i].quantity, probed_orders[i].quantity);
+    }
+}
+
+TEST(ProbeTest, ReaderSnapshotsOtherThreadsWhileTheyRecord) {
+    constexpr uint64_t ORDERS = 20'000;
+    uint64_t inserts_before = CycleProbe::snapshot().phaseCalls(ProbePhase::Insert);
+    std::atomic<bool> done{false};
+
+    std::thread engine([&] {
+        OrderBook book(ORDERS + 1, 1000);
+        auto listener = makeNoopListener();
+        for (OrderId id = 1; id <= ORDERS; ++id) {
+            ProbedEngine::submitOrder(Order(id, 1, 400 + id % 100, Side::Buy), book, listener);
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    // lock-free reads while the engine thread writes: totals only ever grow
+    uint64_t last = inserts_before;
+    while (!done.load(std::memory_order_acquire)) {
+        uint64_t inserts = CycleProbe::snapshot().phaseCalls(ProbePhase::Insert);
+        ASSERT_GE(inserts, last);
+        last = inserts;
+    }
+    engine.join();
+    EXPECT_EQ(CycleProbe::snapshot().phaseCalls(ProbePhase::Insert) - inserts_before, ORDERS);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "src/engines/ShardedEngine.h"
+
+namespace {
+
+struct CountingListener {
+    size_t shard = 0;
+    uint64_t trades = 0;
+    uint64_t added = 0;
+    uint64_t canceled = 0;
+
+    void onTrade(OrderId, OrderId, Price, Quantity) { ++trades; }
+    void onOrderAdded(const Order&) { ++added; }
+    void onOrderCanceled(OrderId) { ++canceled; }
+    void onOrderModified(const Order&) {}
+};
+
+auto makeEngine(size_t shards, SymbolId symbols) {
+    return std::make_unique<ShardedEngine<CountingListener>>(
+        shards, symbols, [](SymbolId) { return std::make_unique<OrderBook>(1024, 1000); },
+        [](size_t shard) { return CountingListener{shard}; });
+}
+
+} // namespace
+
+TEST(ShardedEngineTest, RoutesSymbolsToOwningShard) {
+    auto engine = makeEngine(3, 8);
+    engine->start();
+
+    // per symbol: one resting sell, one crossing buy, one resting buy, then cancel the resting buy
+    OrderId id = 1;
+    for (SymbolId symbol = 0; symbol < 8; ++symbol) {
+        engine->submit(Command::submit(symbol, Order{id++, 10, 100, Side::Sell}));
+        engine->submit(Command::submit(symbol, Order{id++, 4, 100, Side::Buy}));
+        engine->submit(Command::submit(symbol, Order{id++, 5, 90, Side::Buy}));
+        engine->submit(Command::cancel(symbol, id - 1));
+    }
+    engine->waitUntilDrained();
+    engine->stop();
+
+    uint64_t trades = 0, added = 0, canceled = 0;
+    for (size_t shard = 0; shard < engine->shardCount(); ++shard) {
+        trades += engine->listener(shard).trades;
+        added += engine->listener(shard).added;
+        canceled += engine->listener(shard).canceled;
+    }
+    EXPECT_EQ(trades, 8);
+    EXPECT_EQ(added, 16);
+    EXPECT_EQ(canceled, 8);
+
+    // symbols 1, 4 and 7 all live on shard 1
+    EXPECT_EQ(engine->listener(1).trades, 3);
+    for (SymbolId symbol = 0; symbol < 8; ++symbol) {
+        EXPECT_EQ(engine->book(symbol).bestAsk(), 100);
+        EXPECT_EQ(engine->book(symbol).bestAskLevel().getTotalQuantity(), 6);
+        EXPECT_FALSE(engine->book(symbol).hasBids());
+    }
+}
+
+TEST(ShardedEngineTest, StopDrainsQueuedCommands) {
+    auto engine = makeEngine(2, 2);
+    engine->start();
+    for (OrderId id = 1; id <= 500; ++id) {
+        engine->submit(Command::submit(id % 2, Order{id, 1, 100 + id % 7, Side::Sell}));
+    }
+    engine->stop();
+
+    EXPECT_EQ(engine->listener(0).added + engine->listener(1).added, 500);
+}
@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <unistd.h>
+
+#include "src/engines/MatchingEngine.h"
+#include "src/persistence/Snapshot.h"
+
+namespace {
+
+using Trade = std::tuple<OrderId, OrderId, Price, Quantity>;
+
+auto makeRecorder(std::vector<Trade>& trades) {
+    return MatchingEngineListener{
+        [&](OrderId in, OrderId rest, Price p, Quantity q) { trades.emplace_back(in, rest, p, q); },
+        [](const Order&) {}, [](OrderId) {}, [](const Order&) {}};
+}
+
+std::vector<Order> contents(OrderBook& book) {
+    std::vector<Order> orders;
+    book.forEachRestingOrder([&](const Order& order) { orders.push_back(order); });
+    return orders;
+}
+
+bool sameOrders(const std::vector<Order>& a, const std::vector<Order>& b) {
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const Order& x, const Order& y) {
+        return x.id == y.id && x.price == y.price && x.quantity == y.quantity && x.side == y.side;
+    });
+}
+
+class SnapshotTest : public ::testing::Test {
+  protected:
+    std::string path = (std::filesystem::temp_directory_path() /
+                        ("snapshot_test_" + std::to_string(::getpid()) + "_" +
+                         ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".snap"))
+                           .string();
+
+    void TearDown() override { std::filesystem::remove(path); }
+
+    // resting flow with partial fills, cancels and modifies, so levels have holes and reshuffled queues
+    static void populate(OrderBook& book, Price mid, size_t count) {
+        std::vector<Trade> ignored;
+        auto listener = makeRecorder(ignored);
+        std::mt19937_64 rng(3);
+        for (OrderId id = 1; id <= count; ++id) {
+            Side side = rng() % 2 ? Side::Buy : Side::Sell;
+            Price price = side == Side::Buy ? mid - 40 + rng() % 42 : mid - 1 + rng() % 42;
+            MatchingEngine::submitOrder(Order(id, static_cast<Quantity>(1 + rng() % 20), price, side), book, listener);
+            OrderId target = 1 + rng() % id;
+            if (rng() % 5 == 0 && book.find(target) != nullptr) {
+                MatchingEngine::cancelOrder(target, book, listener);
+            } else if (rng() % 5 == 0 && book.find(target) != nullptr) {
+                MatchingEngine::modifyOrder(target, book.find(target)->order.price, 1, book, listener);
+            }
+        }
+    }
+
+    // the restored book must keep matching exactly like the original
+    static void expectSameBehaviour(OrderBook& original, OrderBook& restored, Price mid) {
+        std::vector<Trade> original_trades, restored_trades;
+        auto original_listener = makeRecorder(original_trades);
+        auto restored_listener = makeRecorder(restored_trades);
+        for (OrderId id = 1'000'000; id < 1'000'040; ++id) {
+            Side side = id % 2 ? Side::Buy : Side::Sell;
+            Order sweep(id, 15, side == Side::Buy ? mid + 10 : mid - 10, side);
+            MatchingEngine::submitOrder(sweep, original, original_listener);
+            MatchingEngine::submitOrder(sweep, restored, restored_listener);
+        }
+        EXPECT_FALSE(original_trades.empty());
+        EXPECT_EQ(restored_trades, original_trades);
+        EXPECT_TRUE(sameOrders(contents(restored), contents(original)));
+    }
+};
+
+} // namespace
+
+TEST_F(SnapshotTest, RestoresQueuesCursorsAndIndex) {
+    OrderBook original(4000, 10'000);
+    populate(original, 5'000, 3000);
+    writeSnapshot(original, path, 1234);
+
+    OrderBook restored(4000, 10'000);
+    EXPECT_EQ(restoreSnapshot(path, restored), 1234);
+    EXPECT_EQ(restored.bestBid(), original.bestBid());
+    EXPECT_EQ(restored.bestAsk(), original.bestAsk());
+    EXPECT_EQ(restored.bestBidLevel().getTotalQuantity(), original.bestBidLevel().getTotalQuantity());
+
+    std::vector<Order> orders = contents(original);
+    ASSERT_FALSE(orders.empty());
+    EXPECT_TRUE(sameOrders(contents(restored), orders));
+    for (const Order& order : orders) {
+        ASSERT_NE(restored.find(order.id), nullptr);
+    }
+
+    expectSameBehaviour(original, restored, 5'000);
+}
+
+TEST_F(SnapshotTest, RestoresIntoWindowedLadder) {
+    OrderBook original(4000, 1'000'000'000, 64, 1000);
+    populate(original, 700'000'000, 3000);
+    writeSnapshot(original, path);
+
+    OrderBook restored(4000, 1'000'000'000, 64, 1000);
+    restoreSnapshot(path, restored);
+    EXPECT_TRUE(restored.bids.inWindow(restored.bestBid()));
+    EXPECT_TRUE(restored.asks.inWindow(restored.bestAsk()));
+    EXPECT_TRUE(sameOrders(contents(restored), contents(original)));
+
+    expectSameBehaviour(original, restored, 700'000'000);
+}
+
+TEST_F(SnapshotTest, EmptyBookRoundTrips) {
+    OrderBook original(10, 100);
+    writeSnapshot(original, path, 7);
+
+    OrderBook restored(10, 100);
+    EXPECT_EQ(restoreSnapshot(path, restored), 7);
+    EXPECT_FALSE(restored.hasBids());
+    EXPECT_FALSE(restored.hasAsks());
+}
+
+TEST_F(SnapshotTest, RejectsIncompatibleBooks) {
+    OrderBook original(100, 1000);
+    populate(original, 500, 50);
+    writeSnapshot(original, path);
+
+    OrderBook other_range(100, 2000);
+    EXPECT_THROW(restoreSnapshot(path, other_range), std::runtime_error);
+
+    OrderBook too_small(1, 1000);
+    EXPECT_THROW(restoreSnapshot(path, too_small), std::runtime_error);
+    EXPECT_FALSE(too_small.hasBids());
+    EXPECT_FALSE(too_small.hasAsks());
+}
+
+TEST_F(SnapshotTest, RejectsDamagedFiles) {
+    OrderBook original(100, 1000);
+    populate(original, 500, 50);
+    writeSnapshot(original, path);
+
+    // one bit of one order's quantity
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(sizeof(SnapshotHeader) + offsetof(Order, quantity));
+        char byte = 0;
+        file.read(&byte, 1);
+        byte ^= 1;
+        file.seekp(sizeof(SnapshotHeader) + offsetof(Order, quantity));
+        file.write(&byte, 1);
+    }
+    OrderBook restored(100, 1000);
+    EXPECT_THROW(restoreSnapshot(path, restored), std::runtime_error);
+    EXPECT_FALSE(restored.hasBids());
+    EXPECT_FALSE(restored.hasAsks());
+
+    // a truncated file
+    writeSnapshot(original, path);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    EXPECT_THROW(restoreSnapshot(path, restored), std::runtime_error);
+}
+
+TEST(OrderBookRestoreTest, RejectsOrdersAndCursorsItCannotHold) {
+    OrderBook book(8, 1000);
+    const Price no_ask = book.max_price + 1;
+    std::vector<Order> valid = {Order(1, 5, 100, Side::Buy), Order(2, 5, 99, Side::Buy), Order(3, 5, 110, Side::Sell)};
+
+    auto rejected = [&](std::vector<Order> orders, Price best_bid, Price best_ask) {
+        bool restored = book.restore(orders, best_bid, best_ask);
+        return !restored && !book.hasBids() && !book.hasAsks() && book.find(1) == nullptr &&
+               book.resting_orders_pool.highWaterMark() == 0;
+    };
+    EXPECT_TRUE(rejected({Order(1, 5, 0, Side::Buy)}, 0, no_ask));
+    EXPECT_TRUE(rejected({Order(1, 5, 1001, Side::Sell)}, 0, 1001));
+    EXPECT_TRUE(rejected({Order(1, 0, 100, Side::Buy)}, 100, no_ask));
+    EXPECT_TRUE(rejected({Order(1, 5, 100, static_cast<Side>(7))}, 0, no_ask));
+    // cursors that are not those of the loaded levels, or that cross
+    EXPECT_TRUE(rejected(valid, 99, 110));
+    EXPECT_TRUE(rejected(valid, 100, no_ask));
+    EXPECT_TRUE(rejected({Order(1, 5, 100, Side::Buy), Order(3, 5, 100, Side::Sell)}, 100, 100));
+    // a duplicate id is found while indexing, after the slots were taken: they are given back
+    EXPECT_TRUE(rejected({Order(1, 5, 100, Side::Buy), Order(2, 5, 99, Side::Buy), Order(1, 5, 98, Side::Buy)}, 100,
+                         no_ask));
+
+    // none of it left a trace: a valid image still loads
+    ASSERT_TRUE(book.restore(valid, 100, 110));
+    EXPECT_EQ(book.bestBid(), 100);
+    EXPECT_EQ(book.bestAsk(), 110);
+    EXPECT_EQ(book.bidLevel(100).getTotalQuantity(), 5);
+    ASSERT_NE(book.find(2), nullptr);
+    EXPECT_EQ(book.find(2)->order.price, 99);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "src/engines/MatchingEngine.h"
+
+// Listeners shared by the engine tests, which all link into one EngineTests binary.
+
+/**
+ * @brief Listener that ignores every callback, for tests that only look at the book
+ */
+inline auto makeNoopListener() {
+    return MatchingEngineListener{[](OrderId, OrderId, Price, Quantity) {}, [](const Order&) {}, [](OrderId) {},
+                                  [](const Order&) {}};
+}
+
+using Trade = std::tuple<OrderId, OrderId, Price, Quantity>;
+
+inline std::vector<OrderId> ids(const std::vector<Order>& orders) {
+    std::vector<OrderId> all;
+    for (const Order& order : orders) {
+        all.push_back(order.id);
+    }
+    return all;
+}
+
+/**
+ * @brief Records every callback the engine makes, optional ones included, in call order per kind
+ *
+ * Takes the handle form of onOrderAdded, so `handles` holds the last handle reported for each order.
+ */
+struct RecordingListener {
+    std::vector<Trade> trades;
+    std::vector<Order> added;
+    std::map<OrderId, OrderHandle> handles;
+    std::vector<OrderId> canceled;
+    std::vector<Order> modified;
+    std::vector<std::pair<OrderId, RejectReason>> rejected;
+    std::vector<Order> expired;
+
+    void onTrade(OrderId incoming_id, OrderId resting_id, Price price, Quantity quantity) {
+        trades.emplace_back(incoming_id, resting_id, price, quantity);
+    }
+    void onOrderAdded(const Order& order, OrderHandle handle) {
+        added.push_back(order);
+        handles[order.id] = handle;
+    }
+    void onOrderCanceled(OrderId id) { canceled.push_back(id); }
+    void onOrderModified(const Order& order) { modified.push_back(order); }
+    void onOrderRejected(const Order& order, RejectReason reason) { rejected.emplace_back(order.id, reason); }
+    void onOrderExpired(const Order& order) { expired.push_back(order); }
+};
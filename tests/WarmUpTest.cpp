@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "src/domain/Instruments.h"
+#include "src/engines/MatchingEngine.h"
+#include "src/orderbook/OrderBook.h"
+#include "tests/TestListeners.h"
+
+namespace {
+
+using OrderFields = std::tuple<OrderId, Quantity, Price, Side, OwnerId>;
+
+OrderFields fields(const Order& order) { return {order.id, order.quantity, order.price, order.side, order.owner}; }
+
+std::vector<OrderFields> fields(const std::vector<Order>& orders) {
+    std::vector<OrderFields> all;
+    for (const Order& order : orders) {
+        all.push_back(fields(order));
+    }
+    return all;
+}
+
+template <typename Book> std::vector<Order> restingOrders(Book& book) {
+    std::vector<Order> orders;
+    book.forEachRestingOrder([&](const Order& order) { orders.push_back(order); });
+    return orders;
+}
+
+template <typename Book> void expectFresh(Book& book, Price max_tick) {
+    EXPECT_FALSE(book.hasBids());
+    EXPECT_FALSE(book.hasAsks());
+    EXPECT_EQ(book.max_bid, 0);
+    EXPECT_EQ(book.min_ask, max_tick + 1);
+    EXPECT_EQ(book.resting_orders_pool.highWaterMark(), 0);
+    EXPECT_EQ(book.bids.overflowLevels(), 0);
+    EXPECT_EQ(book.asks.overflowLevels(), 0);
+}
+
+// the same random flow of submits, cancels and modifies around `low`
+template <typename Book> void replay(Book& book, RecordingListener& listener, Price low, Price tick) {
+    std::mt19937_64 rng(21);
+    for (OrderId id = 1; id <= 5'000; ++id) {
+        Side side = rng() % 2 ? Side::Buy : Side::Sell;
+        MatchingEngine::submitOrder(Order(id, 1 + rng() % 20, low + (rng() % 200) * tick, side), book, listener);
+        if (id % 3 == 0 && id > 50) {
+            MatchingEngine::cancelOrder(OrderId{id - rng() % 50}, book, listener);
+        }
+        if (id % 7 == 0 && id > 50) {
+            MatchingEngine::modifyOrder(OrderId{id - rng() % 50}, low + (rng() % 200) * tick, 1 + rng() % 20, book,
+                                        listener);
+        }
+    }
+}
+
+} // namespace
+
+TEST(WarmUpTest, LeavesTheBookAsConstructed) {
+    OrderBook book(10'000, 100'000, 256, 50'000);
+    Price window = book.bids.windowBegin();
+    EXPECT_TRUE(MatchingEngine::warmUp(book, {.lock_memory = false}));
+    expectFresh(book, 100'000);
+    EXPECT_EQ(book.bids.windowBegin(), window);
+    EXPECT_EQ(book.asks.windowBegin(), window);
+    EXPECT_EQ(book.find(1), nullptr);
+    EXPECT_TRUE(restingOrders(book).empty());
+    RecordingListener listener;
+    EXPECT_EQ(MatchingEngine::massCancel(1, book, listener), 0); // the warm-up owner has nothing left
+}
+
+TEST(WarmUpTest, MatchesExactlyLikeAFreshBook) {
+    auto check = [](auto& fresh, auto& warmed, Price low, Price tick) {
+        ASSERT_TRUE(MatchingEngine::warmUp(warmed, {.orders = 1'000, .rounds = 3, .lock_memory = false}));
+        RecordingListener expected;
+        RecordingListener actual;
+        replay(fresh, expected, low, tick);
+        replay(warmed, actual, low, tick);
+        EXPECT_EQ(actual.trades, expected.trades);
+        EXPECT_EQ(fields(actual.added), fields(expected.added));
+        EXPECT_EQ(actual.canceled, expected.canceled);
+        EXPECT_EQ(fields(actual.modified), fields(expected.modified));
+        EXPECT_EQ(actual.rejected, expected.rejected);
+        EXPECT_EQ(fields(restingOrders(warmed)), fields(restingOrders(fresh)));
+        EXPECT_EQ(warmed.resting_orders_pool.highWaterMark(), fresh.resting_orders_pool.highWaterMark());
+    };
+    OrderBook dense(10'000, 1'000);
+    OrderBook dense_warmed(10'000, 1'000);
+    check(dense, dense_warmed, 800, 1);
+    // a narrow window: the warm-up levels reach past its inner part, so it slides and must come back
+    OrderBook windowed(10'000, 100'000, 64, 1'000);
+    OrderBook windowed_warmed(10'000, 100'000, 64, 1'000);
+    check(windowed, windowed_warmed, 900, 1);
+    BasicOrderBook<LargeTickFuture> future(10'000, LargeTickFuture::MAX_PRICE);
+    BasicOrderBook<LargeTickFuture> future_warmed(10'000, LargeTickFuture::MAX_PRICE);
+    Price low = LargeTickFuture::MIN_PRICE + 100 * LargeTickFuture::TICK_SIZE;
+    check(future, future_warmed, low, LargeTickFuture::TICK_SIZE);
+    BasicOrderBook<CompactEquity> compact(10'000, 1'000);
+    BasicOrderBook<CompactEquity> compact_warmed(10'000, 1'000);
+    check(compact, compact_warmed, 100, 1);
+}
+
+TEST(WarmUpTest, RestoreCanFollow) {
+    OrderBook source(1'000, 1'000);
+    RecordingListener listener;
+    replay(source, listener, 400, 1);
+    std::vector<Order> orders = restingOrders(source);
+
+    OrderBook book(1'000, 1'000);
+    MatchingEngine::warmUp(book, {.lock_memory = false});
+    ASSERT_TRUE(book.restore(orders, source.max_bid, source.min_ask));
+    EXPECT_EQ(fields(restingOrders(book)), fields(orders));
+    EXPECT_EQ(book.bestBid(), source.bestBid());
+    EXPECT_EQ(book.bestAsk(), source.bestAsk());
+}
+
+TEST(WarmUpTest, CommitsTheWholePool) {
+    OrderBook book(100'000, 1'000, 0, 0, PoolOptions{.initial_capacity = 0, .prefault = false});
+    EXPECT_EQ(book.resting_orders_pool.committedCapacity(), 0);
+    EXPECT_TRUE(book.prefault(false));
+    EXPECT_EQ(book.resting_orders_pool.committedCapacity(), 100'000);
+    // locking may be refused (RLIMIT_MEMLOCK): the book works either way
+    MatchingEngine::warmUp(book);
+    expectFresh(book, 1'000);
+}
+
+TEST(WarmUpTest, TinyBooks) {
+    OrderBook no_levels(10, 2); // no room for a level on each side of a mid price: prefault only
+    EXPECT_TRUE(MatchingEngine::warmUp(no_levels, {.lock_memory = false}));
+    expectFresh(no_levels, 2);
+    OrderBook small(8, 5);
+    EXPECT_TRUE(MatchingEngine::warmUp(small, {.lock_memory = false}));
+    expectFresh(small, 5);
+    RecordingListener listener;
+    MatchingEngine::submitOrder(Order(1, 10, 3, Side::Buy), small, listener);
+    MatchingEngine::submitOrder(Order(2, 4, 3, Side::Sell), small, listener);
+    EXPECT_EQ(listener.trades.size(), 1);
+    EXPECT_EQ(small.bestBidLevel().getTotalQuantity(), 6);
+}
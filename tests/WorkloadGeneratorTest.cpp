@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "src/workload/WorkloadGenerator.h"
+
+namespace {
+
+bool sameCommands(const std::vector<Command>& a, const std::vector<Command>& b) {
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(Command)) == 0;
+}
+
+WorkloadProfile smallProfile(uint64_t seed) {
+    WorkloadProfile profile = profiles::volatileMomentum();
+    profile.seed = seed;
+    profile.initial_depth = 500;
+    profile.max_depth = 1'000;
+    return profile;
+}
+
+} // namespace
+
+TEST(WorkloadGeneratorTest, SameSeedSameStream) {
+    WorkloadStream first = WorkloadGenerator(smallProfile(1)).generate(20'000);
+    WorkloadStream again = WorkloadGenerator(smallProfile(1)).generate(20'000);
+    WorkloadStream other = WorkloadGenerator(smallProfile(2)).generate(20'000);
+
+    EXPECT_TRUE(sameCommands(first.setup, again.setup));
+    EXPECT_TRUE(sameCommands(first.flow, again.flow));
+    EXPECT_FALSE(sameCommands(first.flow, other.flow));
+}
+
+TEST(WorkloadGeneratorTest, EveryStreamReplaysCleanly) {
+    for (WorkloadProfile profile : profiles::all()) {
+        profile.initial_depth = std::min<size_t>(profile.initial_depth, 2'000);
+        profile.max_depth = std::min<size_t>(profile.max_depth, 4'000);
+        WorkloadStream stream = WorkloadGenerator(profile).generate(50'000);
+        ASSERT_LE(stream.peak_resting_orders, profile.max_depth) << profile.name;
+
+        size_t counts[3] = {}, trades = 0, rejects = 0;
+        OrderBook book(stream.peak_resting_orders, stream.max_price);
+        auto listener = MatchingEngineListener{[&](OrderId, OrderId, Price, Quantity) { ++trades; },
+                                               [](const Order&) {}, [](OrderId) {}, [](const Order&) {},
+                                               [&](const Order&, RejectReason) { ++rejects; }};
+        for (const Command& command : stream.setup) {
+            MatchingEngine::process(command, book, listener);
+        }
+        for (const Command& command : stream.flow) {
+            // cancels and modifies always target a resting order
+            if (command.type != CommandType::Submit) {
+                ASSERT_NE(book.find(command.id), nullptr) << profile.name;
+            }
+            ++counts[static_cast<int>(command.type)];
+            MatchingEngine::process(command, book, listener);
+        }
+        EXPECT_EQ(rejects, 0) << profile.name;
+        EXPECT_GT(trades, 0) << profile.name;
+
+        // the mix follows the profile (cancels also absorb adds beyond max_depth)
+        double cancels = 100.0 * counts[static_cast<int>(CommandType::Cancel)] / stream.flow.size();
+        double modifies = 100.0 * counts[static_cast<int>(CommandType::Modify)] / stream.flow.size();
+        EXPECT_GE(cancels, profile.cancel_percent - 2.0) << profile.name;
+        EXPECT_NEAR(modifies, profile.modify_percent, 2.0) << profile.name;
+    }
+}
+
+TEST(WorkloadGeneratorTest, SavesAndLoadsBinaryStreams) {
+    std::string path =
+        (std::filesystem::temp_directory_path() / ("workload_test_" + std::to_string(::getpid()) + ".bin")).string();
+    WorkloadStream stream = WorkloadGenerator(smallProfile(3)).generate(5'000);
+    stream.save(path);
+    WorkloadStream loaded = WorkloadStream::load(path);
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(loaded.max_price, stream.max_price);
+    EXPECT_EQ(loaded.peak_resting_orders, stream.peak_resting_orders);
+    EXPECT_TRUE(sameCommands(loaded.setup, stream.setup));
+    EXPECT_TRUE(sameCommands(loaded.flow, stream.flow));
+
+    EXPECT_THROW(WorkloadStream::load(path), std::runtime_error);
+}